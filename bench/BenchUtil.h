@@ -0,0 +1,214 @@
+/**
+ * @file BenchUtil.h
+ * @brief Utilidades mínimas de benchmark: calentamiento, repeticiones,
+ *        estadísticas y salida legible por máquina (JSON / CSV)
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Uso desde un main de bench/:
+ * @code{.cpp}
+ * Bench::Runner runner(argc, argv, "benchKernels");
+ * runner.run("PIDController", "next", N, [&] { for (...) acc += pid.next(u[i]); });
+ * return runner.finish();
+ * @endcode
+ *
+ * Opciones de línea de comandos comunes:
+ *   --reps R        Repeticiones medidas por caso (por defecto 30)
+ *   --warmup-ms M   Tiempo mínimo de calentamiento por caso (por defecto 50)
+ *   --filter TEXTO  Solo ejecuta casos cuyo nombre contenga TEXTO
+ *   --json FICHERO  Escribe los resultados en JSON
+ *   --csv FICHERO   Escribe los resultados en CSV
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <time.h>
+
+namespace Bench {
+
+/** @brief Impide que el compilador elimine un cálculo cuyo resultado no se usa */
+inline void doNotOptimize(double value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Silencia std::cout mientras existe (p. ej. la ruta del log que imprime HiloPID)
+ */
+class SilenceCout {
+public:
+    SilenceCout() : old_(std::cout.rdbuf(nullptr)) {}
+    ~SilenceCout() { std::cout.rdbuf(old_); }
+    SilenceCout(const SilenceCout&) = delete;
+    SilenceCout& operator=(const SilenceCout&) = delete;
+private:
+    std::streambuf* old_;
+};
+
+/** @brief Tiempo monotónico en nanosegundos */
+inline double nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<double>(ts.tv_sec) * 1e9 + static_cast<double>(ts.tv_nsec);
+}
+
+/** @brief Resultado estadístico de un caso (tiempos por muestra) */
+struct Result {
+    std::string name;      ///< Bloque o señal medida (p. ej. "TransferFunctionSystem/n=4")
+    std::string api;       ///< API medida ("next", "process", "generate", ...)
+    std::size_t samples;   ///< Muestras por repetición
+    std::size_t reps;      ///< Repeticiones medidas
+    double ns_min;         ///< ns/muestra, mejor repetición
+    double ns_median;      ///< ns/muestra, mediana
+    double ns_mean;        ///< ns/muestra, media
+    double ns_p90;         ///< ns/muestra, percentil 90
+    double ns_stddev;      ///< ns/muestra, desviación típica
+    double msamples_per_s; ///< Throughput a partir de la mediana [Msamples/s]
+};
+
+/**
+ * @class Runner
+ * @brief Ejecuta casos con calentamiento y repetición y acumula resultados
+ */
+class Runner {
+public:
+    Runner(int argc, char** argv, std::string suite)
+        : suite_(std::move(suite)), reps_(30), warmup_ms_(50.0)
+    {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--reps" && hasValue) reps_ = std::max(1, std::atoi(argv[++i]));
+            else if (arg == "--warmup-ms" && hasValue) warmup_ms_ = std::atof(argv[++i]);
+            else if (arg == "--filter" && hasValue) filter_ = argv[++i];
+            else if (arg == "--json" && hasValue) json_path_ = argv[++i];
+            else if (arg == "--csv" && hasValue) csv_path_ = argv[++i];
+            else extra_.push_back(arg);
+        }
+        std::cout << std::left << std::setw(40) << "caso" << std::setw(12) << "api"
+                  << std::right << std::setw(12) << "ns/muestra" << std::setw(12) << "min"
+                  << std::setw(12) << "p90" << std::setw(14) << "Msamples/s" << std::endl;
+    }
+
+    /** @brief Argumentos no reconocidos (para opciones propias de cada benchmark) */
+    const std::vector<std::string>& extraArgs() const { return extra_; }
+
+    /**
+     * @brief Mide un caso
+     * @param name Nombre del bloque o señal
+     * @param api API medida
+     * @param samples Muestras procesadas por cada llamada a body
+     * @param body Función que procesa @p samples muestras
+     */
+    template <typename F>
+    void run(const std::string& name, const std::string& api, std::size_t samples, F&& body) {
+        if (!filter_.empty() && (name + "/" + api).find(filter_) == std::string::npos) return;
+
+        // Calentamiento: caches, predictores de salto y frecuencia de CPU
+        double start = nowNs();
+        do {
+            body();
+        } while (nowNs() - start < warmup_ms_ * 1e6);
+
+        std::vector<double> per_sample(reps_);
+        for (int r = 0; r < reps_; ++r) {
+            double t0 = nowNs();
+            body();
+            double t1 = nowNs();
+            per_sample[r] = (t1 - t0) / static_cast<double>(samples);
+        }
+
+        results_.push_back(summarize(name, api, samples, per_sample));
+        print(results_.back());
+    }
+
+    /**
+     * @brief Escribe los ficheros pedidos por línea de comandos
+     * @return Código de salida para main()
+     */
+    int finish() const {
+        if (!json_path_.empty()) writeJson(json_path_);
+        if (!csv_path_.empty()) writeCsv(csv_path_);
+        return 0;
+    }
+
+    const std::vector<Result>& results() const { return results_; }
+
+private:
+    Result summarize(const std::string& name, const std::string& api,
+                     std::size_t samples, std::vector<double> v) const {
+        std::sort(v.begin(), v.end());
+        double mean = 0.0;
+        for (double x : v) mean += x;
+        mean /= static_cast<double>(v.size());
+        double var = 0.0;
+        for (double x : v) var += (x - mean) * (x - mean);
+        var /= static_cast<double>(v.size());
+
+        Result r;
+        r.name = name;
+        r.api = api;
+        r.samples = samples;
+        r.reps = v.size();
+        r.ns_min = v.front();
+        r.ns_median = v[v.size() / 2];
+        r.ns_mean = mean;
+        r.ns_p90 = v[std::min(v.size() - 1, (v.size() * 9) / 10)];
+        r.ns_stddev = std::sqrt(var);
+        r.msamples_per_s = r.ns_median > 0.0 ? 1e3 / r.ns_median : 0.0;
+        return r;
+    }
+
+    static void print(const Result& r) {
+        std::cout << std::left << std::setw(40) << r.name << std::setw(12) << r.api
+                  << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << r.ns_median << std::setw(12) << r.ns_min
+                  << std::setw(12) << r.ns_p90 << std::setw(14) << r.msamples_per_s
+                  << std::defaultfloat << std::endl;
+    }
+
+    void writeJson(const std::string& path) const {
+        std::ofstream os(path);
+        os << "{\n  \"suite\": \"" << suite_ << "\",\n  \"results\": [\n";
+        for (std::size_t i = 0; i < results_.size(); ++i) {
+            const Result& r = results_[i];
+            os << "    {\"name\": \"" << r.name << "\", \"api\": \"" << r.api
+               << "\", \"samples\": " << r.samples << ", \"reps\": " << r.reps
+               << ", \"ns_min\": " << r.ns_min << ", \"ns_median\": " << r.ns_median
+               << ", \"ns_mean\": " << r.ns_mean << ", \"ns_p90\": " << r.ns_p90
+               << ", \"ns_stddev\": " << r.ns_stddev
+               << ", \"msamples_per_s\": " << r.msamples_per_s << "}"
+               << (i + 1 < results_.size() ? "," : "") << "\n";
+        }
+        os << "  ]\n}\n";
+    }
+
+    void writeCsv(const std::string& path) const {
+        std::ofstream os(path);
+        os << "suite,name,api,samples,reps,ns_min,ns_median,ns_mean,ns_p90,ns_stddev,msamples_per_s\n";
+        for (const Result& r : results_) {
+            os << suite_ << "," << r.name << "," << r.api << "," << r.samples << "," << r.reps
+               << "," << r.ns_min << "," << r.ns_median << "," << r.ns_mean << "," << r.ns_p90
+               << "," << r.ns_stddev << "," << r.msamples_per_s << "\n";
+        }
+    }
+
+    std::string suite_;
+    int reps_;
+    double warmup_ms_;
+    std::string filter_;
+    std::string json_path_;
+    std::string csv_path_;
+    std::vector<std::string> extra_;
+    std::vector<Result> results_;
+};
+
+} // namespace Bench
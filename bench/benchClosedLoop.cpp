@@ -0,0 +1,581 @@
+/**
+ * @file benchClosedLoop.cpp
+ * @brief Latencia y jitter extremo a extremo del lazo con hilos bajo carga configurable
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Levanta el lazo completo de testSystem (referencia, sumador, PID, D/A,
+ * planta y A/D, cada bloque en su hilo) sin IPC, opcionalmente con hilos
+ * de carga de CPU y lazos adicionales, y al terminar imprime por hilo:
+ * latencia de despertar, drift del periodo y t_total (histogramas
+ * TimingStats), la edad de sus entradas respecto a la muestra de ref de
+ * origen (MarcaTemporal) y el retardo de propagación de flancos ref→ykd.
+ *
+ * Para medir la propagación la planta es una ganancia estática, el PID es
+ * proporcional (Kp = 1) y la realimentación del sumador se sustituye por 0:
+ * cada flanco de la referencia cuadrada atraviesa todos los hilos sin que
+ * el lazo oscile. Los instantes se toman dentro de los bloques (sondas),
+ * así que la medida no depende de ningún hilo observador.
+ *
+ * Opciones:
+ *   --seconds S    Duración de la medida (por defecto 5)
+ *   --hogs N       Hilos de carga de CPU en bucle activo (por defecto 0)
+ *   --loops N      Lazos adicionales idénticos en paralelo (por defecto 0)
+ *   --sched MODO   other | fifo (SCHED_FIFO, requiere privilegios)
+ *   --prio P       Prioridad SCHED_FIFO (por defecto 80)
+ *   --edge-ms M    Semiperiodo de la referencia cuadrada (por defecto 100)
+ *   --json FICHERO Informe completo en JSON
+ *   --trace FICHERO Traza Chrome Trace / Perfetto de todos los hilos
+ *   --hw           Contadores hardware (perf_event_open) por tipo de bloque
+ *   --layout L     Variables del lazo (por defecto compartido):
+ *                  compartido  VariablesCompartidas + mutex, hilos Hilo/Hilo2in/HiloPID
+ *                  empaquetado VariablesLazoEmpaquetadas (seqlock, canales contiguos)
+ *                  alineado    VariablesLazoAlineadas (seqlock, una línea por productor)
+ *   --sync         Arranque común (BaseTiempoComun) con desfases
+ *                  planta → A/D → ref → sumador → PID → D/A dentro del periodo
+ *   --por-cambio   ConfigHilo::por_cambio: sumador y D/A (sin memoria) solo se
+ *                  evalúan cuando su entrada se reescribe
+ *
+ * empaquetado y alineado ejecutan los mismos hilos (HiloPeriodico con
+ * IOCanal) y solo difieren en el relleno de los canales: su diferencia es
+ * el coste del false sharing. Con --hw el contador de fallos de caché solo
+ * existe en compartido (HiloPeriodico no lee contadores).
+ *
+ * Ejemplo:
+ *   ./bin/benchClosedLoop --seconds 10 --hogs 4 --loops 2 --json lazo.json
+ *   ./bin/benchClosedLoop --seconds 10 --layout alineado
+ */
+
+#include "BenchUtil.h"
+
+#include "ADConverter.h"
+#include "BaseTiempoComun.h"
+#include "ContadoresHW.h"
+#include "DAConverter.h"
+#include "Hilo.h"
+#include "Hilo2in.h"
+#include "HiloPID.h"
+#include "HiloPeriodico.h"
+#include "HiloSignal.h"
+#include "PIDController.h"
+#include "ParametrosCompartidos.h"
+#include "SignalGenerator.h"
+#include "Sumador.h"
+#include "TimingStats.h"
+#include "Tracer.h"
+#include "TransferFunctionSystem.h"
+#include "VariablesCompartidas.h"
+#include "VariablesLazoAlineadas.h"
+#include "system_config.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace DiscreteSystems;
+
+namespace {
+
+std::int64_t monotonicNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<std::int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+/**
+ * @brief Referencia cuadrada que anota el instante de cada flanco
+ */
+class SondaReferencia : public SignalGenerator::Signal {
+public:
+    SondaReferencia(double Ts, double half_period)
+        : Signal(Ts, 0.0, 16), half_period_(half_period), last_(0.0),
+          edge_ns_(0), edge_seq_(0)
+    {
+        setRecording(false);
+    }
+
+    double computeAt(double time) const override {
+        return (static_cast<long long>(time / half_period_) % 2) ? 1.0 : 0.0;
+    }
+
+    double next() override {
+        double v = Signal::next();
+        if (v != last_) {
+            last_ = v;
+            edge_ns_.store(monotonicNs(), std::memory_order_relaxed);
+            edge_seq_.fetch_add(1, std::memory_order_release);
+        }
+        return v;
+    }
+
+    std::int64_t edgeNs() const { return edge_ns_.load(std::memory_order_relaxed); }
+    std::uint64_t edgeSeq() const { return edge_seq_.load(std::memory_order_acquire); }
+
+private:
+    double half_period_;
+    double last_;
+    std::atomic<std::int64_t> edge_ns_;
+    std::atomic<std::uint64_t> edge_seq_;
+};
+
+/**
+ * @brief A/D que mide el retardo desde el último flanco de la referencia
+ *        hasta que el cambio aparece en su salida (ykd)
+ */
+class SondaAD : public ADConverter {
+public:
+    SondaAD(double Ts, const SondaReferencia* ref)
+        : ADConverter(Ts), ref_(ref), last_(0.0), handled_seq_(0) {}
+
+    const TimingStats& propagation() const { return propagation_; }
+
+protected:
+    friend class DiscreteSystem;   // nextDirecto<SondaAD>() en HiloPeriodico
+
+    double compute(double uk) override {
+        double y = ADConverter::compute(uk);
+        if (y != last_) {
+            last_ = y;
+            std::uint64_t seq = ref_->edgeSeq();
+            if (seq != handled_seq_) {
+                handled_seq_ = seq;
+                propagation_.record(monotonicNs() - ref_->edgeNs());
+            }
+        }
+        return y;
+    }
+
+private:
+    const SondaReferencia* ref_;
+    double last_;
+    std::uint64_t handled_seq_;
+    TimingStats propagation_;
+};
+
+/**
+ * @brief Bloque sin entrada que avanza la referencia (para HiloPeriodico)
+ */
+class FuenteReferencia : public DiscreteSystem {
+public:
+    FuenteReferencia(double Ts, std::shared_ptr<SondaReferencia> sonda)
+        : DiscreteSystem(Ts, 16), sonda_(std::move(sonda)) {}
+
+protected:
+    friend class DiscreteSystem;
+
+    double compute(double) override { return sonda_->next(); }
+    void resetState() override {}
+
+private:
+    std::shared_ptr<SondaReferencia> sonda_;
+};
+
+/**
+ * @brief Política de E/S del hilo de referencia: origen de la marca temporal
+ */
+template <class Canal>
+struct IOFuente {
+    Canal* salida;
+    const std::atomic<bool>* running;
+
+    bool leer(double& u) const {
+        u = 0.0;
+        return running->load(std::memory_order_relaxed);
+    }
+
+    void escribir(double y) const {
+        const std::int64_t ahora = MarcaTemporal::ahoraNs();
+        salida->publicar(y, ahora, ahora);
+    }
+};
+
+/**
+ * @brief Un lazo completo: variables, bloques e hilos
+ */
+struct Lazo {
+    virtual ~Lazo() = default;
+    virtual void stop() = 0;
+    virtual std::vector<std::pair<std::string, pthread_t>> threads() const = 0;
+    virtual std::vector<std::pair<std::string, const HiloTiming*>> timings() const = 0;
+    virtual const TimingStats& propagation() const = 0;
+    /// Iteraciones omitidas por ConfigHilo::por_cambio en los bloques sin memoria
+    virtual std::vector<std::pair<std::string, std::uint64_t>> omitidas() const = 0;
+};
+
+/**
+ * @brief Lazo con VariablesCompartidas bajo un mutex (testSystem)
+ */
+struct LazoCompartido : Lazo {
+    BaseTiempoComun base{6};
+    VariablesCompartidas vars;
+    ParametrosCompartidos params;
+    bool running = true;
+    double zero = 0.0;   // Sustituye a ykd en el sumador (lazo abierto para medir propagación)
+
+    std::shared_ptr<SondaReferencia> ref;
+    std::shared_ptr<Sumador> sumador;
+    std::shared_ptr<PIDController> pid;
+    std::shared_ptr<DAConverter> da;
+    std::shared_ptr<TransferFunctionSystem> planta;
+    std::shared_ptr<SondaAD> ad;
+
+    std::unique_ptr<SignalGenerator::HiloSignal> hiloRef;
+    std::unique_ptr<Hilo2in> hiloSumador;
+    std::unique_ptr<HiloPID> hiloPID;
+    std::unique_ptr<Hilo> hiloDA;
+    std::unique_ptr<Hilo> hiloPlanta;
+    std::unique_ptr<Hilo> hiloAD;
+
+    LazoCompartido(int id, double edge_s, bool hw, bool sync, bool por_cambio) {
+        const double Ts_c = SystemConfig::TS_COMPONENT;
+        const double f_c = SystemConfig::FREQ_COMPONENT;
+        const std::string tag = "bench" + std::to_string(id);
+
+        vars.running = true;
+        params.kp = 1.0;
+        params.ki = 0.0;
+        params.kd = 0.0;
+
+        // Todas las variables del lazo bajo el mismo mutex (el de vars, que usa HiloPID)
+        std::shared_ptr<pthread_mutex_t> mtx(&vars.mtx, [](pthread_mutex_t*) {});
+        auto alias = [](double* p) { return std::shared_ptr<double>(p, [](double*) {}); };
+
+        ref = std::make_shared<SondaReferencia>(Ts_c, edge_s);
+        sumador = std::make_shared<Sumador>(Ts_c);
+        pid = std::make_shared<PIDController>(1.0, 0.0, 0.0, SystemConfig::TS_CONTROLLER);
+        da = std::make_shared<DAConverter>(Ts_c);
+        planta = std::make_shared<TransferFunctionSystem>(std::vector<double>{1.0},
+                                                          std::vector<double>{1.0, 0.0}, Ts_c);
+        ad = std::make_shared<SondaAD>(Ts_c, ref.get());
+
+        // Marcas de propagación en todos los saltos (ref → e → u → ua → yk → ykd)
+        auto cfg = [this, hw, sync, por_cambio, Ts_c](MarcaTemporal* in, MarcaTemporal* out, EtapaLazo etapa) {
+            ConfigHilo c;
+            c.marca_entrada = in;
+            c.marca_salida = out;
+            c.contadores_hw = hw;
+            c.por_cambio = por_cambio;
+            if (sync) {
+                c.base_tiempo = &base;
+                c.fase_s = faseLazo(etapa, Ts_c);
+            }
+            return c;
+        };
+
+        hiloRef = std::make_unique<SignalGenerator::HiloSignal>(ref, alias(&vars.ref), &running, mtx, f_c, tag + "Ref",
+                                                                cfg(nullptr, &vars.marca_ref, EtapaLazo::Referencia));
+        hiloSumador = std::make_unique<Hilo2in>(sumador, alias(&vars.ref), alias(&zero), alias(&vars.e),
+                                                &running, mtx, f_c, tag + "Sumador", cfg(&vars.marca_ref, &vars.marca_e, EtapaLazo::Sumador));
+        hiloPID = std::make_unique<HiloPID>(pid.get(), &vars, &params, SystemConfig::FREQ_CONTROLLER, tag + "PID",
+                                            cfg(nullptr, nullptr, EtapaLazo::PID));
+        hiloDA = std::make_unique<Hilo>(da, alias(&vars.u), alias(&vars.ua), &running, mtx, f_c, tag + "DA",
+                                        cfg(&vars.marca_u, &vars.marca_ua, EtapaLazo::DA));
+        hiloPlanta = std::make_unique<Hilo>(planta, alias(&vars.ua), alias(&vars.yk), &running, mtx, f_c, tag + "Planta",
+                                            cfg(&vars.marca_ua, &vars.marca_yk, EtapaLazo::Planta));
+        hiloAD = std::make_unique<Hilo>(ad, alias(&vars.yk), alias(&vars.ykd), &running, mtx, f_c, tag + "AD",
+                                        cfg(&vars.marca_yk, &vars.marca_ykd, EtapaLazo::AD));
+    }
+
+    void stop() override {
+        pthread_mutex_lock(&vars.mtx);
+        running = false;
+        vars.running = false;
+        pthread_mutex_unlock(&vars.mtx);
+    }
+
+    std::vector<std::pair<std::string, pthread_t>> threads() const override {
+        return {{"ref", hiloRef->getThread()}, {"sumador", hiloSumador->getThread()},
+                {"pid", hiloPID->getThread()}, {"da", hiloDA->getThread()},
+                {"planta", hiloPlanta->getThread()}, {"ad", hiloAD->getThread()}};
+    }
+
+    std::vector<std::pair<std::string, const HiloTiming*>> timings() const override {
+        return {{"ref", &hiloRef->timing()}, {"sumador", &hiloSumador->timing()},
+                {"pid", &hiloPID->timing()}, {"da", &hiloDA->timing()},
+                {"planta", &hiloPlanta->timing()}, {"ad", &hiloAD->timing()}};
+    }
+
+    const TimingStats& propagation() const override { return ad->propagation(); }
+
+    std::vector<std::pair<std::string, std::uint64_t>> omitidas() const override {
+        return {{"sumador", hiloSumador->getOmitidas()}, {"da", hiloDA->getOmitidas()}};
+    }
+};
+
+/**
+ * @brief Lazo sobre canales con seqlock (VariablesLazoAlineadas o
+ *        VariablesLazoEmpaquetadas), sin mutex ni despacho virtual
+ */
+template <class Canal>
+struct LazoCanales : Lazo {
+    BaseTiempoComun base{6};
+    VariablesLazoBase<Canal> vars;
+    Canal zero;   // Sustituye a ykd en el sumador; nunca se escribe
+
+    std::shared_ptr<SondaReferencia> sonda;
+    std::shared_ptr<FuenteReferencia> ref;
+    std::shared_ptr<Sumador> sumador;
+    std::shared_ptr<PIDController> pid;
+    std::shared_ptr<DAConverter> da;
+    std::shared_ptr<TransferFunctionSystem> planta;
+    std::shared_ptr<SondaAD> ad;
+
+    std::unique_ptr<HiloPeriodico<FuenteReferencia, IOFuente<Canal>>> hiloRef;
+    std::unique_ptr<HiloPeriodico<Sumador, IOCanal2<Canal>>> hiloSumador;
+    std::unique_ptr<HiloPeriodico<PIDController, IOCanal<Canal>>> hiloPID;
+    std::unique_ptr<HiloPeriodico<DAConverter, IOCanal<Canal>>> hiloDA;
+    std::unique_ptr<HiloPeriodico<TransferFunctionSystem, IOCanal<Canal>>> hiloPlanta;
+    std::unique_ptr<HiloPeriodico<SondaAD, IOCanal<Canal>>> hiloAD;
+
+    LazoCanales(double edge_s, bool sync, bool por_cambio) {
+        const double Ts_c = SystemConfig::TS_COMPONENT;
+        const double f_c = SystemConfig::FREQ_COMPONENT;
+
+        sonda = std::make_shared<SondaReferencia>(Ts_c, edge_s);
+        ref = std::make_shared<FuenteReferencia>(Ts_c, sonda);
+        sumador = std::make_shared<Sumador>(Ts_c);
+        pid = std::make_shared<PIDController>(1.0, 0.0, 0.0, SystemConfig::TS_CONTROLLER);
+        da = std::make_shared<DAConverter>(Ts_c);
+        planta = std::make_shared<TransferFunctionSystem>(std::vector<double>{1.0},
+                                                          std::vector<double>{1.0, 0.0}, Ts_c);
+        ad = std::make_shared<SondaAD>(Ts_c, sonda.get());
+
+        auto cfg = [this, sync, por_cambio, Ts_c](EtapaLazo etapa) {
+            ConfigHilo c;
+            c.por_cambio = por_cambio;
+            if (sync) {
+                c.base_tiempo = &base;
+                c.fase_s = faseLazo(etapa, Ts_c);
+            }
+            return c;
+        };
+
+        const std::atomic<bool>* run = &vars.running;
+        hiloRef = std::make_unique<HiloPeriodico<FuenteReferencia, IOFuente<Canal>>>(
+            ref, IOFuente<Canal>{&vars.ref, run}, f_c, cfg(EtapaLazo::Referencia));
+        hiloSumador = std::make_unique<HiloPeriodico<Sumador, IOCanal2<Canal>>>(
+            sumador, IOCanal2<Canal>{&vars.ref, &zero, &vars.e, run}, f_c, cfg(EtapaLazo::Sumador));
+        hiloPID = std::make_unique<HiloPeriodico<PIDController, IOCanal<Canal>>>(
+            pid, IOCanal<Canal>{&vars.e, &vars.u, run}, SystemConfig::FREQ_CONTROLLER, cfg(EtapaLazo::PID));
+        hiloDA = std::make_unique<HiloPeriodico<DAConverter, IOCanal<Canal>>>(
+            da, IOCanal<Canal>{&vars.u, &vars.ua, run}, f_c, cfg(EtapaLazo::DA));
+        hiloPlanta = std::make_unique<HiloPeriodico<TransferFunctionSystem, IOCanal<Canal>>>(
+            planta, IOCanal<Canal>{&vars.ua, &vars.yk, run}, f_c, cfg(EtapaLazo::Planta));
+        hiloAD = std::make_unique<HiloPeriodico<SondaAD, IOCanal<Canal>>>(
+            ad, IOCanal<Canal>{&vars.yk, &vars.ykd, run}, f_c, cfg(EtapaLazo::AD));
+    }
+
+    void stop() override { vars.running.store(false, std::memory_order_relaxed); }
+
+    std::vector<std::pair<std::string, pthread_t>> threads() const override {
+        return {{"ref", hiloRef->getThread()}, {"sumador", hiloSumador->getThread()},
+                {"pid", hiloPID->getThread()}, {"da", hiloDA->getThread()},
+                {"planta", hiloPlanta->getThread()}, {"ad", hiloAD->getThread()}};
+    }
+
+    std::vector<std::pair<std::string, const HiloTiming*>> timings() const override {
+        return {{"ref", &hiloRef->timing()}, {"sumador", &hiloSumador->timing()},
+                {"pid", &hiloPID->timing()}, {"da", &hiloDA->timing()},
+                {"planta", &hiloPlanta->timing()}, {"ad", &hiloAD->timing()}};
+    }
+
+    const TimingStats& propagation() const override { return ad->propagation(); }
+
+    std::vector<std::pair<std::string, std::uint64_t>> omitidas() const override {
+        return {{"sumador", hiloSumador->getOmitidas()}, {"da", hiloDA->getOmitidas()}};
+    }
+};
+
+void printRow(const std::string& name, const TimingStats& st) {
+    std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << st.count()
+              << std::setw(12) << st.mean() / 1000.0
+              << std::setw(12) << st.percentile(50) / 1000.0
+              << std::setw(12) << st.percentile(99) / 1000.0
+              << std::setw(12) << st.percentile(99.9) / 1000.0
+              << std::setw(12) << static_cast<double>(st.max()) / 1000.0
+              << std::defaultfloat << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    double seconds = 5.0;
+    int hogs = 0;
+    int extra_loops = 0;
+    std::string sched = "other";
+    int prio = 80;
+    double edge_ms = 100.0;
+    std::string json_path;
+    std::string trace_path;
+    bool hw = false;
+    std::string layout = "compartido";
+    bool sync = false;
+    bool por_cambio = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--seconds" && hasValue) seconds = std::atof(argv[++i]);
+        else if (arg == "--hogs" && hasValue) hogs = std::atoi(argv[++i]);
+        else if (arg == "--loops" && hasValue) extra_loops = std::atoi(argv[++i]);
+        else if (arg == "--sched" && hasValue) sched = argv[++i];
+        else if (arg == "--prio" && hasValue) prio = std::atoi(argv[++i]);
+        else if (arg == "--edge-ms" && hasValue) edge_ms = std::atof(argv[++i]);
+        else if (arg == "--json" && hasValue) json_path = argv[++i];
+        else if (arg == "--trace" && hasValue) trace_path = argv[++i];
+        else if (arg == "--hw") hw = true;
+        else if (arg == "--sync") sync = true;
+        else if (arg == "--por-cambio") por_cambio = true;
+        else if (arg == "--layout" && hasValue) layout = argv[++i];
+        else {
+            std::cerr << "Opción desconocida: " << arg << std::endl;
+            return 2;
+        }
+    }
+
+    if (layout != "compartido" && layout != "empaquetado" && layout != "alineado") {
+        std::cerr << "Layout desconocido: " << layout << std::endl;
+        return 2;
+    }
+
+    if (!trace_path.empty()) {
+        Tracer::habilitar(true);
+    }
+
+    // ---- Carga de CPU ----
+    std::atomic<bool> hog_run(true);
+    std::vector<std::thread> hog_threads;
+    for (int h = 0; h < hogs; ++h) {
+        hog_threads.emplace_back([&hog_run] {
+            volatile std::uint64_t x = 0;
+            while (hog_run.load(std::memory_order_relaxed)) x = x + 1;
+        });
+    }
+
+    // ---- Lazos ----
+    std::vector<std::unique_ptr<Lazo>> lazos;
+    {
+        Bench::SilenceCout quiet;
+        for (int l = 0; l <= extra_loops; ++l) {
+            if (layout == "alineado") {
+                lazos.push_back(std::make_unique<LazoCanales<CanalLazo>>(edge_ms / 1000.0, sync, por_cambio));
+            } else if (layout == "empaquetado") {
+                lazos.push_back(std::make_unique<LazoCanales<CanalLazoEmpaquetado>>(edge_ms / 1000.0, sync, por_cambio));
+            } else {
+                lazos.push_back(std::make_unique<LazoCompartido>(l, edge_ms / 1000.0, hw, sync, por_cambio));
+            }
+        }
+    }
+
+    std::string sched_applied = "other";
+    if (sched == "fifo") {
+        struct sched_param sp;
+        sp.sched_priority = prio;
+        bool ok = true;
+        for (const auto& lazo : lazos) {
+            for (const auto& th : lazo->threads()) {
+                if (pthread_setschedparam(th.second, SCHED_FIFO, &sp) != 0) ok = false;
+            }
+        }
+        sched_applied = ok ? "fifo" : "other (SCHED_FIFO denegado)";
+    }
+
+    usleep(static_cast<useconds_t>(seconds * 1e6));
+
+    for (auto& lazo : lazos) lazo->stop();
+    hog_run = false;
+    for (auto& t : hog_threads) t.join();
+    // Dar tiempo a que cada hilo termine su última iteración antes de leer
+    usleep(static_cast<useconds_t>(3.0 * SystemConfig::TS_CONTROLLER * 1e6));
+
+    // ---- Informe ----
+    std::cout << "benchClosedLoop: " << seconds << " s, lazos=" << lazos.size()
+              << ", hogs=" << hogs << ", sched=" << sched_applied << ", layout=" << layout
+              << (sync ? ", sync" : "") << (por_cambio ? ", por cambio" : "") << std::endl;
+    std::cout << std::left << std::setw(28) << "métrica [us]" << std::right
+              << std::setw(10) << "n" << std::setw(12) << "media" << std::setw(12) << "p50"
+              << std::setw(12) << "p99" << std::setw(12) << "p99.9" << std::setw(12) << "max" << std::endl;
+
+    for (std::size_t l = 0; l < lazos.size(); ++l) {
+        const std::string pre = "L" + std::to_string(l) + "/";
+        for (const auto& t : lazos[l]->timings()) {
+            printRow(pre + t.first + "/wake", t.second->wake_latency);
+            printRow(pre + t.first + "/|drift|", t.second->drift);
+            printRow(pre + t.first + "/t_total", t.second->total);
+            if (t.second->source_age.count() > 0) {
+                printRow(pre + t.first + "/edad_entrada", t.second->input_age);
+                printRow(pre + t.first + "/edad_origen", t.second->source_age);
+            }
+        }
+        printRow(pre + "ref->ykd", lazos[l]->propagation());
+        if (por_cambio) {
+            for (const auto& o : lazos[l]->omitidas()) {
+                std::cout << pre << o.first << ": " << o.second << " iteraciones omitidas" << std::endl;
+            }
+        }
+    }
+
+    if (hw) {
+        auto resumen = RegistroHW::resumen();
+        if (resumen.empty()) {
+            std::cout << "Contadores hardware no disponibles (perf_event_paranoid / PMU)" << std::endl;
+        }
+        for (const auto& r : resumen) {
+            std::cout << std::left << std::setw(28) << ("hw/" + r.tipo) << std::right << std::fixed
+                      << std::setprecision(2) << "llamadas=" << r.llamadas
+                      << " ciclos/llamada=" << r.ciclosPorLlamada() << " IPC=" << r.ipc()
+                      << " GHz=" << r.ghz() << " fallos_cache=" << r.fallos_cache
+                      << " fallos_salto=" << r.fallos_salto << std::defaultfloat << std::endl;
+        }
+    }
+
+    if (!json_path.empty()) {
+        std::ofstream os(json_path);
+        os << "{\n  \"config\": {\"seconds\": " << seconds << ", \"loops\": " << lazos.size()
+           << ", \"hogs\": " << hogs << ", \"sched\": \"" << sched_applied << "\""
+           << ", \"layout\": \"" << layout << "\", \"sync\": " << (sync ? "true" : "false")
+           << ", \"por_cambio\": " << (por_cambio ? "true" : "false")
+           << ", \"freq_component_hz\": " << SystemConfig::FREQ_COMPONENT
+           << ", \"freq_controller_hz\": " << SystemConfig::FREQ_CONTROLLER
+           << ", \"edge_ms\": " << edge_ms << "},\n  \"hw\": " << RegistroHW::toJson()
+           << ",\n  \"loops\": [\n";
+        for (std::size_t l = 0; l < lazos.size(); ++l) {
+            os << "    {\"threads\": {";
+            auto timings = lazos[l]->timings();
+            for (std::size_t i = 0; i < timings.size(); ++i) {
+                os << "\"" << timings[i].first << "\": " << timings[i].second->toJson()
+                   << (i + 1 < timings.size() ? ", " : "");
+            }
+            os << "}, \"propagation_ref_ykd_ns\": " << lazos[l]->propagation().toJson() << "}"
+               << (l + 1 < lazos.size() ? "," : "") << "\n";
+        }
+        os << "  ]\n}\n";
+    }
+
+    if (!trace_path.empty()) {
+        Tracer::habilitar(false);
+        if (!Tracer::exportarJson(trace_path)) {
+            std::cerr << "No se pudo escribir la traza en " << trace_path << std::endl;
+        } else if (Tracer::eventosDescartados() > 0) {
+            std::cerr << "Traza incompleta: " << Tracer::eventosDescartados()
+                      << " eventos descartados (buffers llenos)" << std::endl;
+        }
+    }
+
+    // Los destructores de los Hilo hacen pthread_join
+    return 0;
+}
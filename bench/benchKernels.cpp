@@ -0,0 +1,200 @@
+/**
+ * @file benchKernels.cpp
+ * @brief ns/muestra y throughput de los núcleos de cálculo de cada bloque
+ *        DiscreteSystem y de cada tipo de Signal (API por muestra y por bloque)
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Ejemplo:
+ *   ./bin/benchKernels --reps 50 --json kernels.json
+ *   ./bin/benchKernels --filter StateSpace
+ */
+
+#include "BenchUtil.h"
+
+#include "ADConverter.h"
+#include "DAConverter.h"
+#include "Discretizer.h"
+#include "PIDController.h"
+#include "SOSSystem.h"
+#include "SignalGenerator.h"
+#include "SineOscillatorBank.h"
+#include "StateSpaceSystem.h"
+#include "Sumador.h"
+#include "TableSignal.h"
+#include "TransferFunctionSystem.h"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace DiscreteSystems;
+using namespace SignalGenerator;
+
+namespace {
+
+constexpr std::size_t kSamples = 4096;   // Muestras por repetición
+constexpr double kTs = 0.001;
+
+/** @brief Denominador estable de orden n: prod(1 - p_i z^-1) con polos reales en (0.5, 0.95) */
+std::vector<double> stableDenominator(std::size_t order) {
+    std::vector<double> a = {1.0};
+    for (std::size_t i = 0; i < order; ++i) {
+        double p = 0.5 + 0.45 * static_cast<double>(i + 1) / static_cast<double>(order + 1);
+        std::vector<double> next(a.size() + 1, 0.0);
+        for (std::size_t j = 0; j < a.size(); ++j) {
+            next[j] += a[j];
+            next[j + 1] -= p * a[j];
+        }
+        a = next;
+    }
+    return a;
+}
+
+/** @brief Mide next(), nextDirecto() y process() de un bloque de una entrada */
+template <class System>
+void benchBlock(Bench::Runner& runner, const std::string& name,
+                System& sys, const std::vector<double>& u, std::vector<double>& y) {
+    DiscreteSystem& base = sys;
+    runner.run(name, "next", u.size(), [&] {
+        double acc = 0.0;
+        for (double uk : u) acc += base.next(uk);
+        Bench::doNotOptimize(acc);
+    });
+    runner.run(name, "nextDirecto", u.size(), [&] {
+        double acc = 0.0;
+        for (double uk : u) acc += sys.template nextDirecto<System>(uk);
+        Bench::doNotOptimize(acc);
+    });
+    runner.run(name, "process", u.size(), [&] {
+        sys.process(u.data(), y.data(), u.size());
+        Bench::doNotOptimize(y.back());
+    });
+}
+
+/** @brief Mide next() y generate() de una señal */
+void benchSignal(Bench::Runner& runner, const std::string& name,
+                 Signal& sig, std::vector<double>& y) {
+    runner.run(name, "next", y.size(), [&] {
+        double acc = 0.0;
+        for (std::size_t i = 0; i < y.size(); ++i) acc += sig.next();
+        Bench::doNotOptimize(acc);
+    });
+    runner.run(name, "generate", y.size(), [&] {
+        sig.generate(y.data(), y.size());
+        Bench::doNotOptimize(y.back());
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Bench::Runner runner(argc, argv, "benchKernels");
+
+    std::vector<double> u(kSamples), u2(kSamples), y(kSamples);
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (std::size_t i = 0; i < kSamples; ++i) {
+        u[i] = dist(rng);
+        u2[i] = dist(rng);
+    }
+
+    // ---- Bloques DiscreteSystem ----
+    {
+        PIDController pid(2.0, 1.0, 0.05, kTs);
+        benchBlock(runner, "PIDController", pid, u, y);
+    }
+
+    for (std::size_t order : {1, 2, 4, 8, 16}) {
+        std::vector<double> a = stableDenominator(order);
+        std::vector<double> b(order + 1, 1.0 / static_cast<double>(order + 1));
+        TransferFunctionSystem tf(b, a, kTs);
+        benchBlock(runner, "TransferFunctionSystem/n=" + std::to_string(order), tf, u, y);
+    }
+
+    for (std::size_t n : {1, 2, 4, 8, 16, 32, 64}) {
+        std::vector<std::vector<double>> A(n, std::vector<double>(n, 0.0));
+        for (std::size_t i = 0; i < n; ++i) {
+            for (std::size_t j = 0; j < n; ++j) {
+                A[i][j] = (i == j) ? 0.9 : 0.05 / static_cast<double>(n);
+            }
+        }
+        std::vector<double> B(n, 1.0), C(n, 1.0 / static_cast<double>(n));
+        StateSpaceSystem ss(A, B, C, 0.0, kTs);
+        benchBlock(runner, "StateSpaceSystem/n=" + std::to_string(n), ss, u, y);
+    }
+
+    for (std::size_t order : {2, 10}) {
+        // Butterworth pasa-bajos (fc = 50 Hz) discretizado en biquads
+        std::vector<std::complex<double>> poles;
+        const double wc = 2.0 * M_PI * 50.0;
+        for (std::size_t k = 0; k < order; ++k) {
+            double theta = M_PI * (2.0 * k + order + 1) / (2.0 * order);
+            poles.emplace_back(wc * std::cos(theta), wc * std::sin(theta));
+        }
+        ContinuousZPK zpk{{}, poles, std::pow(wc, static_cast<double>(order))};
+        SOSSystem sos(zpkToSOS(bilinearZPK(zpk, kTs)), kTs);
+        benchBlock(runner, "SOSSystem/n=" + std::to_string(order), sos, u, y);
+    }
+
+    {
+        ADConverter ad(kTs);
+        DAConverter da(kTs);
+        Sumador sum(kTs);
+        benchBlock(runner, "ADConverter", ad, u, y);
+        benchBlock(runner, "DAConverter", da, u, y);
+
+        runner.run("Sumador", "next", kSamples, [&] {
+            double acc = 0.0;
+            for (std::size_t i = 0; i < kSamples; ++i) acc += sum.next(u[i], u2[i]);
+            Bench::doNotOptimize(acc);
+        });
+        runner.run("Sumador", "process", kSamples, [&] {
+            sum.process(u.data(), u2.data(), y.data(), kSamples);
+            Bench::doNotOptimize(y.back());
+        });
+    }
+
+    // ---- Señales ----
+    {
+        StepSignal step(kTs, 1.0, 0.5);
+        benchSignal(runner, "StepSignal", step, y);
+
+        PwmSignal pwm(kTs, 1.0, 0.3, 0.02);
+        benchSignal(runner, "PwmSignal", pwm, y);
+
+        SineSignal sine(kTs, 1.0, 3.7, 0.1);
+        benchSignal(runner, "SineSignal/Analytic", sine, y);
+
+        SineSignal osc(kTs, 1.0, 3.7, 0.1, 0.0, 1024, SineMode::Oscillator);
+        benchSignal(runner, "SineSignal/Oscillator", osc, y);
+
+        std::vector<std::shared_ptr<Signal>> children = {
+            std::make_shared<StepSignal>(kTs, 1.0, 0.5),
+            std::make_shared<SineSignal>(kTs, 0.5, 2.0, 0.0, 0.0, 1024, SineMode::Oscillator),
+            std::make_shared<PwmSignal>(kTs, 0.2, 0.5, 0.02)
+        };
+        SignalMixer mixer(kTs, children, {1.0, 2.0, -1.0});
+        benchSignal(runner, "SignalMixer/3", mixer, y);
+
+        std::vector<double> table(100000);
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            table[i] = std::sin(2.0 * M_PI * 0.01 * static_cast<double>(i));
+        }
+        TableSignal linear(kTs, table.data(), table.size(), 0.01, TableInterp::Linear, TableEnd::Loop);
+        benchSignal(runner, "TableSignal/Linear", linear, y);
+        TableSignal cubic(kTs, table.data(), table.size(), 0.01, TableInterp::Cubic, TableEnd::Loop);
+        benchSignal(runner, "TableSignal/Cubic", cubic, y);
+
+        SineOscillatorBank bank(kTs);
+        for (int c = 0; c < 8; ++c) bank.addChannel(1.0, 1.0 + c);
+        std::vector<double> out(kSamples * bank.channels());
+        runner.run("SineOscillatorBank/8", "generate", kSamples * bank.channels(), [&] {
+            bank.generate(out.data(), kSamples);
+            Bench::doNotOptimize(out.back());
+        });
+    }
+
+    return runner.finish();
+}
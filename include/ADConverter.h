@@ -48,6 +48,8 @@ public:
     double getLastInput() const { return u_prev_; }
 
 protected:
+    friend class DiscreteSystem;   ///< nextDirecto<ADConverter>() llama a compute()
+
     /**
      * @brief Calcula la salida del convertidor A/D (ecuación en diferencias)
      * 
@@ -0,0 +1,119 @@
+/**
+ * @file BaseTiempoComun.h
+ * @brief Arranque sincronizado y desfase dentro del periodo para los hilos del lazo
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * @code{.cpp}
+ * BaseTiempoComun base(6);   // ref, sumador, PID, D/A, planta, A/D
+ * ConfigHilo cfg;
+ * cfg.base_tiempo = &base;
+ * cfg.fase_s = faseLazo(EtapaLazo::AD, SystemConfig::TS_COMPONENT);
+ * Hilo hiloAD(ad, yk, ykd, running, mtx, 1000.0, "hiloAD", cfg);
+ * @endcode
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <time.h>
+
+#include "ConfigHilo.h"
+#include "Temporizador.h"
+
+namespace DiscreteSystems {
+
+/**
+ * @class BaseTiempoComun
+ * @brief Barrera de arranque y t0 compartido por un grupo de hilos periódicos
+ *
+ * Cada hilo llama a esperarInicio() una vez, al empezar su run(). Cuando
+ * llega el último participante se fija t0 = ahora + margen (para que todos
+ * tengan tiempo de despertar antes de su primer instante) y se libera a
+ * todos. arrancar() libera la barrera sin esperar a los que falten.
+ *
+ * @warning Si participantes es mayor que el número de hilos que la usan y
+ *          nadie llama a arrancar() ni detiene su ConfigHilo::parada, los
+ *          hilos no arrancan nunca y su destructor no vuelve.
+ */
+class BaseTiempoComun {
+public:
+    /**
+     * @param participantes Hilos que esperan en la barrera (> 0)
+     * @param margen_s Holgura entre la liberación y t0 [s]
+     * @throws std::invalid_argument si participantes == 0 o margen_s < 0
+     */
+    explicit BaseTiempoComun(std::size_t participantes, double margen_s = 0.002);
+
+    BaseTiempoComun(const BaseTiempoComun&) = delete;
+    BaseTiempoComun& operator=(const BaseTiempoComun&) = delete;
+
+    /**
+     * @brief Bloquea hasta que llegan todos los participantes; devuelve t0
+     *
+     * Con parada, la espera también termina al detener el token (sondeado
+     * cada 5 ms): el hilo no cuenta como llegado a efectos de los demás y
+     * recibe el instante actual, de modo que su run() sale en la primera
+     * consulta del token. Así el join de un hilo atrapado en la barrera no
+     * bloquea si otro constructor lanza antes de completarla.
+     */
+    struct timespec esperarInicio(const TokenParada* parada = nullptr);
+
+    /** @brief Libera la barrera aunque no hayan llegado todos */
+    void arrancar();
+
+    /** @brief true si t0 ya está fijado */
+    bool iniciada() const;
+
+    /** @brief t0 (CLOCK_MONOTONIC); solo válido si iniciada() */
+    struct timespec inicio() const;
+
+private:
+    void fijarInicio();   // Con mtx_ tomado
+
+    mutable std::mutex mtx_;
+    std::condition_variable cv_;
+    std::size_t participantes_;
+    std::size_t llegados_;
+    long margen_ns_;
+    bool iniciada_;
+    struct timespec t0_;
+};
+
+/**
+ * @enum EtapaLazo
+ * @brief Etapas del lazo en el orden en que deben ejecutarse dentro del periodo
+ */
+enum class EtapaLazo { Planta, AD, Referencia, Sumador, PID, DA };
+
+/**
+ * @brief Desfase recomendado de una etapa dentro del periodo de los componentes
+ *
+ * Reparte el periodo en seis ranuras iguales en el orden de EtapaLazo, de
+ * modo que un cambio de la referencia atraviesa la cadena dentro del mismo
+ * periodo en vez de esperar casi un periodo en cada salto. El PID, aunque
+ * corra a menor frecuencia, usa el mismo desfase: como su periodo es
+ * múltiplo del de los componentes, cae siempre entre el sumador y el D/A
+ * de la misma ranura.
+ *
+ * @param periodo_s Periodo de los hilos de componentes (TS_COMPONENT)
+ * @return Desfase en segundos, en [0, periodo_s)
+ */
+double faseLazo(EtapaLazo etapa, double periodo_s);
+
+/**
+ * @brief Crea el Temporizador de un hilo periódico según su ConfigHilo
+ *
+ * Sin config.base_tiempo equivale a Temporizador(frequency) (arranca ya).
+ * Con base, espera en la barrera y duerme hasta t0 + config.fase_s: la
+ * primera iteración del hilo empieza en su instante programado y las
+ * siguientes cada 1/frequency desde ahí. Una fase fuera de [0, periodo)
+ * se reduce módulo el periodo. Con config.parada las esperas del
+ * temporizador se interrumpen al detener el token.
+ */
+Temporizador crearTemporizador(double frequency, const ConfigHilo& config);
+
+} // namespace DiscreteSystems
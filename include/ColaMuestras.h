@@ -0,0 +1,78 @@
+/**
+ * @file ColaMuestras.h
+ * @brief Registrador de muestras sin locks para PoliticaHistorial::Externo
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * El bloque entrega cada (in, out, k) desde su propio hilo y otro hilo,
+ * fuera del lazo, las vacía a fichero o a la red a su ritmo:
+ *
+ * @code{.cpp}
+ * ColaMuestras cola(4096);
+ * planta.setHistorial(PoliticaHistorial::Externo, &cola);
+ * // hilo no RT
+ * Sample s;
+ * while (cola.pop(s)) out << s.k << '\t' << s.in << '\t' << s.out << '\n';
+ * @endcode
+ */
+
+#pragma once
+
+#include "DiscreteSystem.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace DiscreteSystems {
+
+/**
+ * @class ColaMuestras
+ * @brief Anillo potencia de 2, un productor (el bloque) y un consumidor
+ *
+ * registrar() nunca espera: si el consumidor no da abasto la muestra se
+ * descarta y se cuenta en descartadas().
+ */
+class ColaMuestras : public RegistradorMuestras {
+public:
+    /** @throws std::invalid_argument si capacidad no es potencia de 2 */
+    explicit ColaMuestras(std::size_t capacidad = 4096);
+
+    ColaMuestras(const ColaMuestras&) = delete;
+    ColaMuestras& operator=(const ColaMuestras&) = delete;
+
+    void registrar(const Sample& s) noexcept override {
+        std::uint64_t cola = cola_.load(std::memory_order_relaxed);
+        if (cola - cabeza_.load(std::memory_order_acquire) > mascara_) {
+            descartadas_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        muestras_[cola & mascara_] = s;
+        cola_.store(cola + 1, std::memory_order_release);
+    }
+
+    /** @brief Desencola (un único consumidor); false si está vacía */
+    bool pop(Sample& s) noexcept {
+        std::uint64_t cabeza = cabeza_.load(std::memory_order_relaxed);
+        if (cabeza == cola_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        s = muestras_[cabeza & mascara_];
+        cabeza_.store(cabeza + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** @brief Muestras descartadas por cola llena desde el inicio */
+    std::uint64_t descartadas() const { return descartadas_.load(std::memory_order_relaxed); }
+
+    std::size_t capacidad() const { return mascara_ + 1; }
+
+private:
+    std::unique_ptr<Sample[]> muestras_;
+    std::size_t mascara_;
+    alignas(64) std::atomic<std::uint64_t> cola_;     ///< Siguiente posición a escribir (bloque)
+    alignas(64) std::atomic<std::uint64_t> cabeza_;   ///< Siguiente posición a leer (consumidor)
+    std::atomic<std::uint64_t> descartadas_;
+};
+
+} // namespace DiscreteSystems
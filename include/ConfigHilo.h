@@ -0,0 +1,79 @@
+/**
+ * @file ConfigHilo.h
+ * @brief Opciones comunes y opcionales de los hilos periódicos
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Se pasa como último argumento (opcional) de los constructores de Hilo,
+ * Hilo2in, HiloPID, HiloSignal y HiloSwitch. HiloRegistrador, HiloTransmisor
+ * e HiloReceptor solo usan parada y base_tiempo. Los valores por defecto
+ * reproducen el comportamiento anterior.
+ */
+
+#pragma once
+#include "MarcaTemporal.h"
+
+namespace DiscreteSystems {
+
+class BaseTiempoComun;
+class TokenParada;
+
+/**
+ * @struct ConfigHilo
+ * @brief Opciones de un hilo periódico
+ *
+ * Marcas de propagación: si se indican, el hilo lee la marca de cada
+ * entrada junto con su valor, registra su edad en timing() (input_age,
+ * source_age) y escribe la marca de la salida propagando t_origen_ns.
+ * Los hilos sin entrada (HiloSignal, HiloSwitch) son el origen: fijan
+ * t_origen_ns al instante de escritura.
+ *
+ * @code{.cpp}
+ * ConfigHilo cfg;
+ * cfg.marca_entrada = &vars->marca_u;
+ * cfg.marca_salida = &vars->marca_ua;
+ * Hilo hiloDA(da, u, ua, running, mtx, 1000.0, "hiloDA", cfg);
+ * @endcode
+ *
+ * Contadores hardware: con contadores_hw, los hilos que ejecutan un
+ * DiscreteSystem (Hilo, Hilo2in, HiloPID) leen ciclos, instrucciones y
+ * fallos de caché/salto alrededor de next() y los acumulan por tipo de
+ * bloque en RegistroHW (ver ContadoresHW.h). Si no hay contadores
+ * disponibles no se mide nada.
+ *
+ * Coma flotante: con flush_to_zero (por defecto) el hilo activa FTZ/DAZ al
+ * arrancar, de modo que los estados que decaen hacia cero no entran en el
+ * rango subnormal. Con contar_subnormales, Hilo, Hilo2in e HiloPID cuentan
+ * los estados subnormales del bloque tras cada next() (ver EntornoFP.h).
+ *
+ * Arranque sincronizado: con base_tiempo, el hilo espera en la barrera de
+ * la base antes de su primera iteración y se ejecuta en t0 + fase_s + k·T,
+ * con t0 común a todos los hilos de la base (ver BaseTiempoComun.h).
+ *
+ * Parada: con parada, el hilo consulta el TokenParada sin locks en lugar
+ * de leer running bajo el mutex, y sus esperas terminan en cuanto se
+ * detiene el token (ver TokenParada.h).
+ *
+ * Ejecución por cambio: con por_cambio, si el bloque es sinMemoria()
+ * (DAConverter, Sumador) y todas sus entradas tienen marca, Hilo y Hilo2in
+ * omiten next() y la escritura de la salida mientras la seq de las marcas
+ * de entrada no avance desde la última evaluación; como la marca de salida
+ * tampoco avanza, el siguiente bloque sin memoria también se salta. Los
+ * bloques con estado (filtros, PID, ADConverter, que retrasa una muestra)
+ * se evalúan siempre. HiloPeriodico lo aplica con IOCanal/IOCanal2.
+ */
+struct ConfigHilo {
+    MarcaTemporal* marca_entrada = nullptr;   ///< Marca de la (primera) entrada
+    MarcaTemporal* marca_entrada2 = nullptr;  ///< Marca de la segunda entrada (Hilo2in)
+    MarcaTemporal* marca_salida = nullptr;    ///< Marca de la salida
+    bool contadores_hw = false;               ///< Medir next() con perf_event_open
+    bool flush_to_zero = true;                ///< FTZ/DAZ en el hilo (activarFlushToZero())
+    bool contar_subnormales = false;          ///< Contar estados subnormales tras next()
+    BaseTiempoComun* base_tiempo = nullptr;   ///< Barrera y t0 comunes (nullptr = arrancar ya)
+    double fase_s = 0.0;                      ///< Desfase respecto a t0, en [0, periodo) [s]
+    const TokenParada* parada = nullptr;      ///< Parada sin locks (nullptr = leer running)
+    bool por_cambio = false;                  ///< Omitir bloques sin memoria con la entrada sin cambios
+    bool contabilidad_cpu = false;            ///< CPU, cambios de contexto y fallos de página en el log
+};
+
+} // namespace DiscreteSystems
@@ -0,0 +1,164 @@
+/**
+ * @file ContadoresHW.h
+ * @brief Contadores hardware (perf_event_open) por hilo, agregados por tipo de bloque
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Capa de instrumentación opcional alrededor de DiscreteSystem::next(): lee
+ * ciclos, instrucciones, fallos de caché y fallos de predicción de saltos
+ * del hilo antes y después de cada llamada y acumula los incrementos por
+ * tipo de bloque (TransferFunctionSystem, PIDController, ...). Sirve para
+ * saber si un pico de t_ejec se debe a caché, a saltos o a la frecuencia de
+ * la CPU (GHz efectivos = ciclos / tiempo en CPU).
+ *
+ * Se activa por hilo con ConfigHilo::contadores_hw. Si el núcleo no permite
+ * abrir los contadores (perf_event_paranoid, contenedores, máquinas
+ * virtuales sin PMU) el hilo funciona igual, sin medir y sin avisar.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace DiscreteSystems {
+
+/**
+ * @struct LecturaHW
+ * @brief Valores de los contadores (absolutos o incrementos)
+ */
+struct LecturaHW {
+    std::uint64_t ciclos = 0;          ///< PERF_COUNT_HW_CPU_CYCLES
+    std::uint64_t instrucciones = 0;   ///< PERF_COUNT_HW_INSTRUCTIONS
+    std::uint64_t fallos_cache = 0;    ///< PERF_COUNT_HW_CACHE_MISSES
+    std::uint64_t fallos_salto = 0;    ///< PERF_COUNT_HW_BRANCH_MISSES
+    std::uint64_t ns_cpu = 0;          ///< Tiempo con los contadores en CPU [ns]
+};
+
+/**
+ * @class ContadoresHW
+ * @brief Grupo perf_event del hilo que lo construye (solo espacio de usuario)
+ *
+ * Los cuatro contadores forman un grupo (se planifican juntos) y se leen con
+ * una sola llamada read(). Un contador que el hardware no soporte queda a 0
+ * sin invalidar el resto; si no se puede abrir el de ciclos, disponible()
+ * es false.
+ */
+class ContadoresHW {
+public:
+    ContadoresHW();
+    ~ContadoresHW();
+    ContadoresHW(const ContadoresHW&) = delete;
+    ContadoresHW& operator=(const ContadoresHW&) = delete;
+
+    /** @brief true si el grupo se abrió (al menos el contador de ciclos) */
+    bool disponible() const { return fd_lider_ >= 0; }
+
+    /** @brief Lectura absoluta del grupo; false si no está disponible o falla */
+    bool leer(LecturaHW& lectura) const;
+
+private:
+    static constexpr int kEventos = 4;
+    int fd_lider_;
+    int fds_[kEventos];
+    int indice_[kEventos];   ///< Posición de cada evento en el read() de grupo (-1 si no abierto)
+    int abiertos_;
+};
+
+/**
+ * @struct EstadisticasHW
+ * @brief Acumulado de un hilo (un escritor, lectores concurrentes)
+ */
+struct EstadisticasHW {
+    std::string tipo;                          ///< Tipo de bloque (nombre demangled)
+    std::atomic<std::uint64_t> llamadas{0};
+    std::atomic<std::uint64_t> ciclos{0};
+    std::atomic<std::uint64_t> instrucciones{0};
+    std::atomic<std::uint64_t> fallos_cache{0};
+    std::atomic<std::uint64_t> fallos_salto{0};
+    std::atomic<std::uint64_t> ns_cpu{0};
+
+    /** @brief Suma el incremento de una llamada (solo el hilo propietario) */
+    void sumar(const LecturaHW& d);
+};
+
+/**
+ * @class RegistroHW
+ * @brief Registro global de acumulados y resumen por tipo de bloque
+ */
+class RegistroHW {
+public:
+    /** @brief Resumen agregado de un tipo de bloque */
+    struct Resumen {
+        std::string tipo;
+        std::uint64_t llamadas = 0;
+        std::uint64_t ciclos = 0;
+        std::uint64_t instrucciones = 0;
+        std::uint64_t fallos_cache = 0;
+        std::uint64_t fallos_salto = 0;
+        std::uint64_t ns_cpu = 0;
+
+        double ipc() const { return ciclos ? static_cast<double>(instrucciones) / ciclos : 0.0; }
+        double ghz() const { return ns_cpu ? static_cast<double>(ciclos) / ns_cpu : 0.0; }
+        double ciclosPorLlamada() const { return llamadas ? static_cast<double>(ciclos) / llamadas : 0.0; }
+    };
+
+    /** @brief Crea y registra el acumulado de un hilo para el tipo dado */
+    static std::shared_ptr<EstadisticasHW> registrar(const std::string& tipo);
+
+    /** @brief Suma de todos los hilos, agrupada por tipo de bloque */
+    static std::vector<Resumen> resumen();
+
+    /** @brief Resumen en JSON (lista de objetos por tipo) */
+    static std::string toJson();
+
+    /** @brief Nombre legible de un tipo (typeid demangled, sin namespace) */
+    static std::string nombreTipo(const std::type_info& tipo);
+};
+
+/**
+ * @class MedidorHW
+ * @brief Instrumentación de next() de un hilo; inactiva por defecto
+ *
+ * @code{.cpp}
+ * MedidorHW hw;
+ * if (config_.contadores_hw) hw.iniciar(typeid(*sys));   // desde el propio hilo
+ * ...
+ * hw.antes();
+ * double y = sys->next(u);
+ * hw.despues();
+ * @endcode
+ */
+class MedidorHW {
+public:
+    /**
+     * @brief Abre los contadores del hilo actual y registra el acumulado
+     * @return true si hay contadores; false (silencioso) si no
+     */
+    bool iniciar(const std::type_info& tipo);
+
+    bool activo() const { return contadores_ != nullptr; }
+
+    /** @brief Lectura previa a next() */
+    void antes() {
+        if (contadores_) valida_ = contadores_->leer(previa_);
+    }
+
+    /** @brief Lectura posterior a next() y acumulación del incremento */
+    void despues();
+
+    /** @brief Acumulado de este hilo (nullptr si inactivo) */
+    const EstadisticasHW* estadisticas() const { return stats_.get(); }
+
+private:
+    std::unique_ptr<ContadoresHW> contadores_;
+    std::shared_ptr<EstadisticasHW> stats_;
+    LecturaHW previa_;
+    bool valida_ = false;
+};
+
+} // namespace DiscreteSystems
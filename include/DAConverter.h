@@ -46,7 +46,12 @@ public:
      */
     double getLastOutput() const { return u_out_; }
 
+    /** @brief ZOH sin retardo: y(k) = u(k) */
+    bool sinMemoria() const override { return true; }
+
 protected:
+    friend class DiscreteSystem;   ///< nextDirecto<DAConverter>() llama a compute()
+
     /**
      * @brief Calcula la salida del convertidor D/A (ZOH)
      * 
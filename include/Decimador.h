@@ -0,0 +1,116 @@
+/**
+ * @file Decimador.h
+ * @brief Bloque decimador (CIC o FIR polifásico) entre dos grupos de frecuencia
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#ifndef DISCRETESYSTEMS_DECIMADOR_H
+#define DISCRETESYSTEMS_DECIMADOR_H
+
+#include "DiscreteSystem.h"
+#include "Multitasa.h"
+#include <cstdint>
+#include <vector>
+
+namespace DiscreteSystems {
+
+/**
+ * @class Decimador
+ * @brief Filtra y reduce la tasa por un factor N: una salida nueva cada N entradas
+ *
+ * Se ejecuta a la tasa de entrada (Ts = periodo de la tasa alta). En cada
+ * N-ésima entrada calcula una muestra filtrada y la mantiene en la salida
+ * hasta la siguiente, así que un consumidor a la tasa baja que lea la
+ * salida ve siempre la última medida promediada, sin aliasing:
+ *
+ * @code{.cpp}
+ * // e a 1 kHz → e_filtrada, que lee el PID a 100 Hz
+ * Decimador dec(10, FiltroMultitasa::FIR, SystemConfig::TS_COMPONENT);
+ * Hilo hiloDec(&dec, &e, &e_filtrada, &running, &mtx, 1000.0, "hiloDec");
+ * @endcode
+ *
+ * - FIR: paso bajo polifásico de L = N·taps coeficientes. En lugar de
+ *   calcular los L productos cada N entradas, cada entrada suma su
+ *   contribución a las ⌈L/N⌉ salidas pendientes que la usan: el coste es
+ *   ⌈L/N⌉ MAC en todas las muestras, sin pico en la muestra de salida.
+ * - CIC: orden integradores a la tasa alta y orden peines a la baja, en
+ *   aritmética entera (CuantificadorCIC); respuesta (sinc)^orden con
+ *   ganancia unidad en continua y retardo orden·(N−1)/2 muestras.
+ *
+ * @invariant 0 <= fase_ < factor_
+ */
+class Decimador : public DiscreteSystem {
+public:
+    /**
+     * @brief Decimador con filtro por defecto
+     * @param factor Relación de tasas N (≥ 2)
+     * @param tipo CIC o FIR (disenarPasoBajoMultitasa(factor, parametro))
+     * @param Ts Período de muestreo de la entrada (debe ser > 0)
+     * @param parametro Orden del CIC o coeficientes por fase del FIR
+     * @param bufferSize Tamaño del buffer circular (por defecto 100)
+     * @throws std::invalid_argument si factor < 2, parametro == 0 o el CIC no cabe en 64 bits
+     * @throws InvalidSamplingTime si Ts <= 0
+     */
+    Decimador(size_t factor, FiltroMultitasa tipo, double Ts,
+              size_t parametro = 3, size_t bufferSize = 100);
+
+    /**
+     * @brief Decimador FIR con coeficientes propios
+     * @param factor Relación de tasas N (≥ 2)
+     * @param h Respuesta impulsional a la tasa de entrada (no vacía)
+     * @param Ts Período de muestreo de la entrada (debe ser > 0)
+     * @param bufferSize Tamaño del buffer circular (por defecto 100)
+     * @throws std::invalid_argument si factor < 2 o h está vacío
+     * @throws InvalidSamplingTime si Ts <= 0
+     */
+    Decimador(size_t factor, const std::vector<double>& h, double Ts, size_t bufferSize = 100);
+
+    size_t getFactor() const { return factor_; }
+    FiltroMultitasa getTipo() const { return tipo_; }
+
+    /** @brief true si la última entrada cerró un grupo de N y la salida es nueva */
+    bool salidaNueva() const { return fase_ == 0 && nuevas_ > 0; }
+
+    /** @brief Salidas decimadas producidas desde el último reset */
+    std::uint64_t getSalidas() const { return nuevas_; }
+
+    /** @brief Acumuladores FIR subnormales (diagnóstico, ver EntornoFP.h) */
+    size_t contarSubnormales() const override;
+
+protected:
+    friend class DiscreteSystem;   ///< nextDirecto<Decimador>() llama a compute()
+
+    /**
+     * @brief Procesa una entrada; la salida solo cambia cada N entradas
+     * @param uk Entrada a la tasa alta
+     * @return Última salida decimada (mantenida)
+     */
+    double compute(double uk) override;
+
+    void resetState() override;
+
+private:
+    double computeFIR(double uk);
+    double computeCIC(double uk);
+
+    size_t factor_;
+    FiltroMultitasa tipo_;
+    size_t fase_;                  ///< Entradas del grupo actual ya procesadas
+    double salida_;                ///< Última salida decimada
+    std::uint64_t nuevas_;
+
+    // FIR polifásico
+    size_t K_;                     ///< Salidas pendientes por entrada: ⌈L/N⌉
+    std::vector<double> polifase_; ///< polifase_[r·K + j] = h[r + j·N] (r = distancia al final del grupo)
+    std::vector<double> acc_;      ///< acc_[j]: salida j grupos por delante (0 = la actual)
+
+    // CIC
+    std::vector<std::uint64_t> integradores_;
+    std::vector<std::uint64_t> peines_;     ///< Valor anterior de cada peine (tasa baja)
+    double ganancia_;                       ///< factor^orden
+};
+
+} // namespace DiscreteSystems
+
+#endif // DISCRETESYSTEMS_DECIMADOR_H
@@ -0,0 +1,63 @@
+/**
+ * @file Diagnostico.h
+ * @brief Mensajes de diagnóstico de los bloques (DS_DIAG), desactivados por defecto
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * @code{.cpp}
+ * Diagnostico::consola();   // los mensajes de los constructores y reset() a std::cout
+ * DS_DIAG("SOSSystem creado (secciones = " << n << ")");
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <sstream>
+#include <string>
+
+namespace DiscreteSystems {
+
+/**
+ * @class Diagnostico
+ * @brief Sumidero global de mensajes de diagnóstico
+ *
+ * emitir() serializa las llamadas con un mutex, así que el sumidero no
+ * necesita ser thread-safe. No debe llamarse desde el propio sumidero.
+ */
+class Diagnostico {
+public:
+    using Sumidero = std::function<void(const std::string&)>;
+
+    /** @brief Instala un sumidero (nullptr o vacío: sin diagnóstico) */
+    static void setSumidero(Sumidero sumidero);
+
+    /** @brief Sumidero que escribe cada mensaje en una línea de std::cout */
+    static void consola();
+
+    /** @brief true si hay sumidero instalado */
+    static bool habilitado() { return activo_.load(std::memory_order_relaxed); }
+
+    /** @brief Entrega un mensaje al sumidero (nada si no hay) */
+    static void emitir(const std::string& mensaje);
+
+private:
+    static std::atomic<bool> activo_;
+};
+
+} // namespace DiscreteSystems
+
+/**
+ * @brief Emite un mensaje con sintaxis de stream solo si el diagnóstico está habilitado
+ *
+ * Sin sumidero cuesta una carga atómica relajada: el mensaje no se formatea.
+ */
+#define DS_DIAG(expr)                                                        \
+    do {                                                                     \
+        if (::DiscreteSystems::Diagnostico::habilitado()) {                  \
+            std::ostringstream ds_diag_os_;                                  \
+            ds_diag_os_ << expr;                                             \
+            ::DiscreteSystems::Diagnostico::emitir(ds_diag_os_.str());       \
+        }                                                                    \
+    } while (0)
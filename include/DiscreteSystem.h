@@ -8,6 +8,8 @@
 #ifndef DISCRETESYSTEMS_DISCRETESYSTEM_H
 #define DISCRETESYSTEMS_DISCRETESYSTEM_H
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <iostream>
 #include <string>
@@ -21,7 +23,7 @@ namespace DiscreteSystems {
 struct Sample {
     double in;    ///< Valor de entrada u(k)
     double out;   ///< Valor de salida y(k)
-    int k;        ///< Índice temporal (paso k)
+    std::int64_t k; ///< Índice temporal (paso k)
 };
 
 /**
@@ -33,16 +35,65 @@ enum class ExportFormat {
     MATLAB    ///< Formato MATLAB con espacios y sintaxis load()
 };
 
+/**
+ * @struct BufferSnapshot
+ * @brief Vista sin copia del buffer circular, de la muestra más antigua a la más reciente
+ *
+ * El buffer circular ocupa como mucho dos tramos contiguos: first
+ * (las n_first muestras más antiguas) y second (las n_second siguientes).
+ * La vista apunta a la memoria del propio sistema: solo es coherente si
+ * DiscreteSystem::validate() devuelve true después de haberla leído.
+ */
+struct BufferSnapshot {
+    const Sample* first = nullptr;   ///< Tramo más antiguo
+    size_t n_first = 0;
+    const Sample* second = nullptr;  ///< Tramo más reciente (vacío si el buffer no ha dado la vuelta)
+    size_t n_second = 0;
+    std::uint64_t seq = 0;           ///< Número de secuencia al tomar la vista
+
+    size_t size() const { return n_first + n_second; }
+
+    /** @brief Muestra i-ésima en orden temporal (0 = más antigua) */
+    const Sample& operator[](size_t i) const {
+        return i < n_first ? first[i] : second[i - n_first];
+    }
+};
+
+/**
+ * @enum PoliticaHistorial
+ * @brief Qué hace next() con cada muestra (in, out, k)
+ */
+enum class PoliticaHistorial {
+    Ninguno,   ///< No se guarda nada: next() solo llama a compute() y avanza k
+    Anillo,    ///< Últimas bufferSize muestras en un anillo potencia de 2 (snapshot(), bufferDump())
+    Externo    ///< Cada muestra se entrega a un RegistradorMuestras
+};
+
+/**
+ * @class RegistradorMuestras
+ * @brief Destino externo del historial (PoliticaHistorial::Externo)
+ *
+ * registrar() se llama desde el hilo que ejecuta el bloque, dentro de
+ * next(): no debe bloquear ni reservar memoria (ver ColaMuestras).
+ */
+class RegistradorMuestras {
+public:
+    virtual ~RegistradorMuestras() = default;
+    virtual void registrar(const Sample& s) noexcept = 0;
+};
+
 /**
  * @class DiscreteSystem
  * @brief Clase base abstracta para sistemas discretos SISO
  * 
  * Implementa el patrón NVI (Non-Virtual Interface) para garantizar
- * que todas las muestras se almacenan correctamente en el buffer
- * circular independientemente de la implementación concreta.
+ * que todas las muestras pasan por la política de historial
+ * independientemente de la implementación concreta. El historial es
+ * opcional: con bufferSize = 0 (o setHistorial(PoliticaHistorial::Ninguno))
+ * next() no escribe nada fuera del propio bloque.
  * 
- * @invariant 0 <= count_ <= bufferSize_
- * @invariant 0 <= writeIndex_ < bufferSize_
+ * @invariant getCount() <= bufferSize_
+ * @invariant buffer_.size() es potencia de 2 >= bufferSize_ (o 0 sin anillo)
  * @invariant k_ >= 0
  */
 class DiscreteSystem {
@@ -50,7 +101,8 @@ public:
     /**
      * @brief Constructor
      * @param Ts Período de muestreo (debe ser > 0)
-     * @param bufferSize Tamaño del buffer circular (por defecto 100)
+     * @param bufferSize Muestras que conserva el anillo (por defecto 100);
+     *        0 = PoliticaHistorial::Ninguno
      * @throws InvalidSamplingTime si Ts <= 0
      */
     DiscreteSystem(double Ts, size_t bufferSize = 100);
@@ -74,6 +126,56 @@ public:
     double next(double uk);
     double next (double in1, double in2); 
 
+    /**
+     * @brief next() sin despacho virtual para un tipo de bloque conocido
+     *
+     * Llama a System::compute() con nombre cualificado, de modo que el
+     * compilador puede integrarlo en el bucle del llamante (HiloPeriodico),
+     * y guarda la muestra igual que next(). System debe ser el tipo dinámico
+     * del objeto o una base suya que no tenga compute() redefinido después.
+     *
+     * @code{.cpp}
+     * TransferFunctionSystem tf(b, a, Ts);
+     * double y = tf.nextDirecto<TransferFunctionSystem>(u);
+     * @endcode
+     */
+    template <class System>
+    double nextDirecto(double uk) {
+        double yk = static_cast<System*>(this)->System::compute(uk);
+        storeSample(uk, yk);
+        k_++;
+        return yk;
+    }
+
+    /**
+     * @brief Versión de nextDirecto() para bloques de 2 entradas (Sumador)
+     */
+    template <class System>
+    double nextDirecto(double in1, double in2) {
+        double yk = static_cast<System*>(this)->System::compute(in1, in2);
+        storeSample(in1, yk);
+        k_++;
+        return yk;
+    }
+
+    /**
+     * @brief Procesa un bloque de n muestras (método NVI)
+     *
+     * Equivale a n llamadas a next(u[i]) pero con una sola llamada virtual
+     * (computeBlock) por bloque. Solo las últimas bufferSize muestras se
+     * guardan en el buffer circular y k_ avanza n pasos.
+     *
+     * @param u Entradas u(k)..u(k+n-1)
+     * @param y Salidas y(k)..y(k+n-1) (no debe solaparse con u)
+     * @param n Número de muestras
+     */
+    void process(const double* u, double* y, size_t n);
+
+    /**
+     * @brief Versión de process() para bloques de 2 entradas (Sumador)
+     */
+    void process(const double* in1, const double* in2, double* y, size_t n);
+
     /**
      * @brief Reinicia el sistema al estado inicial
      * 
@@ -85,8 +187,49 @@ public:
      */
     void reset();
 
-    // Export del buffer (deshabilitado). Si se reactiva, documentar aquí sin @param para evitar warnings Doxygen.
-    // void bufferDump(std::ostream& os, ExportFormat format = ExportFormat::TSV) const;
+    /**
+     * @brief Vista sin copia del buffer circular (lectura desde otro hilo)
+     *
+     * El hilo que ejecuta next()/process() publica cada escritura del buffer
+     * con un contador de secuencia (seqlock): impar mientras escribe, par
+     * cuando la muestra está completa. snapshot() espera a un valor par y
+     * devuelve los dos tramos contiguos; el lector los recorre y después
+     * llama a validate(). Si validate() es false el escritor tocó el buffer
+     * mientras tanto y hay que repetir. El escritor nunca espera al lector.
+     * Sin PoliticaHistorial::Anillo la vista está vacía.
+     *
+     * @code{.cpp}
+     * std::vector<Sample> copia;
+     * BufferSnapshot s;
+     * do {
+     *     s = sys.snapshot();
+     *     copia.assign(s.first, s.first + s.n_first);
+     *     copia.insert(copia.end(), s.second, s.second + s.n_second);
+     * } while (!sys.validate(s));
+     * @endcode
+     */
+    BufferSnapshot snapshot() const;
+
+    /**
+     * @brief Comprueba que el buffer no ha cambiado desde snapshot()
+     * @return true si lo leído a través de la vista es coherente
+     */
+    bool validate(const BufferSnapshot& s) const;
+
+    /**
+     * @brief Copia coherente del buffer en orden temporal (reintenta hasta validar)
+     */
+    std::vector<Sample> snapshotCopy() const;
+
+    /**
+     * @brief Exporta el buffer circular (de la muestra más antigua a la más reciente)
+     *
+     * Se construye sobre snapshotCopy(), así que puede llamarse desde un hilo
+     * no RT mientras el bloque se ejecuta. Columnas: k, entrada, salida.
+     * TSV lleva cabecera con los nombres; MATLAB usa cabecera de comentario
+     * (%) para que el fichero cargue directamente con load().
+     */
+    void bufferDump(std::ostream& os, ExportFormat format = ExportFormat::TSV) const;
 
     /**
      * @brief Obtiene el período de muestreo
@@ -98,13 +241,46 @@ public:
      * @brief Obtiene el índice temporal actual
      * @return Paso temporal k
      */
-    int getK() const { return k_; }
+    std::int64_t getK() const { return k_; }
 
     /**
      * @brief Obtiene el número de muestras válidas en el buffer
      * @return Número de muestras almacenadas (0 <= count <= bufferSize)
      */
-    size_t getCount() const { return count_; }
+    size_t getCount() const {
+        return total_ < bufferSize_ ? static_cast<size_t>(total_) : bufferSize_;
+    }
+
+    /**
+     * @brief Cambia la política de historial y vacía el anillo
+     *
+     * No debe llamarse mientras otro hilo ejecuta next()/process().
+     *
+     * @param politica Ninguno, Anillo (requiere bufferSize > 0) o Externo
+     * @param registrador Destino de las muestras con Externo (no se adopta)
+     * @throws std::invalid_argument si Anillo sin bufferSize o Externo sin registrador
+     */
+    void setHistorial(PoliticaHistorial politica, RegistradorMuestras* registrador = nullptr);
+
+    PoliticaHistorial getHistorial() const { return politica_; }
+
+    /**
+     * @brief Número de variables de estado internas con valor subnormal
+     *
+     * Diagnóstico de ConfigHilo::contar_subnormales. Por defecto 0 (bloques
+     * sin estado que pueda decaer); los filtros lo sobrescriben.
+     */
+    virtual size_t contarSubnormales() const { return 0; }
+
+    /**
+     * @brief true si la salida depende solo de la entrada actual
+     *
+     * Un bloque sin memoria (DAConverter, Sumador) da la misma salida para
+     * la misma entrada, así que con ConfigHilo::por_cambio su hilo puede
+     * omitir next() mientras la entrada no se reescriba. Por defecto false:
+     * los bloques con estado se evalúan en cada periodo.
+     */
+    virtual bool sinMemoria() const { return false; }
 
 protected:
     /**
@@ -122,6 +298,20 @@ protected:
     //para bloques de 2 entradas, no obligatorio implementar en clases derivadas, se usa compute de 2 entradas
     virtual double compute(double in1, double in2){return 0.0;}; 
 
+    /**
+     * @brief Calcula un bloque de salidas (hook virtual de process())
+     *
+     * La implementación por defecto llama a compute(u[i]) muestra a muestra.
+     * Las clases derivadas pueden sobrescribirlo con un bucle cerrado que
+     * mantenga el estado en variables locales durante todo el bloque.
+     */
+    virtual void computeBlock(const double* u, double* y, size_t n);
+
+    /**
+     * @brief Versión de computeBlock() para bloques de 2 entradas
+     */
+    virtual void computeBlock(const double* in1, const double* in2, double* y, size_t n);
+
     /**
      * @brief Reinicia el estado interno del sistema (hook virtual)
      * 
@@ -132,24 +322,51 @@ protected:
 
 private:
     /**
-     * @brief Almacena una muestra en el buffer circular
+     * @brief Aplica la política de historial a una muestra
      * @param uk Entrada
      * @param yk Salida
      * 
-     * Implementa la lógica de buffer circular:
-     * - Si count_ < bufferSize_: almacena en writeIndex_ e incrementa count_
-     * - Si count_ == bufferSize_: sobrescribe la muestra más antigua
+     * Con Anillo escribe en buffer_[total_ & mascara_] sin módulo ni
+     * comparaciones; la muestra más antigua se sobrescribe sola.
+     */
+    inline void storeSample(double uk, double yk);
+
+    /**
+     * @brief Almacena las últimas min(n, bufferSize_) muestras de un bloque
+     * @param u Entradas del bloque
+     * @param y Salidas del bloque
+     * @param n Número de muestras del bloque
      */
-    void storeSample(double uk, double yk);
+    void storeBlock(const double* u, const double* y, size_t n);
 
     double Ts_;                      ///< Período de muestreo
-    int k_;                          ///< Índice temporal actual
-    size_t bufferSize_;              ///< Tamaño del buffer
-    size_t writeIndex_;              ///< Índice de escritura en el buffer circular
-    size_t count_;                   ///< Número de muestras válidas (0 <= count_ <= bufferSize_)
-    std::vector<Sample> buffer_;     ///< Buffer circular de muestras
+    std::int64_t k_;                 ///< Índice temporal actual (64 bits: sin desbordar en meses a 1 kHz)
+    PoliticaHistorial politica_;    ///< Qué hace storeSample()
+    RegistradorMuestras* registrador_; ///< Destino con PoliticaHistorial::Externo
+    size_t bufferSize_;              ///< Muestras que conserva el anillo
+    size_t mascara_;                 ///< buffer_.size() - 1
+    std::uint64_t total_;            ///< Muestras escritas en el anillo desde el último reset
+    std::vector<Sample> buffer_;     ///< Anillo (potencia de 2 >= bufferSize_)
+    std::atomic<std::uint64_t> seq_; ///< Secuencia del seqlock (impar = escritura en curso)
 };
 
+// Definida en la cabecera para que next() y nextDirecto() la integren
+inline void DiscreteSystem::storeSample(double uk, double yk) {
+    if (politica_ == PoliticaHistorial::Anillo) {
+        // Secuencia impar mientras la muestra está a medio escribir
+        std::uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        buffer_[total_ & mascara_] = Sample{ uk, yk, k_ };
+        ++total_;
+
+        seq_.store(seq + 2, std::memory_order_release);
+    } else if (politica_ == PoliticaHistorial::Externo) {
+        registrador_->registrar(Sample{ uk, yk, k_ });
+    }
+}
+
 } // namespace DiscreteSystems
 
 #endif // DISCRETESYSTEMS_DISCRETESYSTEM_H
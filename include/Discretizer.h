@@ -7,14 +7,16 @@
 #pragma once
 
 #include <vector>
+#include <complex>
 #include <stdexcept>
 
 namespace DiscreteSystems {
 
 /** Métodos de discretización disponibles */
 enum class DiscretizationMethod {
-    Tustin,   ///< Transformación bilineal (prewarping opcional en futuro)
-    ZOH       ///< Zero-Order Hold (no implementado aún)
+    Tustin,     ///< Transformación bilineal (prewarping opcional en futuro)
+    TustinZPK,  ///< Bilineal raíz a raíz (polos/ceros), expandida en z^-1 al final
+    ZOH         ///< Zero-Order Hold (no implementado aún)
 };
 
 /** Resultado de una discretización: coeficientes en z^-1 */
@@ -23,19 +25,142 @@ struct DiscreteTF {
     std::vector<double> a; ///< Denominador discreto (orden descendente en z^-1), a[0] = 1
 };
 
+/**
+ * @brief Función de transferencia continua en forma polo-cero-ganancia
+ *
+ * H(s) = gain * prod(s - zeros[i]) / prod(s - poles[j])
+ *
+ * Las raíces complejas deben aparecer en pares conjugados para que H(s)
+ * tenga coeficientes reales.
+ */
+struct ContinuousZPK {
+    std::vector<std::complex<double>> zeros; ///< Ceros en el plano s
+    std::vector<std::complex<double>> poles; ///< Polos en el plano s
+    double gain;                             ///< Ganancia (cociente de coeficientes principales)
+};
+
+/**
+ * @brief Función de transferencia discreta en forma polo-cero-ganancia
+ *
+ * H(z) = gain * prod(1 - zeros[i] z^-1) / prod(1 - poles[j] z^-1)
+ *
+ * Tras Tustin el número de ceros y polos coincide (los ceros en el
+ * infinito de H(s) se transforman en z = -1).
+ */
+struct DiscreteZPK {
+    std::vector<std::complex<double>> zeros; ///< Ceros en el plano z
+    std::vector<std::complex<double>> poles; ///< Polos en el plano z
+    double gain;                             ///< Ganancia en z^-1
+};
+
+/**
+ * @brief Sección bicuadrática (biquad) normalizada con a0 = 1
+ *
+ * H_i(z) = (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+ */
+struct SecondOrderSection {
+    double b0, b1, b2; ///< Numerador de la sección
+    double a1, a2;     ///< Denominador de la sección (a0 = 1 implícito)
+};
+
 /**
  * @brief Discretiza una función de transferencia continua B(s)/A(s)
  *
  * @param num_s Coeficientes de B(s) en orden descendente
  * @param den_s Coeficientes de A(s) en orden descendente (A[0] != 0)
  * @param Ts    Período de muestreo en segundos
- * @param method Método de discretización (solo Tustin implementado)
+ * @param method Método de discretización (Tustin o TustinZPK)
  * @return DiscreteTF coeficientes discretos en z^-1
  * @throws std::invalid_argument si Ts <= 0 o denominador inválido
+ *
+ * @note Tustin expande (1-x)^p (1+x)^(N-p) en forma monomial; TustinZPK
+ *       calcula las raíces de A(s) y B(s), transforma cada una por
+ *       separado y solo expande al final en z^-1. Ambos dan coeficientes
+ *       correctos al redondeo de double, pero a partir de ~8º orden con Ts
+ *       pequeño la propia forma directa está mal condicionada (polos
+ *       agrupados cerca de z = 1): ganancia DC y simulación con
+ *       TransferFunctionSystem dejan de ser fiables con cualquiera de los
+ *       dos. En órdenes altos solo discretizeSOS()/SOSSystem es preciso.
  */
 DiscreteTF discretizeTF(const std::vector<double>& num_s,
                         const std::vector<double>& den_s,
                         double Ts,
                         DiscretizationMethod method = DiscretizationMethod::Tustin);
 
+/**
+ * @brief Calcula todas las raíces (complejas) de un polinomio real
+ *
+ * Método de Aberth-Ehrlich con pulido final de Newton. Las raíces
+ * casi reales se proyectan sobre el eje real y los pares conjugados
+ * se simetrizan.
+ *
+ * @param coeffs Coeficientes en orden descendente (coeffs[0] != 0)
+ * @return Vector con coeffs.size()-1 raíces
+ * @throws std::invalid_argument si coeffs está vacío o coeffs[0] == 0
+ */
+std::vector<std::complex<double>> polyRoots(const std::vector<double>& coeffs);
+
+/**
+ * @brief Convierte B(s)/A(s) en forma polo-cero-ganancia
+ *
+ * Ignora ceros a la izquierda en el numerador (orden efectivo menor).
+ *
+ * @param num_s Coeficientes de B(s) en orden descendente
+ * @param den_s Coeficientes de A(s) en orden descendente (A[0] != 0)
+ * @return ContinuousZPK equivalente
+ * @throws std::invalid_argument si el denominador es inválido o el sistema es impropio
+ */
+ContinuousZPK tf2zpk(const std::vector<double>& num_s,
+                     const std::vector<double>& den_s);
+
+/**
+ * @brief Transformación bilineal raíz a raíz: z = (K + r) / (K - r), K = 2/Ts
+ *
+ * Cada polo y cada cero se transforma de forma individual, por lo que no
+ * aparecen potencias de K. Los (n - m) ceros en el infinito pasan a z = -1.
+ *
+ * @param zpk Sistema continuo en forma polo-cero-ganancia (propio)
+ * @param Ts  Período de muestreo en segundos
+ * @return DiscreteZPK con tantos ceros como polos
+ * @throws std::invalid_argument si Ts <= 0, el sistema es impropio o
+ *         alguna raíz coincide con s = K (singularidad de Tustin)
+ */
+DiscreteZPK bilinearZPK(const ContinuousZPK& zpk, double Ts);
+
+/**
+ * @brief Expande una forma polo-cero discreta a coeficientes en z^-1
+ *
+ * @param zpk Sistema discreto en forma polo-cero-ganancia
+ * @return DiscreteTF normalizado con a[0] = 1
+ */
+DiscreteTF zpkToTF(const DiscreteZPK& zpk);
+
+/**
+ * @brief Agrupa polos y ceros en secciones de segundo orden (biquads)
+ *
+ * Empareja pares conjugados (o dos raíces reales) y asigna a cada par de
+ * polos el par de ceros más cercano. Las secciones se ordenan de menor a
+ * mayor |polo| (la más resonante al final) y la ganancia se aplica en la
+ * primera sección. Un orden impar produce una última sección de 1er orden
+ * (b2 = a2 = 0).
+ *
+ * @param zpk Sistema discreto en forma polo-cero-ganancia
+ * @return Secciones en el orden de ejecución de la cascada
+ */
+std::vector<SecondOrderSection> zpkToSOS(const DiscreteZPK& zpk);
+
+/**
+ * @brief Discretiza B(s)/A(s) con Tustin directamente en secciones de 2º orden
+ *
+ * Equivale a zpkToSOS(bilinearZPK(tf2zpk(num_s, den_s), Ts)).
+ *
+ * @param num_s Coeficientes de B(s) en orden descendente
+ * @param den_s Coeficientes de A(s) en orden descendente (A[0] != 0)
+ * @param Ts    Período de muestreo en segundos
+ * @return Secciones listas para SOSSystem
+ */
+std::vector<SecondOrderSection> discretizeSOS(const std::vector<double>& num_s,
+                                              const std::vector<double>& den_s,
+                                              double Ts);
+
 } // namespace DiscreteSystems
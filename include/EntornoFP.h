@@ -0,0 +1,68 @@
+/**
+ * @file EntornoFP.h
+ * @brief Entorno de coma flotante de los hilos RT (FTZ/DAZ) y recuento de subnormales
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * @code{.cpp}
+ * activarFlushToZero();   // al arrancar run(); ConfigHilo::flush_to_zero lo hace por defecto
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace DiscreteSystems {
+
+/**
+ * @brief Activa FTZ y DAZ en el hilo actual (x86 SSE: MXCSR; AArch64: FPCR.FZ)
+ *
+ * Los resultados y operandos subnormales pasan a cero, así que un filtro
+ * que decae con la entrada en reposo no cae en la ruta lenta de la FPU.
+ * El registro de control es por hilo: no afecta al resto del proceso.
+ * @return false si la arquitectura no lo permite (el entorno no cambia)
+ */
+bool activarFlushToZero();
+
+/** @brief true si el hilo actual tiene FTZ activo */
+bool flushToZeroActivo();
+
+/** @brief Número de valores subnormales en [v, v + n) */
+inline std::size_t contarSubnormales(const double* v, std::size_t n) {
+    std::size_t c = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        c += std::fpclassify(v[i]) == FP_SUBNORMAL;
+    }
+    return c;
+}
+
+/**
+ * @struct ContadorSubnormales
+ * @brief Acumulado de un hilo (un escritor, lectores concurrentes)
+ *
+ * Lo alimenta ConfigHilo::contar_subnormales con
+ * DiscreteSystem::contarSubnormales() tras cada next().
+ */
+struct ContadorSubnormales {
+    std::atomic<std::uint64_t> iteraciones{0};            ///< Iteraciones inspeccionadas
+    std::atomic<std::uint64_t> iteraciones_afectadas{0};  ///< Con algún estado subnormal
+    std::atomic<std::uint64_t> estados_subnormales{0};    ///< Suma de estados subnormales
+
+    /** @brief Registra el recuento de una iteración (solo el hilo propietario) */
+    void registrar(std::size_t subnormales) {
+        auto add = [](std::atomic<std::uint64_t>& a, std::uint64_t v) {
+            a.store(a.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+        };
+        add(iteraciones, 1);
+        if (subnormales) {
+            add(iteraciones_afectadas, 1);
+            add(estados_subnormales, subnormales);
+        }
+    }
+};
+
+} // namespace DiscreteSystems
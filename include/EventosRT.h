@@ -0,0 +1,178 @@
+/**
+ * @file EventosRT.h
+ * @brief Avisos y errores de los hilos de tiempo real sin llamadas al sistema
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * @code{.cpp}
+ * EventosRT::iniciar();                       // hilo de vaciado → std::cerr
+ * EventosRT::reportar("hiloPID", CodigoEventoRT::PlazoPerdido, iter, t_total_ns / 1e3, periodo_ns / 1e3);
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace DiscreteSystems {
+
+/**
+ * @enum CodigoEventoRT
+ * @brief Tipo de incidencia; fija el texto y la gravedad del mensaje
+ */
+enum class CodigoEventoRT : std::uint8_t {
+    CercaPlazo,         ///< WARNING: t_total > 90 % del periodo (valor = t_total, límite = periodo) [us]
+    PlazoPerdido,       ///< CRITICAL: t_total > periodo [us]
+    MutexOcupado,       ///< ERROR: mutex ocupado más del 80 % del periodo; se salta la iteración [us]
+    ErrorMutex,         ///< ERROR: pthread_mutex_* devolvió un código inesperado (valor = código)
+    TimeoutParametros,  ///< ERROR: timedlock de los parámetros agotado [us]
+    TimeoutSalida       ///< ERROR: timedlock de la salida agotado [us]
+};
+
+/**
+ * @struct EventoRT
+ * @brief Una incidencia; trivialmente copiable para poder copiarse en la cola
+ */
+struct EventoRT {
+    std::int64_t t_ns = 0;        ///< CLOCK_MONOTONIC [ns]
+    std::uint64_t iter = 0;       ///< Iteración del hilo
+    double valor = 0.0;           ///< Magnitud medida (ver CodigoEventoRT)
+    double limite = 0.0;          ///< Umbral superado
+    CodigoEventoRT codigo = CodigoEventoRT::CercaPlazo;
+    char origen[23] = {};         ///< Nombre del hilo (truncado)
+};
+
+/**
+ * @class ColaEventosRT
+ * @brief Cola acotada sin locks, varios productores y un consumidor
+ *
+ * Anillo de celdas con número de secuencia (esquema de D. Vyukov): push()
+ * reserva una posición con un CAS y publica la celda con un store release;
+ * si la cola está llena devuelve false sin esperar. Cada celda ocupa una
+ * línea de caché, así que dos productores no escriben en la misma línea.
+ */
+class ColaEventosRT {
+public:
+    /** @throws std::invalid_argument si capacidad no es potencia de 2 */
+    explicit ColaEventosRT(std::size_t capacidad = 1024);
+
+    ColaEventosRT(const ColaEventosRT&) = delete;
+    ColaEventosRT& operator=(const ColaEventosRT&) = delete;
+
+    /** @brief Encola sin bloquear; false (y cuenta un descarte) si está llena */
+    bool push(const EventoRT& ev) noexcept {
+        std::size_t pos = cola_.load(std::memory_order_relaxed);
+        Celda* c;
+        while (true) {
+            c = &celdas_[pos & mascara_];
+            std::size_t seq = c->seq.load(std::memory_order_acquire);
+            std::intptr_t dif = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (dif == 0) {
+                if (cola_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (dif < 0) {
+                descartados_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = cola_.load(std::memory_order_relaxed);
+            }
+        }
+        c->ev = ev;
+        c->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** @brief Desencola (un único consumidor); false si está vacía */
+    bool pop(EventoRT& ev) noexcept {
+        Celda& c = celdas_[cabeza_ & mascara_];
+        if (c.seq.load(std::memory_order_acquire) != cabeza_ + 1) {
+            return false;
+        }
+        ev = c.ev;
+        c.seq.store(cabeza_ + mascara_ + 1, std::memory_order_release);
+        ++cabeza_;
+        return true;
+    }
+
+    /** @brief Eventos descartados por cola llena desde el inicio */
+    std::uint64_t descartados() const { return descartados_.load(std::memory_order_relaxed); }
+
+    std::size_t capacidad() const { return mascara_ + 1; }
+
+private:
+    struct alignas(64) Celda {
+        std::atomic<std::size_t> seq;
+        EventoRT ev;
+    };
+
+    std::unique_ptr<Celda[]> celdas_;
+    std::size_t mascara_;
+    alignas(64) std::atomic<std::size_t> cola_;   ///< Siguiente posición a reservar (productores)
+    alignas(64) std::size_t cabeza_;              ///< Siguiente posición a leer (consumidor)
+    std::atomic<std::uint64_t> descartados_;
+};
+
+/**
+ * @class EventosRT
+ * @brief Cola global de incidencias y su hilo de vaciado (no RT)
+ *
+ * reportar() solo copia un EventoRT en una ColaEventosRT (sin reservas ni
+ * llamadas al sistema). El hilo de vaciado escribe en seguida la primera
+ * aparición de cada (origen, código), resume las siguientes en una línea
+ * por ventana ("[hiloPID] 42 × plazo perdido en 1 s (máx ...)") e informa
+ * de los eventos descartados por cola llena.
+ */
+class EventosRT {
+public:
+    using Sumidero = std::function<void(const std::string&)>;
+
+    /**
+     * @brief Encola una incidencia; apto para hilos de tiempo real
+     *
+     * Copia origen (truncado) y los valores en la cola global; no reserva
+     * memoria, no toma locks y no hace llamadas al sistema (salvo leer
+     * CLOCK_MONOTONIC vía vDSO); la cola global se construye durante la
+     * inicialización estática del programa. Sin hilo de vaciado (iniciar(),
+     * que HiloPID llama en su constructor) los eventos se acumulan hasta
+     * llenar la cola y después se descartan.
+     */
+    static void reportar(const char* origen, CodigoEventoRT codigo, std::uint64_t iter,
+                         double valor, double limite) noexcept;
+
+    /**
+     * @brief Arranca el hilo de vaciado si no está en marcha (idempotente)
+     * @param ventana_s Ventana de agregación [s]
+     */
+    static void iniciar(double ventana_s = 1.0);
+
+    /** @brief Vacía lo pendiente, emite los resúmenes y para el hilo de vaciado */
+    static void detener();
+
+    /**
+     * @brief Procesa ya todo lo encolado y cierra la ventana actual
+     *
+     * Lo llama el hilo de vaciado al final de cada ventana; desde fuera
+     * sirve para tests o para un vaciado manual sin hilo.
+     */
+    static void vaciar();
+
+    /** @brief Destino de las líneas (por defecto std::cerr; nullptr restaura el defecto) */
+    static void setSumidero(Sumidero sumidero);
+
+    /** @brief Eventos descartados por cola llena */
+    static std::uint64_t descartados();
+
+    /** @brief Texto de un código ("plazo perdido", ...) */
+    static const char* descripcion(CodigoEventoRT codigo);
+
+    /** @brief Gravedad de un código ("WARNING", "CRITICAL" o "ERROR") */
+    static const char* gravedad(CodigoEventoRT codigo);
+};
+
+} // namespace DiscreteSystems
@@ -19,6 +19,9 @@
 #include <string>
 #include "DiscreteSystem.h"
 #include "RuntimeLogger.h"
+#include "TimingStats.h"
+#include "ConfigHilo.h"
+#include "EntornoFP.h"
 
 // Variable de control global para manejo de señales SIGINT/SIGTERM
 extern volatile sig_atomic_t g_signal_run;
@@ -74,6 +77,8 @@ public:
      * @param running Smart pointer a variable booleana de control
      * @param mtx Smart pointer al mutex que protege variables compartidas
      * @param frequency Frecuencia de ejecución en Hz
+     * @param log_prefix Prefijo para archivos de log
+     * @param config Opciones opcionales (marcas de propagación, ver ConfigHilo)
      * 
      * @note Esta es la interfaz recomendada para nuevo código
      */
@@ -83,7 +88,8 @@ public:
          bool* running,
          std::shared_ptr<pthread_mutex_t> mtx, 
          double frequency,
-             const std::string& log_prefix);
+             const std::string& log_prefix,
+             const ConfigHilo& config = ConfigHilo());
 
     /**
      * @brief Constructor con punteros crudos (compatibilidad)
@@ -95,10 +101,13 @@ public:
      * @param running Puntero a variable booleana de control
      * @param mtx Puntero al mutex que protege variables compartidas
      * @param frequency Frecuencia de ejecución en Hz
+     * @param log_prefix Prefijo para archivos de log
+     * @param config Opciones opcionales (marcas de propagación, ver ConfigHilo)
      */
             Hilo(DiscreteSystem* system, double* input, double* output, bool *running, 
                 pthread_mutex_t* mtx, double frequency,
-             const std::string& log_prefix);
+             const std::string& log_prefix,
+             const ConfigHilo& config = ConfigHilo());
 
     /**
      * @brief Obtiene el identificador del hilo pthread
@@ -106,6 +115,24 @@ public:
      */
     pthread_t getThread() const { return thread_; }
 
+    /**
+     * @brief Estadísticas de temporización del hilo (latencia de despertar,
+     *        drift y t_total); se pueden leer mientras el hilo se ejecuta
+     */
+    const HiloTiming& timing() const { return timing_; }
+
+    /**
+     * @brief Estados subnormales del bloque tras cada next()
+     *        (solo con ConfigHilo::contar_subnormales)
+     */
+    const ContadorSubnormales& subnormales() const { return subnormales_; }
+
+    /**
+     * @brief Iteraciones en que se omitió next() por no cambiar la entrada
+     *        (solo con ConfigHilo::por_cambio y bloque sinMemoria())
+     */
+    std::uint64_t getOmitidas() const { return omitidas_.load(std::memory_order_relaxed); }
+
     /**
      * @brief Destructor que espera a que termine el hilo
      */
@@ -129,8 +156,12 @@ private:
     pthread_t thread_;
     double frequency_;
     RuntimeLogger logger_;
+    HiloTiming timing_;
+    ContadorSubnormales subnormales_;
+    std::atomic<std::uint64_t> omitidas_{0};
+    ConfigHilo config_;
     struct timespec t_prev_iteration_;
-    int iterations_;
+    std::uint64_t iterations_;
 
     static void* threadFunc(void* arg);
     void run();
@@ -19,6 +19,9 @@
 #include <string>
 #include "DiscreteSystem.h"
 #include "RuntimeLogger.h"
+#include "TimingStats.h"
+#include "ConfigHilo.h"
+#include "EntornoFP.h"
 
 // Variable de control global para manejo de señales
 extern volatile sig_atomic_t g_signal_run;
@@ -59,6 +62,7 @@ public:
      * @param mtx Smart pointer al mutex POSIX compartido
      * @param frequency Frecuencia de ejecución en Hz
      * @param log_prefix Prefijo para archivos de log (ej: "Sumador")
+     * @param config Opciones opcionales (marcas de propagación, ver ConfigHilo)
      */
     Hilo2in(std::shared_ptr<DiscreteSystem> system, 
             std::shared_ptr<double> input1, 
@@ -67,7 +71,8 @@ public:
              bool* running,
             std::shared_ptr<pthread_mutex_t> mtx, 
             double frequency,
-            const std::string& log_prefix);
+            const std::string& log_prefix,
+            const ConfigHilo& config = ConfigHilo());
     
     /**
      * @brief Constructor con punteros crudos (compatibilidad)
@@ -80,16 +85,36 @@ public:
      * @param mtx Puntero al mutex que protege las variables compartidas
      * @param frequency Frecuencia de ejecución en Hz (período = 1/frequency)
      * @param log_prefix Prefijo para archivos de log
+     * @param config Opciones opcionales (marcas de propagación, ver ConfigHilo)
      */
     Hilo2in(DiscreteSystem* system, double* input1, double* input2, double* output, 
                  bool *running, pthread_mutex_t* mtx, double frequency,
-                 const std::string& log_prefix);
+                 const std::string& log_prefix,
+                 const ConfigHilo& config = ConfigHilo());
     /**
      * @brief Obtiene el identificador del hilo pthread
      * @return pthread_t ID del hilo
      */
     pthread_t getThread() const { return thread_; }
 
+    /**
+     * @brief Estadísticas de temporización del hilo (latencia de despertar,
+     *        drift y t_total); se pueden leer mientras el hilo se ejecuta
+     */
+    const HiloTiming& timing() const { return timing_; }
+
+    /**
+     * @brief Estados subnormales del bloque tras cada next()
+     *        (solo con ConfigHilo::contar_subnormales)
+     */
+    const ContadorSubnormales& subnormales() const { return subnormales_; }
+
+    /**
+     * @brief Iteraciones en que se omitió next() por no cambiar ninguna entrada
+     *        (solo con ConfigHilo::por_cambio y bloque sinMemoria())
+     */
+    std::uint64_t getOmitidas() const { return omitidas_.load(std::memory_order_relaxed); }
+
     /**
      * @brief Destructor que espera a que termine el hilo
      * 
@@ -120,8 +145,12 @@ private:
     
     // RuntimeLogger para diagnóstico
     RuntimeLogger logger_;
-    double t_prev_iteration_;
-    size_t iterations_;
+    HiloTiming timing_;
+    ContadorSubnormales subnormales_;
+    std::atomic<std::uint64_t> omitidas_{0};
+    ConfigHilo config_;
+    struct timespec t_prev_iteration_;
+    std::uint64_t iterations_;
 
     /**
      * @brief Función estática de punto de entrada del hilo
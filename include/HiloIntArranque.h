@@ -7,6 +7,17 @@
 #include "InterruptorArranque.h"
 #include "RuntimeLogger.h"
 
+/**
+ * @class HiloIntArranque
+ * @brief Propaga la parada (SIGINT/SIGTERM o InterruptorArranque::setRun(0)) a running
+ *
+ * Al construirse pone running a true si el interruptor está en marcha
+ * (getRun() != 0). Después duerme sobre DiscreteSystems::TokenParada::proceso()
+ * sin sondear; al detenerse el token pone running a false bajo el mutex y
+ * termina. Un setRun(1) posterior no vuelve a poner running a true. Los
+ * hilos configurados con ConfigHilo::parada = &TokenParada::proceso() ya
+ * han salido para entonces.
+ */
 class HiloIntArranque {
 private:
     // Smart pointers
@@ -23,14 +34,16 @@ private:
     double frequency_;
     DiscreteSystems::RuntimeLogger logger_;
     struct timespec t_prev_iteration_;
-    int iterations_;
+    std::uint64_t iterations_;
     
     void run();
+    void publicarArranque();
     static void* threadFunc(void* arg);
 
 public:
     /**
      * @brief Constructor con smart pointers (recomendado)
+     * @param frequency Solo se usa como periodo nominal en el registro
      */
     HiloIntArranque(std::shared_ptr<InterruptorArranque> interruptor, 
                     bool* running,
@@ -21,6 +21,9 @@
 #include "VariablesCompartidas.h"
 #include "ParametrosCompartidos.h"
 #include "RuntimeLogger.h"
+#include "TimingStats.h"
+#include "ConfigHilo.h"
+#include "EntornoFP.h"
 
 // Variable de control global para manejo de señales
 extern volatile sig_atomic_t g_signal_run;
@@ -51,6 +54,9 @@ namespace DiscreteSystems {
  * vars.running = false; // Detiene el hilo
  * @endcode
  * 
+ * Marcas de propagación: lee vars.marca_e junto con e (registra su edad en
+ * timing()) y escribe vars.marca_u con el mismo origen al publicar u.
+ * 
  * @invariant El hilo lee parámetros dentro de secciones protegidas por params->mtx
  * @invariant frequency_ > 0 (Hz)
  */
@@ -58,13 +64,29 @@ class HiloPID {
 public:
     /**
      * @brief Constructor
+     * @param config Opciones opcionales (contadores hardware; las marcas de
+     *        propagación salen siempre de vars)
      */
         HiloPID(DiscreteSystem* pid, VariablesCompartidas* vars, 
             ParametrosCompartidos* params, double frequency,
-            const std::string& log_prefix);
+            const std::string& log_prefix,
+            const ConfigHilo& config = ConfigHilo());
 
     pthread_t getThread() const { return thread_; }
-    int getIterations() const { return iterations_; }  // Obtener número de iteración actual
+
+    /**
+     * @brief Estadísticas de temporización del hilo (latencia de despertar,
+     *        drift y t_total); se pueden leer mientras el hilo se ejecuta
+     */
+    const HiloTiming& timing() const { return timing_; }
+
+    /**
+     * @brief Estados subnormales del bloque tras cada next()
+     *        (solo con ConfigHilo::contar_subnormales)
+     */
+    const ContadorSubnormales& subnormales() const { return subnormales_; }
+
+    std::uint64_t getIterations() const { return iterations_; }  // Obtener número de iteración actual
 
     ~HiloPID();
 
@@ -75,9 +97,12 @@ private:
 
     double frequency_;
     pthread_t thread_;
-    int iterations_;           // Contador de iteraciones
+    std::uint64_t iterations_; // Contador de iteraciones
     struct timespec t_prev_iteration_;  // Timestamp de la iteración anterior
     RuntimeLogger logger_;      // Sistema de logging con buffer circular
+    HiloTiming timing_;
+    ContadorSubnormales subnormales_;
+    ConfigHilo config_;
 
     static void* threadFunc(void* arg);
     void run();
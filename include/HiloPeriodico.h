@@ -0,0 +1,318 @@
+/**
+ * @file HiloPeriodico.h
+ * @brief Hilo periódico plantilla: bloque concreto y política de E/S en compilación
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Hilo guarda un DiscreteSystem* y llama al next() virtual (que a su vez
+ * llama al compute() virtual) y en cada iteración elige entre punteros
+ * inteligentes y crudos para entrada, salida y mutex. HiloPeriodico fija
+ * todo eso en tiempo de compilación: el tipo del bloque (System) y cómo se
+ * leen y escriben las variables (PoliticaIO). La iteración completa
+ * (lectura, compute(), buffer circular, escritura) queda en una sola
+ * función sin llamadas indirectas.
+ *
+ * Hilo sigue disponible sin cambios con todas sus opciones (RuntimeLogger,
+ * marcas temporales, contadores hardware). HiloPeriodico registra solo
+ * timing() y la traza, y aplica ConfigHilo::flush_to_zero, base_tiempo,
+ * parada y por_cambio (este último con IOCanal/IOCanal2).
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <atomic>
+#include <ctime>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ConfigHilo.h"
+#include "DiscreteSystem.h"
+#include "EntornoFP.h"
+#include "BaseTiempoComun.h"
+#include "Temporizador.h"
+#include "TokenParada.h"
+#include "TimingStats.h"
+#include "Tracer.h"
+#include "VariablesLazoAlineadas.h"
+
+namespace DiscreteSystems {
+
+/**
+ * @struct IOMutex
+ * @brief Política de E/S equivalente a Hilo: variables double protegidas por un mutex
+ */
+struct IOMutex {
+    const double* entrada;
+    double* salida;
+    const bool* running;
+    pthread_mutex_t* mtx;
+
+    /** @brief Lee la entrada; false si hay que terminar */
+    bool leer(double& u) const {
+        pthread_mutex_lock(mtx);
+        bool r = *running;
+        u = *entrada;
+        pthread_mutex_unlock(mtx);
+        return r;
+    }
+
+    void escribir(double y) const {
+        pthread_mutex_lock(mtx);
+        *salida = y;
+        pthread_mutex_unlock(mtx);
+    }
+};
+
+/**
+ * @struct IOAtomico
+ * @brief Política de E/S sin locks: variables std::atomic (un escritor por variable)
+ */
+struct IOAtomico {
+    const std::atomic<double>* entrada;
+    std::atomic<double>* salida;
+    const std::atomic<bool>* running;
+
+    bool leer(double& u) const {
+        u = entrada->load(std::memory_order_acquire);
+        return running->load(std::memory_order_relaxed);
+    }
+
+    void escribir(double y) const {
+        salida->store(y, std::memory_order_release);
+    }
+};
+
+/**
+ * @struct IOCanal
+ * @brief Política de E/S sobre canales con seqlock (VariablesLazoAlineadas)
+ *
+ * Lee valor y marca de la entrada en la misma línea de caché y publica la
+ * salida propagando t_origen_ns, como hacen las marcas de ConfigHilo en Hilo.
+ *
+ * @tparam Canal CanalLazo (una línea por canal) o CanalLazoEmpaquetado
+ */
+template <class Canal>
+struct IOCanal {
+    const Canal* entrada;
+    Canal* salida;
+    const std::atomic<bool>* running;
+    std::int64_t origen_ns = 0;   ///< Origen de la última entrada leída
+    std::uint64_t seq_entrada = 0; ///< Generación de la última entrada leída (ConfigHilo::por_cambio)
+
+    bool leer(double& u) {
+        MarcaTemporal m;
+        entrada->leer(u, m);
+        origen_ns = m.t_origen_ns;
+        seq_entrada = m.seq;
+        return running->load(std::memory_order_relaxed);
+    }
+
+    void escribir(double y) {
+        salida->publicar(y, origen_ns, MarcaTemporal::ahoraNs());
+    }
+};
+
+/**
+ * @struct IOCanal2
+ * @brief IOCanal para bloques de 2 entradas (Sumador); el origen es el de la primera
+ */
+template <class Canal>
+struct IOCanal2 {
+    const Canal* entrada1;
+    const Canal* entrada2;
+    Canal* salida;
+    const std::atomic<bool>* running;
+    std::int64_t origen_ns = 0;
+    std::uint64_t seq_entrada = 0;   ///< Suma de las generaciones: avanza si cambia cualquiera
+
+    bool leer(double& in1, double& in2) {
+        MarcaTemporal m1, m2;
+        entrada1->leer(in1, m1);
+        entrada2->leer(in2, m2);
+        origen_ns = m1.t_origen_ns;
+        seq_entrada = m1.seq + m2.seq;
+        return running->load(std::memory_order_relaxed);
+    }
+
+    void escribir(double y) {
+        salida->publicar(y, origen_ns, MarcaTemporal::ahoraNs());
+    }
+};
+
+/// true si la política lee dos entradas: bool leer(double&, double&)
+template <class P, class = void>
+struct PoliticaDosEntradas : std::false_type {};
+
+template <class P>
+struct PoliticaDosEntradas<P, std::void_t<decltype(std::declval<P&>().leer(
+    std::declval<double&>(), std::declval<double&>()))>> : std::true_type {};
+
+/// true si la política expone la generación de su entrada: std::uint64_t seq_entrada
+template <class P, class = void>
+struct PoliticaConSecuencia : std::false_type {};
+
+template <class P>
+struct PoliticaConSecuencia<P, std::void_t<decltype(std::declval<const P&>().seq_entrada)>>
+    : std::true_type {};
+
+/**
+ * @class HiloPeriodico
+ * @brief Ejecuta System::compute() a frecuencia fija sin despacho virtual
+ *
+ * @tparam System Tipo concreto del bloque (TransferFunctionSystem, PIDController, ...)
+ * @tparam PoliticaIO IOMutex, IOAtomico, IOCanal o cualquier tipo con
+ *         bool leer(double&) y void escribir(double). Con
+ *         bool leer(double&, double&) (IOCanal2) se llama a la versión de
+ *         2 entradas de System::compute()
+ *
+ * @code{.cpp}
+ * auto planta = std::make_shared<TransferFunctionSystem>(b, a, Ts);
+ * HiloPeriodico<TransferFunctionSystem> hiloPlanta(planta, IOMutex{&vars.ua, &vars.yk, &running, &mtx}, 1000.0);
+ *
+ * std::atomic<double> u{0.0}, y{0.0};
+ * std::atomic<bool> run{true};
+ * HiloPeriodico<PIDController, IOAtomico> hiloPID(pid, IOAtomico{&u, &y, &run}, 1000.0);
+ *
+ * VariablesLazoAlineadas va;
+ * HiloPeriodico<Sumador, IOCanal2<CanalLazo>> hiloSum(sum, {&va.ref, &va.ykd, &va.e, &va.running}, 1000.0);
+ * @endcode
+ *
+ * @invariant frequency_ > 0 (Hz)
+ */
+template <class System, class PoliticaIO = IOMutex>
+class HiloPeriodico {
+    static_assert(std::is_base_of<DiscreteSystem, System>::value,
+                  "HiloPeriodico: System debe derivar de DiscreteSystem");
+
+public:
+    /**
+     * @param system Bloque a ejecutar (su tipo dinámico debe ser System)
+     * @param io Política de E/S ya configurada
+     * @param frequency Frecuencia de ejecución en Hz
+     * @param config Opciones del hilo (flush_to_zero, base_tiempo/fase_s, parada y por_cambio)
+     * @throws std::invalid_argument si system es nulo o frequency <= 0
+     * @throws std::runtime_error si pthread_create falla
+     */
+    HiloPeriodico(std::shared_ptr<System> system, PoliticaIO io, double frequency,
+                  const ConfigHilo& config = ConfigHilo())
+        : system_(std::move(system)), io_(io), frequency_(frequency), config_(config), iterations_(0)
+    {
+        if (!system_ || frequency_ <= 0.0) {
+            throw std::invalid_argument("HiloPeriodico: argumentos inválidos");
+        }
+        int ret = pthread_create(&thread_, nullptr, &HiloPeriodico::threadFunc, this);
+        if (ret != 0) {
+            std::cerr << "[HiloPeriodico] Error: pthread_create falló con código " << ret << std::endl;
+            throw std::runtime_error("HiloPeriodico - pthread_create falló");
+        }
+    }
+
+    /** @brief Espera la terminación del hilo */
+    ~HiloPeriodico() {
+        int ret = pthread_join(thread_, nullptr);
+        if (ret != 0) {
+            std::cerr << "[HiloPeriodico] Error: pthread_join falló con código " << ret << std::endl;
+        }
+    }
+
+    HiloPeriodico(const HiloPeriodico&) = delete;
+    HiloPeriodico& operator=(const HiloPeriodico&) = delete;
+
+    pthread_t getThread() const { return thread_; }
+
+    /** @brief Estadísticas de temporización (legibles mientras el hilo se ejecuta) */
+    const HiloTiming& timing() const { return timing_; }
+
+    /** @brief Iteraciones completadas */
+    std::uint64_t getIterations() const { return iterations_.load(std::memory_order_relaxed); }
+
+    /** @brief Iteraciones sin next() por no cambiar la entrada (ConfigHilo::por_cambio) */
+    std::uint64_t getOmitidas() const { return omitidas_.load(std::memory_order_relaxed); }
+
+private:
+    static void* threadFunc(void* arg) {
+        static_cast<HiloPeriodico*>(arg)->run();
+        return nullptr;
+    }
+
+    void run() {
+        if (config_.flush_to_zero) {
+            activarFlushToZero();
+        }
+        Temporizador timer = crearTemporizador(frequency_, config_);
+        const std::int64_t periodo_ns = timer.periodoNs();
+        System& sys = *system_;
+        struct timespec t_prev;
+        clock_gettime(CLOCK_MONOTONIC, &t_prev);
+        std::uint64_t n = 0;
+
+        // Ejecución por cambio: bloque sin memoria y política con seq_entrada
+        const bool por_cambio = config_.por_cambio && PoliticaConSecuencia<PoliticaIO>::value &&
+                                sys.System::sinMemoria();
+        std::uint64_t seq_evaluada = std::numeric_limits<std::uint64_t>::max();
+
+        while (true) {
+            struct timespec t0;
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+
+            if (config_.parada && config_.parada->detenido()) {
+                break;
+            }
+            double in1, in2 = 0.0;
+            bool sigue;
+            if constexpr (PoliticaDosEntradas<PoliticaIO>::value) {
+                sigue = io_.leer(in1, in2);
+            } else {
+                sigue = io_.leer(in1);
+            }
+            if (!sigue) {
+                break;
+            }
+            if (por_cambio && secuenciaEntrada() == seq_evaluada) {
+                omitidas_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                double y;
+                if constexpr (PoliticaDosEntradas<PoliticaIO>::value) {
+                    y = sys.template nextDirecto<System>(in1, in2);
+                } else {
+                    y = sys.template nextDirecto<System>(in1);
+                }
+                io_.escribir(y);
+                seq_evaluada = secuenciaEntrada();
+            }
+
+            struct timespec t1;
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            timing_.record(timer.objetivo(), t0, difNs(t0, t_prev), periodo_ns, difNs(t1, t0), n == 0);
+            t_prev = t0;
+            DS_TRACE_COMPLETE("iteracion", t0, t1);
+            iterations_.store(++n, std::memory_order_relaxed);
+
+            timer.esperar();
+        }
+    }
+
+    std::uint64_t secuenciaEntrada() const {
+        if constexpr (PoliticaConSecuencia<PoliticaIO>::value) {
+            return io_.seq_entrada;
+        } else {
+            return 0;
+        }
+    }
+
+    std::shared_ptr<System> system_;
+    PoliticaIO io_;
+    double frequency_;
+    ConfigHilo config_;
+    HiloTiming timing_;
+    std::atomic<std::uint64_t> iterations_;
+    std::atomic<std::uint64_t> omitidas_{0};
+    pthread_t thread_;
+};
+
+} // namespace DiscreteSystems
@@ -17,6 +17,7 @@
 #include <memory>
 #include <atomic>
 #include "Receptor.h"
+#include "ConfigHilo.h"
 
 // Variable de control global para manejo de señales
 extern volatile sig_atomic_t g_signal_run;
@@ -69,11 +70,13 @@ public:
      * @param running Smart pointer a variable booleana de control
      * @param mtx Smart pointer al mutex POSIX compartido
      * @param frequency Frecuencia de recepción en Hz
+     * @param config Opciones opcionales (token de parada, ver ConfigHilo)
      */
     HiloReceptor(std::shared_ptr<Receptor> receptor, 
                  bool* running,
                  std::shared_ptr<pthread_mutex_t> mtx, 
-                 double frequency);
+                 double frequency,
+                 const DiscreteSystems::ConfigHilo& config = DiscreteSystems::ConfigHilo());
     
     /**
      * @brief Constructor con punteros crudos (compatibilidad)
@@ -83,9 +86,11 @@ public:
      * @param running Puntero a variable booleana de control
      * @param mtx Puntero al mutex POSIX compartido
      * @param frequency Frecuencia de recepción en Hz
+     * @param config Opciones opcionales (token de parada, ver ConfigHilo)
      */
     HiloReceptor(Receptor* receptor, bool* running, 
-                 pthread_mutex_t* mtx, double frequency);
+                 pthread_mutex_t* mtx, double frequency,
+                 const DiscreteSystems::ConfigHilo& config = DiscreteSystems::ConfigHilo());
     
     /**
      * @brief Destructor que espera terminación del hilo
@@ -110,7 +115,7 @@ private:
      * @brief Loop principal del hilo
      * 
      * Ejecuta receptor->recibir() a frecuencia fija mientras
-     * *running_ sea true. Lee running bajo protección mutex.
+     * *running_ sea true (o hasta detener ConfigHilo::parada).
      */
     void run();
 
@@ -125,6 +130,7 @@ private:
     pthread_mutex_t* mtx_raw_;
     
     double frequency_;              ///< Frecuencia de recepción (Hz)
+    DiscreteSystems::ConfigHilo config_;  ///< Opciones (token de parada)
     pthread_t thread_;              ///< ID del hilo pthread
 };
 
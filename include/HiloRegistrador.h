@@ -0,0 +1,69 @@
+/**
+ * @file HiloRegistrador.h
+ * @brief Hilo periódico que graba las señales del lazo en un RegistradorLazo
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Copia ref, e, u, ua, yk e ykd de VariablesCompartidas bajo el mutex y las
+ * añade al registro con el instante de la lectura, a la frecuencia del lazo.
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <memory>
+
+#include "ConfigHilo.h"
+#include "RegistradorLazo.h"
+#include "VariablesCompartidas.h"
+
+namespace DiscreteSystems {
+
+/**
+ * @class HiloRegistrador
+ * @brief Grabación a frecuencia fija de todas las variables del lazo
+ *
+ * @code{.cpp}
+ * auto rec = std::make_shared<RegistradorLazo>("/tmp/lazo.dsrec", 0.001);
+ * HiloRegistrador hiloRec(rec, vars.get(), &mtx, 1000.0);
+ * ...
+ * vars->running = false;   // El hilo termina y el destructor hace join
+ * @endcode
+ *
+ * @invariant frequency_ > 0 (Hz)
+ * @invariant Lee vars (y running) solo con mtx tomado; ConfigHilo::parada,
+ *            si se da, se consulta sin lock antes de tomarlo
+ */
+class HiloRegistrador {
+public:
+    /**
+     * @param registrador Registro destino (solo este hilo escribe en él)
+     * @param vars Variables del lazo; vars->running controla la vida del hilo
+     * @param mtx Mutex que protege vars
+     * @param frequency Frecuencia de grabación en Hz
+     * @param config Opciones opcionales (token de parada, ver ConfigHilo)
+     */
+    HiloRegistrador(std::shared_ptr<RegistradorLazo> registrador,
+                    VariablesCompartidas* vars,
+                    pthread_mutex_t* mtx,
+                    double frequency,
+                    const ConfigHilo& config = ConfigHilo());
+
+    /** @brief Espera la terminación del hilo */
+    ~HiloRegistrador();
+
+    pthread_t getThread() const { return thread_; }
+
+private:
+    static void* threadFunc(void* arg);
+    void run();
+
+    std::shared_ptr<RegistradorLazo> registrador_;
+    VariablesCompartidas* vars_;
+    pthread_mutex_t* mtx_;
+    double frequency_;     ///< Frecuencia de grabación (Hz)
+    ConfigHilo config_;    ///< Opciones (token de parada)
+    pthread_t thread_;     ///< ID del hilo pthread
+};
+
+} // namespace DiscreteSystems
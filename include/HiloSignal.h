@@ -19,6 +19,8 @@
 #include <csignal>
 #include "SignalGenerator.h"
 #include "RuntimeLogger.h"
+#include "TimingStats.h"
+#include "ConfigHilo.h"
 
 // Variable de control global para manejo de señales
 extern volatile sig_atomic_t g_signal_run;
@@ -61,13 +63,16 @@ public:
      * @param running Smart pointer a variable booleana de control
      * @param mtx Smart pointer al mutex que protege variables compartidas
      * @param frequency Frecuencia de ejecución en Hz
+     * @param log_prefix Prefijo para archivos de log
+     * @param config Opciones opcionales (marca de salida, ver ConfigHilo)
      */
     HiloSignal(std::shared_ptr<Signal> signal, 
                std::shared_ptr<double> output, 
                bool* running,
                std::shared_ptr<pthread_mutex_t> mtx, 
                double frequency,
-               const std::string& log_prefix);
+               const std::string& log_prefix,
+               const DiscreteSystems::ConfigHilo& config = DiscreteSystems::ConfigHilo());
 
     /**
      * @brief Constructor con punteros crudos (compatibilidad)
@@ -78,10 +83,13 @@ public:
      * @param running Puntero a variable booleana de control
      * @param mtx Puntero al mutex que protege variables compartidas
      * @param frequency Frecuencia de ejecución en Hz
+     * @param log_prefix Prefijo para archivos de log
+     * @param config Opciones opcionales (marca de salida, ver ConfigHilo)
      */
     HiloSignal(Signal* signal, double* output, bool* running,
                pthread_mutex_t* mtx, double frequency,
-               const std::string& log_prefix);
+               const std::string& log_prefix,
+               const DiscreteSystems::ConfigHilo& config = DiscreteSystems::ConfigHilo());
 
     /**
      * @brief Destructor que espera a que termine el hilo
@@ -94,6 +102,12 @@ public:
      */
     pthread_t getThread() const { return thread_; }
 
+    /**
+     * @brief Estadísticas de temporización del hilo (latencia de despertar,
+     *        drift y t_total); se pueden leer mientras el hilo se ejecuta
+     */
+    const DiscreteSystems::HiloTiming& timing() const { return timing_; }
+
 private:
     // Smart pointers (nueva interfaz)
     std::shared_ptr<Signal> signal_;
@@ -110,8 +124,10 @@ private:
     double frequency_;
     pthread_t thread_;
     DiscreteSystems::RuntimeLogger logger_;
+    DiscreteSystems::HiloTiming timing_;
+    DiscreteSystems::ConfigHilo config_;
     struct timespec t_prev_iteration_;
-    int iterations_;
+    std::uint64_t iterations_;
 
     static void* threadFunc(void* arg);
     void run();
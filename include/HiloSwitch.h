@@ -21,6 +21,8 @@
 #include "SignalSwitch.h"
 #include "ParametrosCompartidos.h"
 #include "RuntimeLogger.h"
+#include "TimingStats.h"
+#include "ConfigHilo.h"
 
 // Variable de control global para manejo de señales
 extern volatile sig_atomic_t g_signal_run;
@@ -91,7 +93,8 @@ public:
                std::shared_ptr<pthread_mutex_t> mtx, 
                std::shared_ptr<ParametrosCompartidos> params,
                double frequency,
-               const std::string& log_prefix);
+               const std::string& log_prefix,
+               const DiscreteSystems::ConfigHilo& config = DiscreteSystems::ConfigHilo());
     
     /**
      * @brief Constructor con punteros crudos (compatibilidad)
@@ -100,7 +103,8 @@ public:
     HiloSwitch(SignalGenerator::SignalSwitch* signalSwitch, double* output,
                bool* running, pthread_mutex_t* mtx, ParametrosCompartidos* params,
                double frequency,
-               const std::string& log_prefix);
+               const std::string& log_prefix,
+               const DiscreteSystems::ConfigHilo& config = DiscreteSystems::ConfigHilo());
     
     /**
      * @brief Destructor que espera terminación del hilo
@@ -113,6 +117,12 @@ public:
      */
     pthread_t getThread() const { return thread_; }
 
+    /**
+     * @brief Estadísticas de temporización del hilo (latencia de despertar,
+     *        drift y t_total); se pueden leer mientras el hilo se ejecuta
+     */
+    const DiscreteSystems::HiloTiming& timing() const { return timing_; }
+
 private:
     // Smart pointers
     std::shared_ptr<SignalGenerator::SignalSwitch> signalSwitch_;
@@ -131,8 +141,10 @@ private:
     double frequency_;                              ///< Frecuencia de ejecución (Hz)
     pthread_t thread_;                              ///< ID del hilo pthread
     DiscreteSystems::RuntimeLogger logger_;         ///< Logger de timing
+    DiscreteSystems::HiloTiming timing_;             ///< Estadísticas de temporización
+    DiscreteSystems::ConfigHilo config_;             ///< Opciones (marca de salida)
     struct timespec t_prev_iteration_;              ///< Timestamp anterior
-    int iterations_;                                ///< Contador de iteraciones
+    std::uint64_t iterations_;                      ///< Contador de iteraciones
 
     /**
      * @brief Función estática para pthread_create
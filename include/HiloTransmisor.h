@@ -18,6 +18,7 @@
 #include <memory>
 #include <atomic>
 #include "Transmisor.h"
+#include "ConfigHilo.h"
 
 // Variable de control global para manejo de señales
 extern volatile sig_atomic_t g_signal_run;
@@ -75,11 +76,13 @@ public:
      * @param running Smart pointer a variable booleana de control
      * @param mtx Smart pointer al mutex POSIX compartido
      * @param frequency Frecuencia de envío en Hz
+     * @param config Opciones opcionales (token de parada, ver ConfigHilo)
      */
     HiloTransmisor(std::shared_ptr<Transmisor> transmisor, 
                    bool* running,
                    std::shared_ptr<pthread_mutex_t> mtx, 
-                   double frequency);
+                   double frequency,
+                   const DiscreteSystems::ConfigHilo& config = DiscreteSystems::ConfigHilo());
     
     /**
      * @brief Constructor con punteros crudos (compatibilidad)
@@ -89,9 +92,11 @@ public:
      * @param running Puntero a variable booleana de control
      * @param mtx Puntero al mutex POSIX compartido
      * @param frequency Frecuencia de envío en Hz (período = 1/frequency)
+     * @param config Opciones opcionales (token de parada, ver ConfigHilo)
      */
     HiloTransmisor(Transmisor* transmisor, bool* running, 
-                   pthread_mutex_t* mtx, double frequency);
+                   pthread_mutex_t* mtx, double frequency,
+                   const DiscreteSystems::ConfigHilo& config = DiscreteSystems::ConfigHilo());
     
     /**
      * @brief Destructor que espera terminación del hilo
@@ -116,7 +121,7 @@ private:
      * @brief Loop principal del hilo
      * 
      * Ejecuta transmisor->enviar() a frecuencia fija mientras
-     * *running_ sea true. Lee running bajo protección mutex.
+     * *running_ sea true (o hasta detener ConfigHilo::parada).
      */
     void run();
 
@@ -131,6 +136,7 @@ private:
     pthread_mutex_t* mtx_raw_;
     
     double frequency_;              ///< Frecuencia de envío (Hz)
+    DiscreteSystems::ConfigHilo config_;  ///< Opciones (token de parada)
     pthread_t thread_;              ///< ID del hilo pthread
 };
 
@@ -0,0 +1,112 @@
+/**
+ * @file Interpolador.h
+ * @brief Bloque interpolador (CIC o FIR polifásico) de la tasa baja a la alta
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#ifndef DISCRETESYSTEMS_INTERPOLADOR_H
+#define DISCRETESYSTEMS_INTERPOLADOR_H
+
+#include "DiscreteSystem.h"
+#include "Multitasa.h"
+#include <cstdint>
+#include <vector>
+
+namespace DiscreteSystems {
+
+/**
+ * @class Interpolador
+ * @brief Sube la tasa por un factor N con un filtro anti-imagen
+ *
+ * Se ejecuta a la tasa de salida (Ts = periodo de la tasa alta) y toma una
+ * muestra nueva de la entrada en la primera de cada N llamadas; entre medias
+ * la entrada se ignora (la mantiene el productor lento). Cada llamada
+ * produce una salida, de modo que el escalón de 10 ms de u a 100 Hz llega
+ * al D/A de 1 kHz como una rampa filtrada:
+ *
+ * @code{.cpp}
+ * Interpolador interp(10, FiltroMultitasa::FIR, SystemConfig::TS_COMPONENT);
+ * Hilo hiloInterp(&interp, &u, &u_rapida, &running, &mtx, 1000.0, "hiloInterp");
+ * @endcode
+ *
+ * - FIR: subfiltro polifásico p = fase de la llamada, con ⌈L/N⌉
+ *   coeficientes de h (≈ N·h, cada subfiltro normalizado a ganancia unidad
+ *   en continua para que una entrada constante no deje rizado):
+ *   ⌈L/N⌉ MAC por salida, nunca L.
+ * - CIC: orden peines a la tasa baja, relleno de ceros e integradores a
+ *   la alta, en aritmética entera (CuantificadorCIC); ganancia N^(orden−1)
+ *   compensada.
+ *
+ * @invariant 0 <= fase_ < factor_
+ */
+class Interpolador : public DiscreteSystem {
+public:
+    /**
+     * @brief Interpolador con filtro por defecto
+     * @param factor Relación de tasas N (≥ 2)
+     * @param tipo CIC o FIR (disenarPasoBajoMultitasa(factor, parametro))
+     * @param Ts Período de muestreo de la salida (debe ser > 0)
+     * @param parametro Orden del CIC o coeficientes por fase del FIR
+     * @param bufferSize Tamaño del buffer circular (por defecto 100)
+     * @throws std::invalid_argument si factor < 2, parametro == 0 o el CIC no cabe en 64 bits
+     * @throws InvalidSamplingTime si Ts <= 0
+     */
+    Interpolador(size_t factor, FiltroMultitasa tipo, double Ts,
+                 size_t parametro = 3, size_t bufferSize = 100);
+
+    /**
+     * @brief Interpolador FIR con coeficientes propios
+     * @param factor Relación de tasas N (≥ 2)
+     * @param h Respuesta impulsional a la tasa de salida, ganancia unidad en continua
+     * @param Ts Período de muestreo de la salida (debe ser > 0)
+     * @param bufferSize Tamaño del buffer circular (por defecto 100)
+     * @throws std::invalid_argument si factor < 2 o h está vacío
+     * @throws InvalidSamplingTime si Ts <= 0
+     */
+    Interpolador(size_t factor, const std::vector<double>& h, double Ts, size_t bufferSize = 100);
+
+    size_t getFactor() const { return factor_; }
+    FiltroMultitasa getTipo() const { return tipo_; }
+
+    /** @brief Muestras de entrada tomadas desde el último reset */
+    std::uint64_t getEntradas() const { return entradas_; }
+
+    /** @brief Historial FIR subnormal (diagnóstico, ver EntornoFP.h) */
+    size_t contarSubnormales() const override;
+
+protected:
+    friend class DiscreteSystem;   ///< nextDirecto<Interpolador>() llama a compute()
+
+    /**
+     * @brief Produce una salida; en la fase 0 toma además una entrada nueva
+     * @param uk Entrada mantenida a la tasa baja
+     * @return Salida interpolada
+     */
+    double compute(double uk) override;
+
+    void resetState() override;
+
+private:
+    double computeFIR(double uk);
+    double computeCIC(double uk);
+
+    size_t factor_;
+    FiltroMultitasa tipo_;
+    size_t fase_;                  ///< Llamadas desde la última entrada tomada
+    std::uint64_t entradas_;
+
+    // FIR polifásico
+    size_t K_;                     ///< Coeficientes por subfiltro: ⌈L/N⌉
+    std::vector<double> polifase_; ///< polifase_[p·K + j] ∝ h[p + j·N], Σ_j = 1 por fase
+    std::vector<double> historial_; ///< historial_[j] = x(m − j) a la tasa baja
+
+    // CIC
+    std::vector<std::uint64_t> peines_;       ///< Valor anterior de cada peine (tasa baja)
+    std::vector<std::uint64_t> integradores_;
+    double ganancia_;                         ///< factor^(orden − 1)
+};
+
+} // namespace DiscreteSystems
+
+#endif // DISCRETESYSTEMS_INTERPOLADOR_H
@@ -7,6 +7,15 @@ private:
 public:
     InterruptorArranque();
     
+    /**
+     * @brief Fija el estado de marcha
+     *
+     * Actúa sobre DiscreteSystems::TokenParada::proceso(), que es común a
+     * todo el proceso: setRun(0) detiene todos los hilos configurados con
+     * ese token, sea cual sea la instancia de InterruptorArranque que lo
+     * llame. setRun(1) rearma el token (salvo tras SIGINT/SIGTERM) para los
+     * hilos que se creen después; los que ya salieron no se reinician.
+     */
     void setRun(int value);
     int getRun() const;
 };
@@ -0,0 +1,49 @@
+/**
+ * @file MarcaTemporal.h
+ * @brief Marca de generación y tiempo de origen de un valor del lazo
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Acompaña a cada variable de VariablesCompartidas para poder medir cuánto
+ * tarda un cambio de ref en llegar a e, u, ua, yk e ykd.
+ */
+
+#pragma once
+#include <cstdint>
+#include <time.h>
+
+/**
+ * @struct MarcaTemporal
+ * @brief Generación, instante de origen e instante de escritura de un valor
+ *
+ * - seq: se incrementa en cada escritura (0 = nunca escrito)
+ * - t_origen_ns: instante en que se generó la muestra de referencia de la que
+ *   procede el valor; los productores de ref lo fijan al escribir y cada
+ *   bloque intermedio lo copia de su entrada
+ * - t_escritura_ns: instante en que el productor escribió el valor
+ *
+ * Todos los instantes son CLOCK_MONOTONIC en ns. Se leen y escriben junto
+ * con el valor, bajo el mismo mutex.
+ */
+struct MarcaTemporal {
+    std::uint64_t seq = 0;          ///< Generación del valor
+    std::int64_t t_origen_ns = 0;   ///< Instante de la muestra de ref de origen [ns]
+    std::int64_t t_escritura_ns = 0;///< Instante de escritura [ns]
+
+    /** @brief Registra una nueva escritura */
+    void marcar(std::int64_t origen_ns, std::int64_t ahora_ns) {
+        ++seq;
+        t_origen_ns = origen_ns;
+        t_escritura_ns = ahora_ns;
+    }
+
+    /** @brief true si el valor se ha escrito al menos una vez */
+    bool valida() const { return seq != 0; }
+
+    /** @brief Instante actual CLOCK_MONOTONIC [ns] */
+    static std::int64_t ahoraNs() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<std::int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    }
+};
@@ -0,0 +1,66 @@
+/**
+ * @file Multitasa.h
+ * @brief Elementos comunes de Decimador e Interpolador (paso entre grupos de frecuencia)
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * El PID a FREQ_CONTROLLER leía e (producido a FREQ_COMPONENT) tomando el
+ * valor vigente: las muestras intermedias se pierden y lo que está por
+ * encima de la nueva frecuencia de Nyquist se pliega sobre la banda útil.
+ * Decimador filtra y reduce la tasa; Interpolador hace el camino inverso
+ * (u a 100 Hz → D/A a 1 kHz) sin escalones.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace DiscreteSystems {
+
+/**
+ * @enum FiltroMultitasa
+ * @brief Filtro antialiasing / anti-imagen de los bloques multitasa
+ */
+enum class FiltroMultitasa {
+    CIC,   ///< Integrador-peine en cascada: sin multiplicaciones, respuesta sinc^orden
+    FIR    ///< FIR polifásico de fase lineal (disenarPasoBajoMultitasa() o coeficientes propios)
+};
+
+/**
+ * @brief Paso bajo FIR de fase lineal para un cambio de tasa de factor N
+ *
+ * Sinc enventanada (Hamming) con corte en fs_alta / (2·factor) y ganancia
+ * unidad en continua. Longitud factor·taps_por_fase; retardo de grupo
+ * (longitud − 1) / 2 muestras de la tasa alta.
+ *
+ * @param factor Relación entre tasas (≥ 2)
+ * @param taps_por_fase Coeficientes de cada subfiltro polifásico (≥ 1)
+ * @throws std::invalid_argument si factor < 2 o taps_por_fase == 0
+ */
+std::vector<double> disenarPasoBajoMultitasa(std::size_t factor, std::size_t taps_por_fase = 4);
+
+/**
+ * @brief Aritmética entera del CIC (común a Decimador e Interpolador)
+ *
+ * Integradores y peines trabajan en enteros de 64 bits con desbordamiento
+ * modular (uint64_t), como en hardware: la salida es exacta aunque los
+ * integradores den la vuelta. La entrada se cuantifica con
+ * kBitsFraccion bits fraccionarios y se satura a ±2^kBitsRango.
+ */
+struct CuantificadorCIC {
+    static constexpr int kBitsFraccion = 24;   ///< Resolución 2^-24 ≈ 6e-8
+    static constexpr int kBitsRango = 16;      ///< |u| < 65536
+
+    /**
+     * @brief Comprueba que la ganancia factor^orden cabe en 64 bits
+     * @throws std::invalid_argument si factor < 2, orden == 0 o no cabe
+     */
+    static void validar(std::size_t factor, std::size_t orden);
+
+    static std::uint64_t cuantificar(double u);
+    static double reconstruir(std::uint64_t v, double ganancia);
+};
+
+} // namespace DiscreteSystems
@@ -31,8 +31,8 @@ namespace DiscreteSystems {
  *   a₁ = -Kp - 2·Kd/Ts
  *   a₂ = Kd/Ts
  * 
- * @invariant eHist_.size() <= 3 (almacena e(k), e(k-1), e(k-2))
- * @invariant uHist_.size() contiene el historial de salidas de control
+ * El estado son tres escalares (e(k-1), e(k-2), u(k-1)): el historial
+ * completo, si hace falta, es el de DiscreteSystem (PoliticaHistorial).
  */
 class PIDController : public DiscreteSystem {
 public:
@@ -116,6 +116,9 @@ public:
      */
     void setGains(double Kp, double Ki, double Kd);
 
+    /** @brief Variables de estado subnormales (diagnóstico, ver EntornoFP.h) */
+    size_t contarSubnormales() const override;
+
     /**
      * @brief Calcula la acción de control basada en el error
      * 
@@ -125,21 +128,23 @@ public:
      * @param ek Error en el paso k (e(k) = referencia - realimentación)
      * @return Acción de control u(k) en el paso k
      * 
-     * @invariant Después de ejecutar, eHist_ contiene los últimos 3 errores
+     * @invariant Después de ejecutar, e_k1_ = e(k), e_k2_ = e(k-1), u_k1_ = u(k)
      */
     double compute(double ek) override;
 
     /**
      * @brief Reinicia el estado interno del controlador
      * 
-     * Limpia los historiadores de error y control, preparando el
+     * Pone a cero e(k-1), e(k-2) y u(k-1), preparando el
      * PID para una nueva simulación desde condiciones iniciales.
      */
     void resetState() override;
 
 private:
-    std::vector<double> uHist_;   ///< Historial de acciones de control [u(k), u(k-1), ...]
-    std::vector<double> eHist_;   ///< Historial de errores [e(k), e(k-1), e(k-2)]
+    double e_k1_;                 ///< e(k-1)
+    double e_k2_;                 ///< e(k-2)
+    double u_k1_;                 ///< u(k-1)
+    bool hayControl_;             ///< Ya se ha calculado al menos una salida
     double Kp_;                   ///< Ganancia proporcional
     double Ki_;                   ///< Ganancia integral
     double Kd_;                   ///< Ganancia derivativa
@@ -0,0 +1,290 @@
+/**
+ * @file RegistradorLazo.h
+ * @brief Registro columnar en fichero mapeado de todas las señales del lazo
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Graba t, ref, e, u, ua, yk e ykd a la frecuencia del lazo (1 kHz) en un
+ * fichero binario por columnas y por bloques (chunks), pensado para
+ * ejecuciones de varias horas y para su análisis posterior con
+ * LectorRegistro (o desde MATLAB/numpy leyendo la cabecera).
+ *
+ * Formato del fichero (little-endian, tal cual en memoria):
+ * @verbatim
+ *   [0, 4096)                 CabeceraRegistro
+ *   [4096 + c*B, 4096+(c+1)*B) chunk c, con B = N * 7 * 8 bytes:
+ *       int64  t_ns[N]        CLOCK_MONOTONIC [ns]
+ *       double ref[N]
+ *       double e[N]
+ *       double u[N]
+ *       double ua[N]
+ *       double yk[N]
+ *       double ykd[N]
+ * @endverbatim
+ *
+ * N (muestras por chunk) es múltiplo de 512, así que cada chunk empieza en
+ * frontera de página. El escritor mapea el fichero por segmentos de varios
+ * chunks (ftruncate + mmap); un hilo auxiliar prepara el segmento siguiente
+ * mientras se llena el actual, así que append() es O(1), escribe
+ * directamente en memoria y al cambiar de segmento solo intercambia punteros.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace DiscreteSystems {
+
+/**
+ * @struct MuestraLazo
+ * @brief Una fila del registro (un periodo del lazo)
+ */
+struct MuestraLazo {
+    std::int64_t t_ns = 0;   ///< Instante de la muestra (CLOCK_MONOTONIC) [ns]
+    double ref = 0.0;
+    double e = 0.0;
+    double u = 0.0;
+    double ua = 0.0;
+    double yk = 0.0;
+    double ykd = 0.0;
+};
+
+/**
+ * @enum ColumnaLazo
+ * @brief Columnas de datos; el valor es su posición dentro del chunk (0 = t_ns)
+ */
+enum class ColumnaLazo { Ref = 1, E, U, Ua, Yk, Ykd };
+
+/**
+ * @struct CabeceraRegistro
+ * @brief Primera página del fichero
+ *
+ * muestras se actualiza con semántica release tras cada append(), de modo
+ * que un lector concurrente (otro proceso con el fichero mapeado) nunca ve
+ * una fila a medio escribir.
+ */
+struct CabeceraRegistro {
+    static constexpr std::size_t kTamano = 4096;
+    static constexpr std::uint32_t kVersion = 1;
+    static constexpr std::uint32_t kColumnas = 7;
+
+    char magic[8];                    ///< "DSREC001"
+    std::uint32_t version;            ///< kVersion
+    std::uint32_t columnas;           ///< kColumnas (t_ns + 6 señales)
+    std::uint64_t muestras_chunk;     ///< N
+    std::uint64_t muestras;           ///< Filas válidas (escritura release)
+    std::int64_t t0_monotonic_ns;     ///< CLOCK_MONOTONIC al abrir
+    std::int64_t t0_realtime_ns;      ///< CLOCK_REALTIME al abrir (fecha del registro)
+    double periodo_nominal_s;         ///< Periodo de muestreo previsto
+    char nombres[kColumnas][16];      ///< "t_ns", "ref", "e", "u", "ua", "yk", "ykd"
+    std::uint8_t reservado[kTamano - 56 - kColumnas * 16];
+};
+
+static_assert(sizeof(CabeceraRegistro) == CabeceraRegistro::kTamano,
+              "CabeceraRegistro debe ocupar exactamente una página");
+
+/**
+ * @class RegistradorLazo
+ * @brief Escritor del registro; un único hilo llama a append()
+ *
+ * @code{.cpp}
+ * RegistradorLazo rec("/tmp/lazo.dsrec", 0.001);
+ * MuestraLazo m;
+ * m.t_ns = MarcaTemporal::ahoraNs();
+ * m.ref = vars.ref; ...
+ * rec.append(m);          // sin llamadas al sistema
+ * @endcode
+ *
+ * Con los valores por defecto (N = 4096, 16 chunks por segmento) un segmento
+ * son 3.5 MiB y cubre algo más de un minuto a 1 kHz. Hay a la vez dos
+ * segmentos mapeados (el actual y el siguiente, ya prefallado por el hilo
+ * auxiliar); el anterior se desmapea en ese hilo tras el cambio.
+ */
+class RegistradorLazo {
+public:
+    /**
+     * @brief Crea (o trunca) el fichero, mapea el primer segmento y lanza el
+     *        hilo auxiliar que prepara el segundo
+     *
+     * @param path Ruta del fichero
+     * @param periodo_nominal_s Periodo previsto entre muestras (solo informativo)
+     * @param muestras_chunk N, múltiplo de 512
+     * @param chunks_segmento Chunks mapeados a la vez (> 0)
+     * @throws std::invalid_argument si N o chunks_segmento no son válidos
+     * @throws std::runtime_error si no se puede crear, ampliar o mapear el fichero
+     */
+    RegistradorLazo(const std::string& path, double periodo_nominal_s,
+                    std::size_t muestras_chunk = 4096, std::size_t chunks_segmento = 16);
+
+    /**
+     * @brief Detiene el hilo auxiliar, vuelca y desmapea; el fichero queda
+     *        con la cabecera al día y sin el segmento preparado sin usar
+     */
+    ~RegistradorLazo();
+
+    RegistradorLazo(const RegistradorLazo&) = delete;
+    RegistradorLazo& operator=(const RegistradorLazo&) = delete;
+
+    /**
+     * @brief Añade una fila (O(1))
+     *
+     * Al cambiar de segmento toma el preparado por el hilo auxiliar; solo
+     * espera si aún no está listo (el hilo tuvo un segmento entero de margen).
+     * @throws std::runtime_error si el hilo auxiliar no pudo ampliar o mapear
+     *         el fichero para el segmento siguiente
+     */
+    void append(const MuestraLazo& m) {
+        if (pos_ == n_chunk_) {
+            siguienteChunk();
+        }
+        col_t_[pos_] = m.t_ns;
+        col_[0][pos_] = m.ref;
+        col_[1][pos_] = m.e;
+        col_[2][pos_] = m.u;
+        col_[3][pos_] = m.ua;
+        col_[4][pos_] = m.yk;
+        col_[5][pos_] = m.ykd;
+        ++pos_;
+        __atomic_store_n(&cab_->muestras, ++muestras_, __ATOMIC_RELEASE);
+    }
+
+    /** @brief Filas escritas */
+    std::uint64_t muestras() const { return muestras_; }
+
+    /** @brief Pide al núcleo que escriba a disco lo pendiente (msync asíncrono) */
+    void sincronizar();
+
+    const std::string& path() const { return path_; }
+
+private:
+    void* mapearSegmento(std::size_t primer_chunk);
+    void usarChunk(std::size_t chunk);
+    void siguienteChunk();
+    void cambiarSegmento();
+    void ayudante();
+
+    std::string path_;
+    int fd_;
+    CabeceraRegistro* cab_;       ///< Cabecera mapeada (toda la vida del objeto)
+    void* seg_;                   ///< Segmento mapeado actual
+    std::size_t seg_bytes_;
+    std::size_t seg_chunk0_;      ///< Primer chunk del segmento actual
+    std::size_t chunks_segmento_;
+    std::size_t n_chunk_;         ///< N
+    std::size_t chunk_bytes_;
+    std::size_t chunk_;           ///< Chunk actual
+    std::size_t pos_;             ///< Fila dentro del chunk actual
+    std::uint64_t muestras_;
+    std::int64_t* col_t_;         ///< Columnas del chunk actual
+    double* col_[6];
+
+    // Hilo auxiliar: todo lo siguiente se protege con ayuda_mtx_
+    std::mutex ayuda_mtx_;
+    std::condition_variable ayuda_cv_;
+    void* sig_;                   ///< Segmento siguiente ya mapeado (o nullptr)
+    std::size_t sig_chunk0_;      ///< Primer chunk de sig_ (o del pedido en curso)
+    void* liberar_;               ///< Segmento anterior pendiente de desmapear
+    bool pedido_;                 ///< Hay que preparar el segmento sig_chunk0_
+    bool fin_;
+    std::string error_;           ///< Fallo del último pedido
+    std::thread ayudante_;
+};
+
+/**
+ * @class LectorRegistro
+ * @brief Acceso de solo lectura a un registro (mmap completo del fichero)
+ *
+ * Las filas válidas son las indicadas en la cabecera al abrir. Las columnas
+ * son contiguas dentro de cada chunk: tramo() da acceso sin copia y leer()
+ * copia un rango que puede cruzar chunks.
+ *
+ * @code{.cpp}
+ * LectorRegistro lr("/tmp/lazo.dsrec");
+ * std::uint64_t i0 = lr.buscarTiempo(lr.tiempo(0) + 3600000000000LL);  // t0 + 1 h
+ * std::vector<double> e(1000);
+ * lr.leer(ColumnaLazo::E, i0, e.size(), e.data());
+ * @endcode
+ */
+class LectorRegistro {
+public:
+    /**
+     * @throws std::runtime_error si el fichero no existe, no se puede mapear
+     *         o su cabecera no es válida
+     */
+    explicit LectorRegistro(const std::string& path);
+    ~LectorRegistro();
+
+    LectorRegistro(const LectorRegistro&) = delete;
+    LectorRegistro& operator=(const LectorRegistro&) = delete;
+
+    std::uint64_t muestras() const { return muestras_; }
+    std::size_t muestrasChunk() const { return n_chunk_; }
+    const CabeceraRegistro& cabecera() const { return *cab_; }
+
+    /** @brief t_ns de la fila i (sin comprobar rango) */
+    std::int64_t tiempo(std::uint64_t i) const {
+        return reinterpret_cast<const std::int64_t*>(chunk(i))[i % n_chunk_];
+    }
+
+    /** @brief Valor de la columna c en la fila i (sin comprobar rango) */
+    double valor(ColumnaLazo c, std::uint64_t i) const {
+        return columna(c, i)[i % n_chunk_];
+    }
+
+    /** @brief Fila completa i (sin comprobar rango) */
+    MuestraLazo muestra(std::uint64_t i) const;
+
+    /**
+     * @brief Puntero a la columna c desde la fila i hasta el final de su chunk
+     * @param n [out] Filas válidas accesibles desde el puntero
+     * @return nullptr si i está fuera de rango
+     */
+    const double* tramo(ColumnaLazo c, std::uint64_t i, std::size_t& n) const;
+
+    /**
+     * @brief Copia n valores de la columna c a partir de la fila inicio
+     * @return Valores copiados (menos de n si se alcanza el final)
+     */
+    std::size_t leer(ColumnaLazo c, std::uint64_t inicio, std::size_t n, double* out) const;
+
+    /** @brief Copia n tiempos a partir de la fila inicio; devuelve los copiados */
+    std::size_t leerTiempos(std::uint64_t inicio, std::size_t n, std::int64_t* out) const;
+
+    /**
+     * @brief Indica al núcleo que el registro se recorrerá en orden (madvise)
+     *
+     * Lectura anticipada agresiva y liberación de las páginas ya leídas: el
+     * recorrido completo de un registro mayor que la RAM no desplaza al
+     * resto del sistema.
+     */
+    void aconsejarSecuencial() const;
+
+    /**
+     * @brief Primera fila con t_ns >= t (búsqueda binaria, los tiempos son crecientes)
+     * @return muestras() si todas son anteriores a t
+     */
+    std::uint64_t buscarTiempo(std::int64_t t) const;
+
+private:
+    const char* chunk(std::uint64_t i) const {
+        return datos_ + (i / n_chunk_) * chunk_bytes_;
+    }
+    const double* columna(ColumnaLazo c, std::uint64_t i) const {
+        return reinterpret_cast<const double*>(chunk(i) + static_cast<int>(c) * n_chunk_ * 8);
+    }
+
+    void* map_;
+    std::size_t map_size_;
+    const CabeceraRegistro* cab_;
+    const char* datos_;
+    std::size_t n_chunk_;
+    std::size_t chunk_bytes_;
+    std::uint64_t muestras_;
+};
+
+} // namespace DiscreteSystems
@@ -0,0 +1,122 @@
+/**
+ * @file Reproductor.h
+ * @brief Reproducción de señales grabadas a través de una cadena de bloques
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Para depurar incidencias de campo: toma una columna de entrada de un
+ * registro (RegistradorLazo), la pasa por una cadena de DiscreteSystem con
+ * la API por bloques (process()) tan rápido como se pueda y compara la
+ * salida con otra columna grabada, con tolerancia.
+ *
+ * El registro se recorre chunk a chunk directamente sobre el mapa del
+ * fichero (la primera etapa lee la columna sin copiarla), así que la
+ * memoria usada es la de dos bloques de trabajo independientemente de la
+ * duración de la grabación.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "DiscreteSystem.h"
+#include "RegistradorLazo.h"
+
+namespace DiscreteSystems {
+
+/**
+ * @struct OpcionesReproduccion
+ * @brief Rango, tamaño de bloque y tolerancia de la comparación
+ *
+ * Una muestra coincide si |obtenido - esperado| <= tol_abs + tol_rel * |esperado|.
+ */
+struct OpcionesReproduccion {
+    std::uint64_t inicio = 0;                                          ///< Primera fila
+    std::uint64_t muestras = std::numeric_limits<std::uint64_t>::max(); ///< Filas (recortado al registro)
+    std::size_t bloque = 4096;              ///< Muestras por llamada a process()
+    double tol_abs = 1e-9;
+    double tol_rel = 0.0;
+    std::size_t max_discrepancias = 16;     ///< Discrepancias que se guardan con detalle
+};
+
+/**
+ * @struct Discrepancia
+ * @brief Muestra fuera de tolerancia
+ */
+struct Discrepancia {
+    std::uint64_t fila;
+    std::int64_t t_ns;
+    double esperado;
+    double obtenido;
+};
+
+/**
+ * @struct ResultadoReproduccion
+ * @brief Resumen de una reproducción
+ */
+struct ResultadoReproduccion {
+    std::uint64_t muestras = 0;              ///< Filas reproducidas
+    std::uint64_t fuera_tolerancia = 0;
+    double error_max = 0.0;                  ///< max |obtenido - esperado|
+    std::uint64_t fila_error_max = 0;
+    double error_rms = 0.0;
+    std::vector<Discrepancia> discrepancias; ///< Primeras max_discrepancias, en orden
+    double segundos = 0.0;                   ///< Tiempo de pared de la reproducción
+
+    bool ok() const { return fuera_tolerancia == 0; }
+    double muestrasPorSegundo() const { return segundos > 0.0 ? muestras / segundos : 0.0; }
+};
+
+/**
+ * @class Reproductor
+ * @brief Cadena de bloques alimentada desde un registro
+ *
+ * Los bloques deben estar en el mismo estado que al grabar la fila inicio
+ * (normalmente recién construidos y reproduciendo desde la fila 0). El
+ * reproductor no los reinicia ni se queda con ellos.
+ *
+ * @code{.cpp}
+ * LectorRegistro lr("incidencia.dsrec");
+ * PIDController pid(Kp, Ki, Kd, Ts);
+ * Reproductor rep(lr);
+ * rep.etapa(pid);
+ * ResultadoReproduccion r = rep.ejecutar(ColumnaLazo::E, ColumnaLazo::U);
+ *
+ * DAConverter da(...);  TransferFunctionSystem planta(...);
+ * Reproductor rp(lr);
+ * rp.etapa(da).etapa(planta);
+ * r = rp.ejecutar(ColumnaLazo::U, ColumnaLazo::Yk);
+ * @endcode
+ */
+class Reproductor {
+public:
+    explicit Reproductor(const LectorRegistro& lector);
+
+    /** @brief Añade un bloque al final de la cadena */
+    Reproductor& etapa(DiscreteSystem& sys);
+
+    /**
+     * @brief Reproduce entrada -> cadena y compara con salida
+     * @throws std::invalid_argument si la cadena está vacía o bloque == 0
+     */
+    ResultadoReproduccion ejecutar(ColumnaLazo entrada, ColumnaLazo salida,
+                                   const OpcionesReproduccion& op = OpcionesReproduccion());
+
+    /**
+     * @brief Igual, con una primera etapa de dos entradas (p.ej. Sumador: ref, ykd -> e)
+     */
+    ResultadoReproduccion ejecutar(ColumnaLazo entrada1, ColumnaLazo entrada2, ColumnaLazo salida,
+                                   const OpcionesReproduccion& op = OpcionesReproduccion());
+
+private:
+    ResultadoReproduccion reproducir(ColumnaLazo entrada1, const ColumnaLazo* entrada2,
+                                     ColumnaLazo salida, const OpcionesReproduccion& op);
+
+    const LectorRegistro& lector_;
+    std::vector<DiscreteSystem*> etapas_;
+};
+
+} // namespace DiscreteSystems
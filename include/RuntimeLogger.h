@@ -10,6 +10,8 @@
  * - Escritura periódica a disco
  * - Generación automática de archivos con timestamp
  * - Headers personalizables
+ * - Contabilidad de CPU por hilo: tiempo de CPU (CLOCK_THREAD_CPUTIME_ID),
+ *   cambios de contexto y fallos de página (getrusage RUSAGE_THREAD)
  */
 
 #pragma once
@@ -21,6 +23,8 @@
 #include <iomanip>
 #include <ctime>
 #include <sys/stat.h>
+#include <sys/resource.h>
+#include <cstdint>
 
 namespace DiscreteSystems {
 
@@ -47,9 +51,36 @@ namespace DiscreteSystems {
  * // Forzar escritura a disco
  * logger.flush();
  * @endcode
+ *
+ * Contabilidad de CPU (opcional, setCpuAccounting()): la versión de writeLine() con métricas de timing la
+ * llama el propio hilo medido, así que en cada línea se muestrean el tiempo
+ * de CPU del hilo y sus contadores de getrusage(RUSAGE_THREAD) y se anotan
+ * los incrementos desde la línea anterior (cpu_us, nvcsw, nivcsw, minflt,
+ * majflt). El muestreo de referencia se toma al final de writeLine(), de
+ * modo que el coste del propio log y de los flush no se imputa al hilo.
+ * - cpu_us muy por debajo de t_total_us: el hilo estuvo esperando (mutex) o
+ *   expulsado, no calculando
+ * - nivcsw > 0: el planificador expulsó al hilo (interferencia)
+ * - nvcsw ≈ 1 por iteración es normal (el sueño de Temporizador::esperar)
+ * - majflt > 0: acceso a disco por fallo de página (memoria no bloqueada)
  */
 class RuntimeLogger {
 public:
+    /**
+     * @struct CpuTotales
+     * @brief Totales acumulados de la contabilidad de CPU del hilo
+     */
+    struct CpuTotales {
+        std::uint64_t muestras = 0;       ///< Líneas contabilizadas
+        std::int64_t cpu_ns = 0;          ///< Tiempo de CPU total [ns]
+        std::int64_t cpu_max_ns = 0;      ///< Máximo por línea [ns]
+        std::uint64_t nvcsw = 0;          ///< Cambios de contexto voluntarios
+        std::uint64_t nivcsw = 0;         ///< Cambios de contexto involuntarios
+        std::uint64_t minflt = 0;         ///< Fallos de página menores
+        std::uint64_t majflt = 0;         ///< Fallos de página mayores
+        std::uint64_t lineas_expulsado = 0; ///< Líneas con nivcsw > 0
+    };
+
     /**
      * @brief Constructor que crea el archivo de log con timestamp
      * 
@@ -108,6 +139,27 @@ public:
      * @brief Obtiene la ruta del archivo de log
      */
     std::string getLogPath() const { return logfile_path_; }
+
+    /**
+     * @brief Activa o desactiva la contabilidad de CPU (desactivada por defecto)
+     *
+     * Activa, las líneas de timing llevan las columnas cpu_us, nvcsw, nivcsw,
+     * minflt y majflt y la cabecera el resumen "CPU: ...". Los hilos la
+     * activan con ConfigHilo::contabilidad_cpu.
+     * @note Cuesta dos llamadas al sistema por línea (~1 us)
+     */
+    void setCpuAccounting(bool enabled) { cpu_accounting_ = enabled; }
+
+    /**
+     * @brief Totales de la contabilidad de CPU (leer desde el propio hilo o
+     *        con el hilo parado)
+     */
+    const CpuTotales& cpuTotales() const { return cpu_totales_; }
+
+    /**
+     * @brief Obtiene el prefijo con el que se creó el logger (nombre del hilo)
+     */
+    const std::string& getPrefix() const { return prefix_; }
     
     // ===== Métodos de inicialización predefinidos para hilos específicos =====
     
@@ -128,19 +180,23 @@ public:
      * @brief Escribe una línea de timing (versión sobrecargada)
      * 
      * Formatea automáticamente los valores de timing y escribe al buffer.
+     * Los tiempos llegan en nanosegundos enteros (aNs()/difNs() de
+     * Temporizador.h) y solo se pasan a microsegundos al formatear la
+     * línea, así que drift y %error son exactos en ejecuciones de meses.
      * 
      * @param iteration Número de iteración
-     * @param t_espera_us Tiempo de espera del mutex (microsegundos)
-     * @param t_ejec_us Tiempo de ejecución de la tarea (microsegundos)
-     * @param t_total_us Tiempo total del ciclo (microsegundos)
-     * @param periodo_us Período de muestreo configurado (microsegundos)
-     * @param ts_real_us Período real medido entre iteraciones (microsegundos)
+     * @param t_espera_ns Tiempo de espera del mutex [ns]
+     * @param t_ejec_ns Tiempo de ejecución de la tarea [ns]
+     * @param t_total_ns Tiempo total del ciclo [ns]
+     * @param periodo_ns Período de muestreo configurado [ns]
+     * @param ts_real_ns Período real medido entre iteraciones [ns]
      * @param status Estado: "OK", "WARNING", "CRITICAL", "ERROR_MUTEX"
      */
-    void writeLine(int iteration, double t_espera_us, double t_ejec_us,
-                   double t_total_us, double periodo_us, double ts_real_us,
+    void writeLine(std::uint64_t iteration, std::int64_t t_espera_ns, std::int64_t t_ejec_ns,
+                   std::int64_t t_total_ns, std::int64_t periodo_ns, std::int64_t ts_real_ns,
                    const char* status);
 private:
+    std::string prefix_;                // Prefijo (nombre del hilo)
     std::string logfile_path_;          // Ruta completa del archivo
     std::string header_;                // Header informativo
     std::vector<std::string> columns_;  // Nombres de columnas
@@ -149,6 +205,21 @@ private:
     int max_lines_;                     // Máximo de líneas en buffer
     int flush_interval_;                // Intervalo de auto-flush
     int lines_since_flush_;             // Contador de líneas desde último flush
+
+    bool columnas_timing_;              // Columnas de initializeHilo*() (admiten las de CPU)
+
+    // Contabilidad de CPU del hilo que escribe
+    bool cpu_accounting_;               // Muestrear CPU/getrusage en cada línea
+    bool cpu_base_valida_;              // Hay muestra de referencia del hilo
+    struct timespec cpu_prev_;          // Última muestra de CLOCK_THREAD_CPUTIME_ID
+    struct rusage ru_prev_;             // Última muestra de getrusage(RUSAGE_THREAD)
+    CpuTotales cpu_totales_;            // Totales para el resumen
+    
+    /**
+     * @brief Toma la muestra de referencia de CPU/getrusage del hilo actual
+     * @return false si no está disponible
+     */
+    bool sampleCpu(struct timespec& cpu, struct rusage& ru) const;
     
     /**
      * @brief Escribe el contenido completo del buffer al archivo
@@ -0,0 +1,96 @@
+/**
+ * @file SOSSystem.h
+ * @brief Sistema discreto definido como cascada de secciones de segundo orden
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#ifndef DISCRETESYSTEMS_SOSSYSTEM_H
+#define DISCRETESYSTEMS_SOSSYSTEM_H
+
+#include "DiscreteSystem.h"
+#include "Discretizer.h"
+#include <vector>
+
+namespace DiscreteSystems {
+
+/**
+ * @class SOSSystem
+ * @brief Sistema discreto SISO como cascada de biquads (SOS)
+ * 
+ * La función de transferencia es el producto de las secciones:
+ * 
+ *          N    b0_i + b1_i*z^-1 + b2_i*z^-2
+ * H(z) = prod  ------------------------------
+ *         i=1   1   + a1_i*z^-1 + a2_i*z^-2
+ * 
+ * Cada sección se evalúa en forma directa II transpuesta:
+ * 
+ *   y    = b0*x + s1
+ *   s1   = b1*x - a1*y + s2
+ *   s2   = b2*x - a2*y
+ * 
+ * Es la forma recomendada para órdenes altos: cada sección solo ve
+ * coeficientes de 2º orden, por lo que el error de redondeo no crece
+ * con el orden total como en TransferFunctionSystem.
+ * 
+ * Patrón de uso:
+ * @code{.cpp}
+ * auto sos = discretizeSOS(num_s, den_s, Ts);
+ * SOSSystem G(sos, Ts);
+ * double y = G.next(u);
+ * @endcode
+ * 
+ * @invariant state_.size() == 2 * sections_.size()
+ */
+class SOSSystem : public DiscreteSystem {
+public:
+    /**
+     * @brief Constructor
+     * @param sections Secciones de la cascada (en orden de ejecución)
+     * @param Ts Período de muestreo (debe ser > 0)
+     * @param bufferSize Tamaño del buffer circular (por defecto 100)
+     * @throws std::invalid_argument si sections está vacío
+     * @throws InvalidSamplingTime si Ts <= 0
+     */
+    SOSSystem(const std::vector<SecondOrderSection>& sections,
+              double Ts,
+              size_t bufferSize = 100);
+
+    /**
+     * @brief Obtiene las secciones de la cascada
+     * @return Vector de secciones (a0 = 1 implícito)
+     */
+    const std::vector<SecondOrderSection>& getSections() const { return sections_; }
+
+    /** @brief Variables de estado subnormales (diagnóstico, ver EntornoFP.h) */
+    size_t contarSubnormales() const override;
+
+protected:
+    friend class DiscreteSystem;   ///< nextDirecto<SOSSystem>() llama a compute()
+
+    /**
+     * @brief Propaga la entrada por todas las secciones de la cascada
+     * @param uk Entrada en el paso k
+     * @return Salida y(k) de la última sección
+     */
+    double compute(double uk) override;
+
+    /**
+     * @brief Reinicia los estados internos de todas las secciones
+     */
+    void resetState() override;
+
+    /**
+     * @brief Cascada sobre un bloque sin llamada virtual por muestra
+     */
+    void computeBlock(const double* u, double* y, size_t n) override;
+
+private:
+    std::vector<SecondOrderSection> sections_; ///< Secciones biquad
+    std::vector<double> state_;                ///< Estados [s1_0, s2_0, s1_1, s2_1, ...]
+};
+
+} // namespace DiscreteSystems
+
+#endif // DISCRETESYSTEMS_SOSSYSTEM_H
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <vector>
-#include <deque>
 #include <memory>
 #include <ostream>
 #include <cstddef>
@@ -20,8 +19,11 @@ namespace SignalGenerator {
  *   matemática a las subclases a través de computeAt(time).
  * - Separa cálculo puro (computeAt/compute) de operaciones con efectos
  *   (next), lo que facilita pruebas y razonamiento.
- * - Usamos contenedores STL (std::deque) y smart pointers en subclases
- *   compuestas para evitar manejo manual de memoria (malloc/free).
+ * - El historial (tiempo, valor) se guarda en un anillo contiguo
+ *   preasignado en el constructor: next() no reserva ni libera memoria.
+ *   En caminos críticos puede desactivarse por completo con setRecording(false).
+ * - Usamos contenedores STL y smart pointers en subclases compuestas para
+ *   evitar manejo manual de memoria (malloc/free).
  *
  * Ejemplo básico de uso:
  * @code{.cpp}
@@ -38,10 +40,29 @@ protected:
     double t_;              // Tiempo actual [s]
     std::size_t buffer_size_;  // Tamaño máximo del buffer circular
 
-    std::deque<double> time_buffer_;
-    std::deque<double> value_buffer_;
+    // Anillo contiguo preasignado (capacidad buffer_size_)
+    std::vector<double> time_ring_;
+    std::vector<double> value_ring_;
+    std::size_t ring_head_;    // Próxima posición de escritura
+    std::size_t ring_count_;   // Muestras válidas (<= buffer_size_)
+    bool recording_;           // false: addToBuffer() no hace nada
 
-    void addToBuffer(double time, double value);
+    /**
+     * @brief Inserta (time, value) en el anillo en O(1), sin reservas de memoria.
+     */
+    void addToBuffer(double time, double value) {
+        if (!recording_) return;
+        time_ring_[ring_head_] = time;
+        value_ring_[ring_head_] = value;
+        if (++ring_head_ == buffer_size_) ring_head_ = 0;
+        if (ring_count_ < buffer_size_) ++ring_count_;
+    }
+
+    /**
+     * @brief Registra un bloque generado con tiempos t0 + i*Ts_ (solo las
+     *        últimas bufferSize() muestras llegan al anillo).
+     */
+    void addBlockToBuffer(double t0, const double* values, std::size_t n);
 
 public:
     /**
@@ -94,6 +115,21 @@ public:
      */
     virtual double next();
 
+    /**
+     * @brief Genera n muestras consecutivas en out, las registra y avanza t_.
+     *
+     * Equivale a n llamadas a next(), pero las subclases lo implementan con
+     * un bucle cerrado sin llamadas virtuales por muestra. StepSignal y
+     * PwmSignal evalúan la muestra i en t_ + i*Ts_ para vectorizar: el
+     * tiempo difiere del acumulado por next() en unos ulp, lo que solo cambia
+     * una muestra que caiga justo en un flanco. SineSignal acumula t_ igual
+     * que next() y da las mismas muestras bit a bit.
+     * La implementación por defecto llama a next() n veces.
+     * @param out Destino (al menos n elementos).
+     * @param n Número de muestras.
+     */
+    virtual void generate(double* out, std::size_t n);
+
     /**
      * @brief Reinicia la señal: pone t_ a 0 y limpia los buffers.
      */
@@ -110,11 +146,45 @@ public:
     double& t();
     const double& t() const;
 
-    std::size_t& bufferSize();
     const std::size_t& bufferSize() const;
 
-    const std::deque<double>& timeBuffer() const;
-    const std::deque<double>& valueBuffer() const;
+    /**
+     * @brief Cambia la capacidad del anillo (reserva de nuevo y lo vacía).
+     * @param buffer_size Nueva capacidad (>= 1).
+     * @throw std::invalid_argument si buffer_size == 0.
+     * @note No llamar desde el hilo de tiempo real: reserva memoria.
+     */
+    void setBufferSize(std::size_t buffer_size);
+
+    /**
+     * @brief Activa o desactiva el registro de muestras en el anillo.
+     *
+     * Con el registro desactivado next() no toca el anillo: útil en hilos
+     * de referencia donde nadie consulta el historial.
+     * @param enabled true para registrar (por defecto), false para no registrar.
+     */
+    void setRecording(bool enabled) { recording_ = enabled; }
+    bool recording() const { return recording_; }
+
+    /** @brief Número de muestras válidas en el anillo */
+    std::size_t bufferCount() const { return ring_count_; }
+
+    /**
+     * @brief Copia el historial en orden cronológico a dos arrays contiguos.
+     *
+     * Como mucho se copian las max_samples muestras más recientes (dos
+     * memcpy como máximo, uno por cada tramo del anillo).
+     * @param times Destino de los tiempos (puede ser nullptr).
+     * @param values Destino de los valores (puede ser nullptr).
+     * @param max_samples Capacidad de los arrays destino.
+     * @return Número de muestras copiadas.
+     */
+    std::size_t snapshot(double* times, double* values, std::size_t max_samples) const;
+
+    /** @brief Copia cronológica de los tiempos del anillo */
+    std::vector<double> timeBuffer() const;
+    /** @brief Copia cronológica de los valores del anillo */
+    std::vector<double> valueBuffer() const;
     ///@}
 
     /**
@@ -156,6 +226,9 @@ public:
      */
     double computeAt(double time) const override;
 
+    /** @brief Bloque de escalón (selección sin saltos, vectorizable). */
+    void generate(double* out, std::size_t n) override;
+
     /**
      * @note Diseño: StepSignal ilustra una subclase concreta que sólo implementa
      * la fórmula matemática. No gestiona buffers; esa responsabilidad es de
@@ -193,6 +266,9 @@ public:
      */
     double computeAt(double time) const override;
 
+    /** @brief Bloque PWM: la fase se reduce con floor en lugar de std::fmod. */
+    void generate(double* out, std::size_t n) override;
+
     /**
      * @note Diseño: PwmSignal muestra cómo encapsular parámetros (duty, period)
      * y validar en el constructor para evitar estados inválidos durante el uso.
@@ -208,12 +284,35 @@ public:
     const double& period() const;
 };
 
+/**
+ * @brief Modo de cálculo de SineSignal::next().
+ */
+enum class SineMode {
+    Analytic,   ///< std::sin(2*pi*f*t + phase) en cada muestra
+    Oscillator  ///< Oscilador recursivo por rotación, sin trigonometría por muestra
+};
+
 class SineSignal : public Signal {
     double amplitude_;
     double freq_;
     double phase_;
 
+    // Estado del oscilador recursivo (SineMode::Oscillator)
+    SineMode mode_;
+    double cos_;            // cos(fase actual)
+    double sin_;            // sin(fase actual)
+    double rot_cos_;        // cos(2*pi*f*Ts)
+    double rot_sin_;        // sin(2*pi*f*Ts)
+    double cycles_;         // Fase del último anclaje en ciclos, reducida a [0, 1)
+    std::size_t since_anchor_;  // Muestras desde el último anclaje
+
+    void anchorOscillator();
+    double oscillatorStep();
+
 public:
+    /// Muestras entre re-anclajes exactos del oscilador (cota del error de amplitud y fase)
+    static constexpr std::size_t kOscillatorAnchor = 256;
+
     /**
      * @brief Construye una señal sinusoidal.
      * @param Ts Periodo de muestreo [s].
@@ -222,10 +321,12 @@ public:
      * @param phase Fase inicial en radianes.
      * @param offset Desplazamiento vertical.
      * @param buffer_size Tamaño del buffer.
+     * @param mode Modo de cálculo de next() (analítico por defecto).
      */
     SineSignal(double Ts, double amplitude, double freq,
                double phase = 0.0, double offset = 0.0,
-               std::size_t buffer_size = 1024);
+               std::size_t buffer_size = 1024,
+               SineMode mode = SineMode::Analytic);
 
     /**
      * @brief Calcula el valor seno en el tiempo dado.
@@ -233,6 +334,40 @@ public:
      */
     double computeAt(double time) const override;
 
+    /**
+     * @brief Genera la siguiente muestra según el modo configurado.
+     *
+     * En SineMode::Oscillator la muestra se obtiene rotando el vector
+     * (cos, sin) un ángulo 2*pi*f*Ts (4 productos, sin std::sin). Cada
+     * kOscillatorAnchor muestras el estado se re-ancla con la fase exacta,
+     * acumulada en ciclos y reducida a [0, 1): el error no crece con la
+     * duración de la ejecución (ni por la rotación ni por la acumulación
+     * de t_ en coma flotante).
+     * @return Valor de la muestra actual (antes de avanzar t_).
+     */
+    double next() override;
+
+    /**
+     * @brief Bloque de seno en el modo configurado.
+     *
+     * Produce exactamente las mismas muestras que n llamadas a next(): en
+     * SineMode::Analytic con el mismo t_ acumulado, en SineMode::Oscillator
+     * con la misma rotación y los mismos re-anclajes.
+     */
+    void generate(double* out, std::size_t n) override;
+
+    /**
+     * @brief Reinicia t_, los buffers y el estado del oscilador.
+     */
+    void reset() override;
+
+    /**
+     * @brief Cambia el modo de cálculo; el oscilador se re-ancla en t_.
+     * @param mode Nuevo modo.
+     */
+    void setMode(SineMode mode);
+    SineMode mode() const { return mode_; }
+
     /**
      * @note Diseño: SineSignal es un ejemplo de señal analítica; observar cómo
      * computeAt no modifica el estado, lo cual facilita el razonamiento.
@@ -241,6 +376,10 @@ public:
     double& amplitude();
     const double& amplitude() const;
 
+    /**
+     * @note En modo oscilador, tras modificar frequency() o phase() hay que
+     * llamar a setMode(SineMode::Oscillator) para recalcular la rotación.
+     */
     double& frequency();
     const double& frequency() const;
 
@@ -251,8 +390,12 @@ public:
 class SignalMixer : public Signal {
     std::vector<std::shared_ptr<Signal>> signals_;
     std::vector<double> weights_;
+    std::vector<double> scratch_;   // Bloque de una señal hija (kMixerBlock)
 
 public:
+    /// Tamaño de bloque interno de generate() (scratch_ reservado en el constructor)
+    static constexpr std::size_t kMixerBlock = 256;
+
     SignalMixer(double Ts,
                 std::vector<std::shared_ptr<Signal>> signals,
                 std::vector<double> weights = {},
@@ -283,6 +426,14 @@ public:
      * @return Valor de la mezcla en la muestra avanzada.
      */
     double next() override;
+
+    /**
+     * @brief Genera cada señal hija por bloques y acumula la suma ponderada.
+     *
+     * Una llamada virtual por hija y bloque de kMixerBlock muestras, en
+     * lugar de una por hija y muestra. No reserva memoria.
+     */
+    void generate(double* out, std::size_t n) override;
 };
 
 } // namespace SignalGenerator
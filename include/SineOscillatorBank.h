@@ -0,0 +1,94 @@
+/**
+ * @file SineOscillatorBank.h
+ * @brief Banco de osciladores senoidales recursivos para muchos canales de referencia
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace SignalGenerator {
+
+/**
+ * @class SineOscillatorBank
+ * @brief N canales senoidales con el mismo Ts, calculados sin std::sin por muestra
+ *
+ * Cada canal es un oscilador por rotación:
+ * @verbatim
+ *   [c]      [cos w  -sin w] [c]        w = 2*pi*f*Ts
+ *   [s]  <-  [sin w   cos w] [s]        y = A*s + offset
+ * @endverbatim
+ *
+ * El estado se guarda como estructura de arrays (un vector por magnitud),
+ * de modo que el bucle sobre canales de step() es vectorizable (SIMD).
+ * Cada kAnchor muestras todos los canales se re-anclan con la fase exacta
+ * acumulada en ciclos y reducida a [0, 1), por lo que ni la amplitud ni la
+ * fase derivan en ejecuciones de días.
+ *
+ * Patrón de uso:
+ * @code{.cpp}
+ * SignalGenerator::SineOscillatorBank bank(0.001);
+ * bank.addChannel(1.0, 0.5);        // 1.0 * sin(2*pi*0.5*t)
+ * bank.addChannel(2.0, 3.0, 0.1);   // 2.0 * sin(2*pi*3*t + 0.1)
+ * std::vector<double> y(bank.channels());
+ * bank.step(y.data());               // una muestra de cada canal
+ * @endcode
+ */
+class SineOscillatorBank {
+public:
+    /// Muestras entre re-anclajes exactos
+    static constexpr std::size_t kAnchor = 256;
+
+    /**
+     * @brief Construye un banco vacío.
+     * @param Ts Periodo de muestreo común en segundos (> 0).
+     * @throw std::invalid_argument si Ts <= 0.
+     */
+    explicit SineOscillatorBank(double Ts);
+
+    /**
+     * @brief Añade un canal A*sin(2*pi*f*t + phase) + offset en la muestra actual.
+     * @return Índice del canal.
+     */
+    std::size_t addChannel(double amplitude, double freq,
+                           double phase = 0.0, double offset = 0.0);
+
+    /** @brief Número de canales */
+    std::size_t channels() const { return amp_.size(); }
+
+    /** @brief Muestras generadas desde la construcción o el último reset() */
+    std::size_t sampleIndex() const { return k_; }
+
+    /**
+     * @brief Calcula una muestra de todos los canales y avanza una muestra.
+     * @param out Array de channels() elementos.
+     */
+    void step(double* out);
+
+    /**
+     * @brief Genera n muestras de todos los canales.
+     * @param out Array de n*channels() elementos, out[k*channels() + c].
+     * @param n Número de muestras.
+     */
+    void generate(double* out, std::size_t n);
+
+    /** @brief Vuelve todos los canales a t = 0 */
+    void reset();
+
+private:
+    void anchor();
+
+    double Ts_;
+    std::size_t k_;             // Índice de muestra global
+    std::size_t since_anchor_;  // Muestras desde el último anclaje
+
+    std::vector<double> amp_, offset_, freq_, phase_;
+    std::vector<double> cos_, sin_;          // Estado (cos, sin) de cada canal
+    std::vector<double> rot_cos_, rot_sin_;  // Rotación por muestra
+    std::vector<double> cycles_;             // Fase de anclaje en ciclos [0, 1)
+};
+
+} // namespace SignalGenerator
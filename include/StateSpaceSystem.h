@@ -91,7 +91,12 @@ public:
      */
     const std::vector<double>& getState() const { return x_; }
 
+    /** @brief Variables de estado subnormales (diagnóstico, ver EntornoFP.h) */
+    size_t contarSubnormales() const override;
+
 protected:
+    friend class DiscreteSystem;   ///< nextDirecto<StateSpaceSystem>() llama a compute()
+
     /**
      * @brief Calcula la salida del sistema mediante las ecuaciones de estado
      * 
@@ -108,6 +113,12 @@ protected:
      */
     void resetState() override;
 
+    /**
+     * @brief Simula un bloque usando un vector x(k+1) preasignado
+     *        (compute() crea uno nuevo en cada muestra)
+     */
+    void computeBlock(const double* u, double* y, size_t n) override;
+
 private:
     std::vector<std::vector<double>> A_;  ///< Matriz de estado n×n
     std::vector<double> B_;               ///< Vector de entrada (tamaño n)
@@ -115,6 +126,7 @@ private:
     double D_;                            ///< Ganancia directa (escalar)
     std::vector<double> x_;               ///< Vector de estado actual x(k)
     size_t n_;                            ///< Orden del sistema (dimensión de x)
+    std::vector<double> xNext_;           ///< Espacio para x(k+1) en computeBlock()
 };
 
 /**
@@ -48,6 +48,9 @@ public:
      */
     double getLastOutput() const { return e_out_; }
 
+    /** @brief e(k) = ref(k) - y(k) no depende de muestras anteriores */
+    bool sinMemoria() const override { return true; }
+
     /**
      * @brief Calcula el error (función real con dos entradas)
      * @param ref Valor de referencia deseada
@@ -60,6 +63,8 @@ public:
     double compute(double ref, double y);
 
 protected:
+    friend class DiscreteSystem;   ///< nextDirecto<Sumador>() llama a compute()
+
     /**
      * @brief Método compute() de una sola entrada NO VÁLIDO para Sumador
      * 
@@ -80,6 +85,12 @@ protected:
      */
     void resetState() override;
 
+    /**
+     * @brief e = ref − y sobre un bloque (bucle vectorizable)
+     */
+    void computeBlock(const double* ref, const double* y, double* e, size_t n) override;
+    using DiscreteSystem::computeBlock;
+
 private:
     double e_out_; ///< Valor del error calculado e[k] = ref − y
 };
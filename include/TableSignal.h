@@ -0,0 +1,152 @@
+/**
+ * @file TableSignal.h
+ * @brief Señal de referencia reproducida desde una tabla precalculada
+ *        (fichero binario mapeado en memoria o array en memoria)
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "SignalGenerator.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace SignalGenerator {
+
+/** Interpolación entre muestras de la tabla */
+enum class TableInterp {
+    Linear,   ///< Lineal entre las dos muestras vecinas
+    Cubic     ///< Catmull-Rom con las cuatro muestras vecinas (C1, pasa por los nodos)
+};
+
+/** Comportamiento al pasar del final de la tabla */
+enum class TableEnd {
+    Hold,     ///< Mantiene la última muestra
+    Loop      ///< Vuelve al principio (periodo count * Ts_table)
+};
+
+/**
+ * @brief Cabecera del fichero binario de tabla (32 bytes, little-endian nativo)
+ *
+ * Tras la cabecera vienen @c count valores double consecutivos.
+ */
+struct TableFileHeader {
+    char magic[8];        ///< "DSTABLE1"
+    std::uint64_t count;  ///< Número de muestras
+    double Ts_table;      ///< Periodo de muestreo de la tabla [s]
+    std::uint64_t reserved;
+};
+
+/**
+ * @class TableSignal
+ * @brief Reproduce un perfil de referencia grabado
+ *
+ * La tabla no se copia nunca: o bien se mapea el fichero con mmap (solo
+ * lectura, MADV_SEQUENTIAL para que el kernel lea por delante y libere las
+ * páginas ya reproducidas), o bien se usa un array del llamador sin tomar
+ * su propiedad. La memoria propia es constante e independiente de la
+ * longitud del perfil, y abrir un fichero de varios GB es inmediato.
+ *
+ * Si el Ts de la señal difiere del de la tabla, se interpola (lineal o
+ * cúbica). Con Ts == Ts_table ambas interpolaciones devuelven las
+ * muestras de la tabla (salvo el redondeo acumulado en t_).
+ *
+ * Patrón de uso:
+ * @code{.cpp}
+ * SignalGenerator::TableSignal::writeFile("perfil.bin", 0.01, datos.data(), datos.size());
+ * SignalGenerator::TableSignal ref(0.001, "perfil.bin", SignalGenerator::TableInterp::Cubic);
+ * double r = ref.next();
+ * @endcode
+ *
+ * @note La primera lectura de cada página puede provocar un fallo de página
+ *       (lectura de disco) en el hilo que llama a next(). Para perfiles en
+ *       disco lento, precargar con prefetch() antes de arrancar.
+ */
+class TableSignal : public Signal {
+public:
+    /**
+     * @brief Reproduce un fichero de tabla mapeado en memoria.
+     * @param Ts Periodo de muestreo de la señal [s].
+     * @param path Fichero con cabecera TableFileHeader.
+     * @param interp Interpolación entre muestras.
+     * @param end Comportamiento al final de la tabla.
+     * @param offset Desplazamiento vertical.
+     * @param buffer_size Tamaño del buffer de historial.
+     * @throw std::runtime_error si el fichero no se puede abrir o mapear
+     *        o su cabecera no es válida.
+     */
+    TableSignal(double Ts, const std::string& path,
+                TableInterp interp = TableInterp::Linear,
+                TableEnd end = TableEnd::Hold,
+                double offset = 0.0, std::size_t buffer_size = 1024);
+
+    /**
+     * @brief Reproduce un array en memoria (no se copia ni se toma su propiedad).
+     * @param Ts Periodo de muestreo de la señal [s].
+     * @param data Muestras de la tabla; deben sobrevivir a la señal.
+     * @param count Número de muestras (>= 1).
+     * @param Ts_table Periodo de muestreo de la tabla [s] (> 0).
+     * @throw std::invalid_argument si data es nullptr, count == 0 o Ts_table <= 0.
+     */
+    TableSignal(double Ts, const double* data, std::size_t count, double Ts_table,
+                TableInterp interp = TableInterp::Linear,
+                TableEnd end = TableEnd::Hold,
+                double offset = 0.0, std::size_t buffer_size = 1024);
+
+    ~TableSignal() override;
+
+    TableSignal(const TableSignal&) = delete;
+    TableSignal& operator=(const TableSignal&) = delete;
+
+    /**
+     * @brief Escribe un fichero de tabla (cabecera + muestras).
+     * @throw std::runtime_error si no se puede escribir.
+     */
+    static void writeFile(const std::string& path, double Ts_table,
+                          const double* data, std::size_t count);
+
+    /**
+     * @brief Valor de la tabla interpolado en un tiempo dado.
+     * @param time Tiempo en segundos.
+     */
+    double computeAt(double time) const override;
+
+    /** @brief Bloque de muestras interpoladas sin llamadas virtuales por muestra. */
+    void generate(double* out, std::size_t n) override;
+
+    /**
+     * @brief Pide al kernel que lea por adelantado el tramo [t_, t_ + seconds].
+     *
+     * Solo tiene efecto con tablas mapeadas desde fichero (madvise WILLNEED).
+     * No llamar desde el hilo de tiempo real.
+     */
+    void prefetch(double seconds) const;
+
+    std::size_t count() const { return count_; }
+    double tableTs() const { return Ts_table_; }
+    double duration() const { return static_cast<double>(count_) * Ts_table_; }
+
+    TableInterp& interpolation() { return interp_; }
+    const TableInterp& interpolation() const { return interp_; }
+
+    TableEnd& endMode() { return end_; }
+    const TableEnd& endMode() const { return end_; }
+
+private:
+    double sampleAt(double position) const;
+    double at(std::ptrdiff_t i) const;
+
+    const double* data_;      // Muestras (mapa o array externo)
+    std::size_t count_;
+    double Ts_table_;
+    double inv_Ts_table_;
+    TableInterp interp_;
+    TableEnd end_;
+
+    void* map_;               // Región mapeada (nullptr si el array es externo)
+    std::size_t map_size_;
+};
+
+} // namespace SignalGenerator
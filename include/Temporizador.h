@@ -9,10 +9,30 @@
  */
 
 #pragma once
+#include <cstdint>
 #include <time.h>
 
 namespace DiscreteSystems {
 
+class TokenParada;
+
+/**
+ * @brief Instante en nanosegundos enteros
+ *
+ * Con int64 el contador da ~292 años de margen; las diferencias entre
+ * iteraciones son exactas por muy larga que sea la ejecución, a diferencia
+ * de los microsegundos en double.
+ */
+inline std::int64_t aNs(const struct timespec& ts) {
+    return static_cast<std::int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+/** @brief fin - inicio [ns] */
+inline std::int64_t difNs(const struct timespec& fin, const struct timespec& inicio) {
+    return (static_cast<std::int64_t>(fin.tv_sec) - inicio.tv_sec) * 1000000000LL
+         + (fin.tv_nsec - inicio.tv_nsec);
+}
+
 /**
  * @class Temporizador
  * @brief Gestiona retardos absolutos con clock_nanosleep para sistemas en tiempo real
@@ -34,6 +54,9 @@ namespace DiscreteSystems {
  * }
  * @endcode
  * 
+ * Con setParada(), las esperas duermen sobre el TokenParada en lugar de
+ * clock_nanosleep y terminan en cuanto se llama a TokenParada::detener().
+ *
  * @invariant next_ siempre apunta al siguiente instante absoluto de activación
  * @invariant No acumula error de temporización entre ciclos
  */
@@ -41,6 +64,7 @@ class Temporizador {
 private:
     struct timespec next_;      ///< Tiempo absoluto del próximo despertar
     long period_ns_;            ///< Período en nanosegundos
+    const TokenParada* parada_; ///< Interrumpe las esperas (nullptr = clock_nanosleep)
     
 public:
     /**
@@ -54,6 +78,18 @@ public:
      * @pre frequency > 0
      */
     explicit Temporizador(double frequency);
+
+    /**
+     * @brief Constructor con instante de partida absoluto
+     *
+     * objetivo() pasa a ser inicio; esperarObjetivo() duerme hasta él y
+     * cada esperar() posterior avanza un período desde ahí. Permite que
+     * varios hilos compartan la misma rejilla temporal (BaseTiempoComun).
+     *
+     * @param frequency Frecuencia en Hz (debe ser > 0)
+     * @param inicio Instante CLOCK_MONOTONIC del primer despertar
+     */
+    Temporizador(double frequency, const struct timespec& inicio);
     
     /**
      * @brief Constructor alternativo que acepta período de muestreo en segundos
@@ -71,12 +107,22 @@ public:
      * usando clock_nanosleep con TIMER_ABSTIME. Maneja overflow de nanosegundos
      * automáticamente.
      * 
-     * @return 0 si exitoso, código de error POSIX si falla
+     * @return 0 si exitoso, ECANCELED si el token de parada interrumpió la
+     *         espera, código de error POSIX si falla
      * 
      * @post next_ avanza exactamente un período
      * @post No acumula drift de temporización
      */
     int esperar();
+
+    /**
+     * @brief Duerme hasta objetivo() sin avanzar el período
+     * @return 0 si exitoso, ECANCELED si se detuvo, código de error POSIX si falla
+     */
+    int esperarObjetivo();
+
+    /** @brief Token cuyas paradas interrumpen esperar() (nullptr = ninguno) */
+    void setParada(const TokenParada* parada) { parada_ = parada; }
     
     /**
      * @brief Reinicia el temporizador al instante actual
@@ -85,6 +131,18 @@ public:
      * Obtiene el tiempo actual y lo asigna a next_.
      */
     void reiniciar();
+
+    /**
+     * @brief Instante absoluto del último despertar programado
+     *
+     * Tras esperar() es el instante hasta el que se durmió; restándolo del
+     * instante real de inicio de la iteración se obtiene la latencia de
+     * despertar sin llamadas adicionales al reloj.
+     */
+    const struct timespec& objetivo() const { return next_; }
+
+    /** @brief Período con el que avanza esperar() [ns] */
+    std::int64_t periodoNs() const { return period_ns_; }
 };
 
 } // namespace DiscreteSystems
@@ -0,0 +1,137 @@
+/**
+ * @file TimingStats.h
+ * @brief Estadísticas e histograma de tiempos (ns) para los hilos de tiempo real
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Acumula mínimo, máximo, media, desviación típica e histograma log-lineal
+ * de una magnitud temporal sin reservar memoria ni tomar locks, de modo que
+ * puede registrarse en cada iteración de un hilo periódico.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <time.h>
+
+namespace DiscreteSystems {
+
+/**
+ * @class TimingStats
+ * @brief Histograma log-lineal de un único escritor con lectura concurrente
+ *
+ * Los valores se registran en nanosegundos con signo. Mínimo, máximo, media
+ * y desviación usan el valor con signo; el histograma usa |valor| con 16
+ * sub-intervalos por octava (error relativo de percentil <= 1/16) hasta
+ * 2^40 ns (~18 minutos).
+ *
+ * Solo un hilo debe llamar a record(). Cualquier otro hilo puede leer en
+ * paralelo: cada contador es atómico (relaxed), así que una lectura en
+ * caliente es aproximada pero nunca inconsistente en memoria.
+ *
+ * @code{.cpp}
+ * TimingStats st;
+ * st.record(1250);                 // 1.25 us
+ * double p99 = st.percentile(99);  // ns
+ * @endcode
+ */
+class TimingStats {
+public:
+    static constexpr int kSubBits = 4;                          ///< log2(sub-intervalos por octava)
+    static constexpr int kSub = 1 << kSubBits;                  ///< Sub-intervalos por octava
+    static constexpr int kMaxBit = 40;                          ///< Octava máxima (2^40 ns)
+    static constexpr int kBins = kSub + (kMaxBit - kSubBits + 1) * kSub;
+
+    TimingStats();
+
+    /** @brief Registra un valor en nanosegundos (solo desde el hilo escritor) */
+    void record(std::int64_t ns);
+
+    /** @brief Vacía las estadísticas (solo desde el hilo escritor o con el hilo parado) */
+    void reset();
+
+    std::uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    std::int64_t min() const;
+    std::int64_t max() const;
+    double mean() const;
+    double stddev() const;
+
+    /**
+     * @brief Percentil de |valor| a partir del histograma
+     * @param p Percentil en [0, 100]
+     * @return Punto medio del intervalo que contiene el percentil [ns] (0 si vacío)
+     */
+    double percentile(double p) const;
+
+    /** @brief Índice de intervalo para un valor no negativo */
+    static int binIndex(std::uint64_t v);
+    /** @brief Límite inferior del intervalo i [ns] */
+    static std::uint64_t binLower(int i);
+
+    /** @brief Número de muestras del intervalo i */
+    std::uint64_t binCount(int i) const { return bins_[i].load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Resumen JSON: count, min, max, mean, stddev, p50, p90, p99, p999 (ns)
+     */
+    std::string toJson() const;
+
+private:
+    std::atomic<std::uint64_t> count_;
+    std::atomic<std::int64_t> min_;
+    std::atomic<std::int64_t> max_;
+    std::atomic<double> sum_;
+    std::atomic<double> sumsq_;
+    std::array<std::atomic<std::uint64_t>, kBins> bins_;
+};
+
+/**
+ * @struct HiloTiming
+ * @brief Estadísticas de temporización que cada hilo periódico acumula
+ *
+ * - wake_latency: t0 (inicio real de la iteración) - instante objetivo del Temporizador
+ * - drift: Ts_real - periodo (jitter del periodo)
+ * - total: t_total de la iteración
+ * - input_age: antigüedad de la entrada al leerla (lectura - escritura del productor)
+ * - source_age: antigüedad respecto a la muestra de ref de origen (lectura - t_origen)
+ *
+ * input_age y source_age solo se registran si el hilo tiene marcas de
+ * propagación (ConfigHilo); con dos entradas se registra la más antigua.
+ */
+struct HiloTiming {
+    TimingStats wake_latency;  ///< Latencia de despertar [ns]
+    TimingStats drift;         ///< Desviación del periodo [ns]
+    TimingStats total;         ///< Duración de la iteración [ns]
+    TimingStats input_age;     ///< Antigüedad de la entrada en el salto [ns]
+    TimingStats source_age;    ///< Antigüedad desde la muestra de ref de origen [ns]
+
+    /**
+     * @brief Registra una iteración (desde el propio hilo)
+     * @param objetivo Instante absoluto en el que debía despertar (Temporizador::objetivo())
+     * @param t0 Instante real de inicio de la iteración
+     * @param ts_real_ns Periodo real medido [ns]
+     * @param periodo_ns Periodo nominal [ns]
+     * @param t_total_ns Duración de la iteración [ns]
+     * @param primera true en la primera iteración (sin periodo previo que comparar)
+     */
+    void record(const struct timespec& objetivo, const struct timespec& t0,
+                std::int64_t ts_real_ns, std::int64_t periodo_ns, std::int64_t t_total_ns, bool primera);
+
+    /**
+     * @brief Registra la antigüedad de una entrada (desde el propio hilo)
+     * @param t_escritura_ns Instante de escritura de la entrada [ns]
+     * @param t_origen_ns Instante de la muestra de ref de origen [ns]
+     * @param ahora_ns Instante de lectura [ns]
+     */
+    void recordEdad(std::int64_t t_escritura_ns, std::int64_t t_origen_ns, std::int64_t ahora_ns);
+
+    void reset();
+
+    /** @brief Objeto JSON con todas las estadísticas */
+    std::string toJson() const;
+};
+
+} // namespace DiscreteSystems
@@ -0,0 +1,78 @@
+/**
+ * @file TokenParada.h
+ * @brief Orden de parada sin locks que despierta a los hilos dormidos
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * @code{.cpp}
+ * ConfigHilo cfg;
+ * cfg.parada = &TokenParada::proceso();
+ * Hilo hiloDA(da, u, ua, running, mtx, 1000.0, "hiloDA", cfg);
+ * TokenParada::proceso().detener();       // todos los hilos salen ya
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <time.h>
+
+namespace DiscreteSystems {
+
+/**
+ * @class TokenParada
+ * @brief Bandera de parada de un grupo de hilos con espera interrumpible
+ *
+ * Palabra atómica de 32 bits: detenido() es una carga acquire y los hilos
+ * duermen sobre ella con futex(FUTEX_WAIT_BITSET) hasta su siguiente
+ * instante absoluto (CLOCK_MONOTONIC), así que detener() los despierta sin
+ * esperar al final del periodo. detener() es async-signal-safe (un store atómico y una llamada futex):
+ * puede llamarse desde un manejador de señal. proceso() se construye en
+ * instalar_manejador_signal(), antes de instalar el manejador, para que la
+ * guarda de inicialización del static no se ejecute nunca dentro de él.
+ */
+class TokenParada {
+public:
+    TokenParada() : estado_(0) {}
+
+    TokenParada(const TokenParada&) = delete;
+    TokenParada& operator=(const TokenParada&) = delete;
+
+    /** @brief true si se ha pedido la parada (carga acquire, sin locks) */
+    bool detenido() const { return estado_.load(std::memory_order_acquire) != 0; }
+
+    /** @brief Pide la parada y despierta a todos los hilos que esperan */
+    void detener();
+
+    /** @brief Vuelve a dejar el token en marcha (para reutilizarlo en otra ejecución) */
+    void rearmar() { estado_.store(0, std::memory_order_release); }
+
+    /**
+     * @brief Duerme hasta el instante absoluto t (CLOCK_MONOTONIC) o hasta detener()
+     * @return true si se detuvo, false si se alcanzó t
+     * @note Si futex falla con un error inesperado duerme hasta t sin poder
+     *       interrumpirse y devuelve detenido(), en lugar de reintentar en bucle.
+     */
+    bool esperarHasta(const struct timespec& t) const;
+
+    /** @brief Duerme hasta detener(), sin timeout */
+    void esperar() const;
+
+    /**
+     * @brief Token del proceso
+     *
+     * Lo detienen el manejador de SIGINT/SIGTERM (instalar_manejador_signal())
+     * e InterruptorArranque::setRun(0); setRun(1) lo rearma salvo tras una señal.
+     */
+    static TokenParada& proceso();
+
+private:
+    std::atomic<std::uint32_t> estado_;   ///< 0 = en marcha, 1 = detenido (palabra futex)
+};
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t) &&
+              std::atomic<std::uint32_t>::is_always_lock_free,
+              "TokenParada: la palabra futex debe ser un uint32_t sin locks");
+
+} // namespace DiscreteSystems
@@ -0,0 +1,157 @@
+/**
+ * @file Tracer.h
+ * @brief Trazador de eventos por hilo exportable a Chrome Trace / Perfetto
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * Registra intervalos (iteración de cada hilo, espera de mutex, next(),
+ * envíos/recepciones IPC) en buffers por hilo sin locks y los exporta en
+ * formato Chrome Trace Event JSON, de modo que todos los hilos del lazo se
+ * ven alineados en una única línea de tiempo (chrome://tracing o
+ * ui.perfetto.dev).
+ *
+ * Coste:
+ * - Compilado fuera (cmake -DDS_TRACE=OFF → DS_TRACE_DISABLED): las macros
+ *   DS_TRACE_* desaparecen.
+ * - Compilado pero deshabilitado (por defecto): una carga atómica relajada
+ *   por punto de traza.
+ * - Habilitado: una escritura de 24 bytes en el buffer del hilo. Los
+ *   intervalos se registran con los timestamps que el hilo ya mide.
+ *
+ * @code{.cpp}
+ * DiscreteSystems::Tracer::habilitar(true);
+ * // ... hilos en ejecución ...
+ * DiscreteSystems::Tracer::exportarJson("traza.json");
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <time.h>
+
+namespace DiscreteSystems {
+
+/**
+ * @struct TraceEvent
+ * @brief Evento de la traza
+ */
+struct TraceEvent {
+    const char* name;      ///< Nombre (literal de duración estática)
+    std::int64_t ts_ns;    ///< Inicio, CLOCK_MONOTONIC [ns]
+    std::int64_t dur_ns;   ///< Duración [ns]; < 0 para eventos instantáneos
+};
+
+/**
+ * @class Tracer
+ * @brief Registro global de buffers de eventos, uno por hilo
+ *
+ * Cada hilo escribe solo en su buffer (creado en su primer evento) y
+ * publica el número de eventos con una escritura release; exportarJson()
+ * puede llamarse en cualquier momento, también con los hilos en marcha.
+ * Cuando un buffer se llena, los eventos nuevos se descartan y se cuentan
+ * en eventosDescartados() (una traza completa es más útil que una truncada
+ * por el principio).
+ */
+class Tracer {
+public:
+    /** @brief Habilita o deshabilita el registro en tiempo de ejecución */
+    static void habilitar(bool on) { enabled_.store(on, std::memory_order_relaxed); }
+
+    /** @brief true si el registro está habilitado */
+    static bool habilitado() { return enabled_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Eventos por hilo (por defecto 65536, ~1.5 MB)
+     * @note Solo afecta a los buffers creados después de la llamada
+     */
+    static void setCapacidad(std::size_t eventos_por_hilo);
+
+    /** @brief Nombre del hilo actual en la traza (p. ej. el prefijo de log) */
+    static void nombrarHilo(const std::string& nombre);
+
+    /** @brief Intervalo [ini, fin] en el hilo actual */
+    static void completo(const char* name, std::int64_t ini_ns, std::int64_t fin_ns);
+
+    /** @brief Intervalo [ini, fin] en el hilo actual (timespec CLOCK_MONOTONIC) */
+    static void completo(const char* name, const struct timespec& ini, const struct timespec& fin) {
+        completo(name, toNs(ini), toNs(fin));
+    }
+
+    /** @brief Evento instantáneo en el hilo actual */
+    static void instantaneo(const char* name);
+
+    /**
+     * @brief Escribe todos los buffers en formato Chrome Trace Event JSON
+     * @return false si no se pudo abrir el fichero
+     */
+    static bool exportarJson(const std::string& path);
+
+    /** @brief Vacía todos los buffers (con los hilos parados) */
+    static void limpiar();
+
+    /** @brief Total de eventos descartados por buffers llenos */
+    static std::uint64_t eventosDescartados();
+
+    /** @brief Instante actual CLOCK_MONOTONIC [ns] */
+    static std::int64_t ahoraNs() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return toNs(ts);
+    }
+
+private:
+    static std::int64_t toNs(const struct timespec& ts) {
+        return static_cast<std::int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    }
+
+    static void push(const char* name, std::int64_t ts_ns, std::int64_t dur_ns);
+
+    static inline std::atomic<bool> enabled_{false};
+};
+
+/**
+ * @class TraceScope
+ * @brief Intervalo RAII: registra [construcción, destrucción] si el
+ *        trazador estaba habilitado al construirse
+ */
+class TraceScope {
+public:
+    explicit TraceScope(const char* name)
+        : name_(name), t0_(Tracer::habilitado() ? Tracer::ahoraNs() : -1) {}
+    ~TraceScope() {
+        if (t0_ >= 0) Tracer::completo(name_, t0_, Tracer::ahoraNs());
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+private:
+    const char* name_;
+    std::int64_t t0_;
+};
+
+} // namespace DiscreteSystems
+
+// ---- Puntos de traza (desaparecen con DS_TRACE_DISABLED) ----
+#ifndef DS_TRACE_DISABLED
+#define DS_TRACE_CONCAT_(a, b) a##b
+#define DS_TRACE_CONCAT(a, b) DS_TRACE_CONCAT_(a, b)
+/// Intervalo hasta el final del ámbito actual
+#define DS_TRACE_SCOPE(name) \
+    ::DiscreteSystems::TraceScope DS_TRACE_CONCAT(ds_trace_scope_, __LINE__)(name)
+/// Intervalo con timestamps ya medidos (timespec o ns)
+#define DS_TRACE_COMPLETE(name, ini, fin) \
+    do { if (::DiscreteSystems::Tracer::habilitado()) ::DiscreteSystems::Tracer::completo(name, ini, fin); } while (0)
+/// Evento instantáneo
+#define DS_TRACE_INSTANT(name) \
+    do { if (::DiscreteSystems::Tracer::habilitado()) ::DiscreteSystems::Tracer::instantaneo(name); } while (0)
+/// Nombre del hilo actual en la traza
+#define DS_TRACE_THREAD_NAME(nombre) ::DiscreteSystems::Tracer::nombrarHilo(nombre)
+#else
+#define DS_TRACE_SCOPE(name) ((void)0)
+#define DS_TRACE_COMPLETE(name, ini, fin) ((void)0)
+#define DS_TRACE_INSTANT(name) ((void)0)
+#define DS_TRACE_THREAD_NAME(nombre) ((void)0)
+#endif
@@ -64,7 +64,12 @@ public:
      */
     const std::vector<double>& getDenominator() const { return a_; }
 
+    /** @brief Variables de estado subnormales (diagnóstico, ver EntornoFP.h) */
+    size_t contarSubnormales() const override;
+
 protected:
+    friend class DiscreteSystem;   ///< nextDirecto<TransferFunctionSystem>() llama a compute()
+
     /**
      * @brief Calcula la salida del sistema mediante la ecuación en diferencias
      * @param uk Entrada en el paso k
@@ -77,6 +82,12 @@ protected:
      */
     void resetState() override;
 
+    /**
+     * @brief Ecuación en diferencias sobre un bloque, con los historiales
+     *        accedidos por puntero y los tamaños fuera del bucle
+     */
+    void computeBlock(const double* u, double* y, size_t n) override;
+
 private:
     std::vector<double> b_;       ///< Coeficientes del numerador (normalizados)
     std::vector<double> a_;       ///< Coeficientes del denominador (normalizados, a[0] = 1)
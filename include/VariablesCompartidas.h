@@ -10,6 +10,7 @@
 
 #pragma once
 #include <pthread.h>
+#include "MarcaTemporal.h"
 
 /**
  * @class VariablesCompartidas
@@ -67,11 +68,25 @@ public:
     double ykd;     ///< Salida de la planta digitalizada tras conversor A/D
     bool running;   ///< Indicador de ejecución del lazo (true=ejecutando, false=detener)
 
+    // ========================================
+    // Marcas de propagación (una por variable)
+    // ========================================
+    // Generación, instante de origen en ref e instante de escritura de cada
+    // valor. Los hilos las actualizan si se les pasan en ConfigHilo
+    // (HiloPID usa siempre marca_e y marca_u). Protegidas por mtx.
+
+    MarcaTemporal marca_ref;  ///< Marca de ref
+    MarcaTemporal marca_e;    ///< Marca de e
+    MarcaTemporal marca_u;    ///< Marca de u
+    MarcaTemporal marca_ua;   ///< Marca de ua
+    MarcaTemporal marca_yk;   ///< Marca de yk
+    MarcaTemporal marca_ykd;  ///< Marca de ykd
+
     // ========================================
     // Sincronización
     // ========================================
     
-    /// Mutex POSIX que protege acceso a ref, e, u, ua, yk, ykd, running
+    /// Mutex POSIX que protege acceso a ref, e, u, ua, yk, ykd, running y sus marcas
     /// @warning CRÍTICO: Siempre usar lock_guard o pthread_mutex_lock antes de acceder a variables
     /// 
     /// Patrón seguro:
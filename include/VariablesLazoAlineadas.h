@@ -0,0 +1,124 @@
+/**
+ * @file VariablesLazoAlineadas.h
+ * @brief Variables del lazo con una línea de caché por productor (sin mutex)
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ *
+ * @code{.cpp}
+ * VariablesLazoAlineadas vars;
+ * vars.u.publicar(u, origen_ns, MarcaTemporal::ahoraNs());   // solo el PID
+ * double e = vars.e.leer();                                   // cualquier consumidor
+ * @endcode
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "MarcaTemporal.h"
+
+/// Tamaño de línea de caché supuesto (x86-64 y la mayoría de AArch64)
+constexpr std::size_t kLineaCache = 64;
+
+/**
+ * @struct CanalLazoBase
+ * @brief Una variable del lazo con un único escritor, protegida por un seqlock
+ *
+ * El escritor incrementa seq a impar, escribe valor y marca y lo deja par.
+ * El lector repite la lectura si seq era impar o ha cambiado entre medias,
+ * así que nunca ve un valor de una escritura y la marca de otra. Ni el
+ * escritor ni el lector se bloquean.
+ *
+ * @tparam Alineacion kLineaCache para una línea por canal; alignof(double)
+ *         para la versión empaquetada
+ *
+ * @code{.cpp}
+ * VariablesLazoAlineadas vars;
+ * vars.u.publicar(u, origen_ns, MarcaTemporal::ahoraNs());   // hilo PID
+ *
+ * double u; MarcaTemporal m;
+ * vars.u.leer(u, m);                                          // hilo D/A
+ * @endcode
+ */
+template <std::size_t Alineacion>
+struct alignas(Alineacion) CanalLazoBase {
+    std::atomic<std::uint64_t> seq{0};  ///< Par = estable, impar = escritura en curso
+    double valor = 0.0;                 ///< Valor de la variable
+    MarcaTemporal marca;                ///< Generación, origen y escritura del valor
+
+    /** @brief Escribe valor y marca (un único hilo escritor por canal) */
+    void publicar(double v, std::int64_t origen_ns, std::int64_t ahora_ns) {
+        const std::uint64_t s = seq.load(std::memory_order_relaxed);
+        seq.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        valor = v;
+        marca.marcar(origen_ns, ahora_ns);
+        seq.store(s + 2, std::memory_order_release);
+    }
+
+    /** @brief Lee valor y marca de una misma escritura */
+    void leer(double& v, MarcaTemporal& m) const {
+        std::uint64_t s;
+        do {
+            s = seq.load(std::memory_order_acquire);
+            v = valor;
+            m = marca;
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((s & 1) != 0 || seq.load(std::memory_order_relaxed) != s);
+    }
+
+    /** @brief Lee solo el valor */
+    double leer() const {
+        double v;
+        MarcaTemporal m;
+        leer(v, m);
+        return v;
+    }
+};
+
+using CanalLazo = CanalLazoBase<kLineaCache>;
+using CanalLazoEmpaquetado = CanalLazoBase<alignof(double)>;
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "CanalLazo necesita atomic<uint64_t> sin locks");
+static_assert(sizeof(CanalLazo) == kLineaCache, "CanalLazo debe ocupar exactamente una línea");
+static_assert(sizeof(CanalLazoEmpaquetado) == 40, "CanalLazoEmpaquetado no debe llevar relleno");
+
+/**
+ * @struct VariablesLazoBase
+ * @brief ref, e, u, ua, yk, ykd y running, cada uno con la alineación de Canal
+ *
+ * Mismo papel que VariablesCompartidas pero sin mutex: cada canal tiene un
+ * único escritor y running es atómico. Con CanalLazo cada canal ocupa su
+ * propia línea, así que un productor no invalida la de los demás (false
+ * sharing); VariablesLazoEmpaquetadas es la referencia sin relleno
+ * (benchClosedLoop --layout empaquetado | alineado).
+ *
+ * @verbatim
+ *   offset   0  ref  [seq | valor | marca]  escribe: referencia
+ *   offset  64  e    [seq | valor | marca]  escribe: sumador
+ *   offset 128  u    [seq | valor | marca]  escribe: PID
+ *   offset 192  ua   [seq | valor | marca]  escribe: D/A
+ *   offset 256  yk   [seq | valor | marca]  escribe: planta
+ *   offset 320  ykd  [seq | valor | marca]  escribe: A/D
+ *   offset 384  running                     escribe: quien para el lazo
+ * @endverbatim
+ */
+template <class Canal>
+struct VariablesLazoBase {
+    Canal ref;   ///< Referencia
+    Canal e;     ///< Error ref - ykd
+    Canal u;     ///< Salida del PID
+    Canal ua;    ///< Acción de control tras el D/A
+    Canal yk;    ///< Salida de la planta
+    Canal ykd;   ///< Salida de la planta tras el A/D
+    alignas(Canal) std::atomic<bool> running{true};  ///< false = detener el lazo
+};
+
+using VariablesLazoAlineadas = VariablesLazoBase<CanalLazo>;
+using VariablesLazoEmpaquetadas = VariablesLazoBase<CanalLazoEmpaquetado>;
+
+static_assert(sizeof(VariablesLazoAlineadas) == 7 * kLineaCache,
+              "VariablesLazoAlineadas: una línea por variable");
@@ -6,6 +6,7 @@
  */
 
 #include "ADConverter.h"
+#include "Diagnostico.h"
 
 namespace DiscreteSystems {
 
@@ -18,7 +19,7 @@ namespace DiscreteSystems {
 ADConverter::ADConverter(double Ts, size_t bufferSize)
     : DiscreteSystem(Ts, bufferSize), u_prev_(0.0)
 {
-    std::cout << "Objeto de tipo ADConverter creado correctamente" << std::endl;
+    DS_DIAG("Objeto de tipo ADConverter creado correctamente");
 }
 
 /**
@@ -45,7 +46,7 @@ double ADConverter::compute(double uk)
 void ADConverter::resetState()
 {
     u_prev_ = 0.0;
-    std::cout << "ResetState de ADConverter ejecutado" << std::endl;
+    DS_DIAG("ResetState de ADConverter ejecutado");
 }
 
 } // namespace DiscreteSystems
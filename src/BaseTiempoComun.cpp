@@ -0,0 +1,118 @@
+/**
+ * @file BaseTiempoComun.cpp
+ * @brief Implementación de la barrera de arranque y del desfase por etapa
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/BaseTiempoComun.h"
+#include "../include/TokenParada.h"
+
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+namespace DiscreteSystems {
+
+namespace {
+
+struct timespec sumarNs(struct timespec t, long ns) {
+    t.tv_sec += ns / 1000000000L;
+    t.tv_nsec += ns % 1000000000L;
+    if (t.tv_nsec >= 1000000000L) {
+        t.tv_sec++;
+        t.tv_nsec -= 1000000000L;
+    }
+    return t;
+}
+
+} // namespace
+
+// ============================================================================
+// BaseTiempoComun
+// ============================================================================
+
+BaseTiempoComun::BaseTiempoComun(std::size_t participantes, double margen_s)
+    : participantes_(participantes), llegados_(0),
+      margen_ns_(static_cast<long>(margen_s * 1e9)), iniciada_(false), t0_{0, 0}
+{
+    if (participantes == 0 || margen_s < 0.0) {
+        throw std::invalid_argument("BaseTiempoComun: argumentos inválidos");
+    }
+}
+
+struct timespec BaseTiempoComun::esperarInicio(const TokenParada* parada) {
+    std::unique_lock<std::mutex> lock(mtx_);
+    if (!iniciada_ && ++llegados_ >= participantes_) {
+        fijarInicio();
+    }
+    if (!parada) {
+        cv_.wait(lock, [this] { return iniciada_; });
+        return t0_;
+    }
+    // detener() no notifica cv_: se sondea el token entre esperas cortas
+    while (!iniciada_) {
+        if (parada->detenido()) {
+            --llegados_;
+            struct timespec ahora;
+            clock_gettime(CLOCK_MONOTONIC, &ahora);
+            return ahora;
+        }
+        cv_.wait_for(lock, std::chrono::milliseconds(5));
+    }
+    return t0_;
+}
+
+void BaseTiempoComun::arrancar() {
+    std::lock_guard<std::mutex> lock(mtx_);
+    if (!iniciada_) {
+        fijarInicio();
+    }
+}
+
+bool BaseTiempoComun::iniciada() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return iniciada_;
+}
+
+struct timespec BaseTiempoComun::inicio() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return t0_;
+}
+
+void BaseTiempoComun::fijarInicio() {
+    struct timespec ahora;
+    clock_gettime(CLOCK_MONOTONIC, &ahora);
+    t0_ = sumarNs(ahora, margen_ns_);
+    iniciada_ = true;
+    cv_.notify_all();
+}
+
+// ============================================================================
+// Desfases y temporizador de los hilos
+// ============================================================================
+
+double faseLazo(EtapaLazo etapa, double periodo_s) {
+    return periodo_s * static_cast<double>(static_cast<int>(etapa)) / 6.0;
+}
+
+Temporizador crearTemporizador(double frequency, const ConfigHilo& config) {
+    if (!config.base_tiempo) {
+        Temporizador timer(frequency);
+        timer.setParada(config.parada);
+        return timer;
+    }
+    // Se ejecuta dentro de run(): se reduce la fase al periodo en vez de lanzar
+    const double periodo_s = 1.0 / frequency;
+    double fase_s = std::fmod(config.fase_s, periodo_s);
+    if (fase_s < 0.0) {
+        fase_s += periodo_s;
+    }
+    struct timespec t0 = config.base_tiempo->esperarInicio(config.parada);
+    Temporizador timer(frequency, sumarNs(t0, static_cast<long>(fase_s * 1e9)));
+    timer.setParada(config.parada);
+    timer.esperarObjetivo();
+    return timer;
+}
+
+} // namespace DiscreteSystems
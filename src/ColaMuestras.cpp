@@ -0,0 +1,23 @@
+/**
+ * @file ColaMuestras.cpp
+ * @brief Registrador de muestras sin locks
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/ColaMuestras.h"
+
+#include <stdexcept>
+
+namespace DiscreteSystems {
+
+ColaMuestras::ColaMuestras(std::size_t capacidad)
+    : muestras_(nullptr), mascara_(capacidad - 1), cola_(0), cabeza_(0), descartadas_(0)
+{
+    if (capacidad < 2 || (capacidad & (capacidad - 1)) != 0) {
+        throw std::invalid_argument("ColaMuestras: la capacidad debe ser potencia de 2");
+    }
+    muestras_.reset(new Sample[capacidad]());
+}
+
+} // namespace DiscreteSystems
@@ -0,0 +1,218 @@
+/**
+ * @file ContadoresHW.cpp
+ * @brief Implementación de los contadores hardware por hilo (perf_event_open)
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/ContadoresHW.h"
+
+#include <cxxabi.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+namespace DiscreteSystems {
+
+namespace {
+
+int abrirEvento(std::uint64_t config, int group_fd) {
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = group_fd < 0 ? 1 : 0;   // El líder arranca el grupo
+    attr.exclude_kernel = 1;                // Permitido con perf_event_paranoid <= 2
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // pid = 0, cpu = -1: el hilo actual en cualquier CPU
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+struct Registro {
+    std::mutex mtx;
+    std::vector<std::shared_ptr<EstadisticasHW>> hilos;
+};
+
+Registro& registro() {
+    static Registro r;
+    return r;
+}
+
+} // namespace
+
+// ============================================================================
+// ContadoresHW
+// ============================================================================
+
+ContadoresHW::ContadoresHW() : fd_lider_(-1), abiertos_(0) {
+    const std::uint64_t configs[kEventos] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    for (int i = 0; i < kEventos; ++i) {
+        fds_[i] = -1;
+        indice_[i] = -1;
+    }
+
+    fds_[0] = abrirEvento(configs[0], -1);
+    if (fds_[0] < 0) {
+        return;   // Sin PMU o sin permisos: inactivo
+    }
+    fd_lider_ = fds_[0];
+    indice_[0] = abiertos_++;
+
+    for (int i = 1; i < kEventos; ++i) {
+        fds_[i] = abrirEvento(configs[i], fd_lider_);
+        if (fds_[i] >= 0) {
+            indice_[i] = abiertos_++;
+        }
+    }
+
+    ioctl(fd_lider_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(fd_lider_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+ContadoresHW::~ContadoresHW() {
+    for (int i = kEventos - 1; i >= 0; --i) {
+        if (fds_[i] >= 0) {
+            close(fds_[i]);
+        }
+    }
+}
+
+bool ContadoresHW::leer(LecturaHW& lectura) const {
+    if (fd_lider_ < 0) {
+        return false;
+    }
+    // Formato de grupo: nr, time_enabled, time_running, valores[nr]
+    std::uint64_t buf[3 + kEventos];
+    ssize_t n = read(fd_lider_, buf, sizeof(buf));
+    if (n < static_cast<ssize_t>((3 + abiertos_) * sizeof(std::uint64_t))) {
+        return false;
+    }
+    auto valor = [&](int evento) -> std::uint64_t {
+        return indice_[evento] >= 0 ? buf[3 + indice_[evento]] : 0;
+    };
+    lectura.ciclos = valor(0);
+    lectura.instrucciones = valor(1);
+    lectura.fallos_cache = valor(2);
+    lectura.fallos_salto = valor(3);
+    lectura.ns_cpu = buf[2];
+    return true;
+}
+
+// ============================================================================
+// EstadisticasHW / RegistroHW
+// ============================================================================
+
+void EstadisticasHW::sumar(const LecturaHW& d) {
+    // Un único escritor: load + store relajados (sin RMW atómico)
+    auto add = [](std::atomic<std::uint64_t>& a, std::uint64_t v) {
+        a.store(a.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+    };
+    add(llamadas, 1);
+    add(ciclos, d.ciclos);
+    add(instrucciones, d.instrucciones);
+    add(fallos_cache, d.fallos_cache);
+    add(fallos_salto, d.fallos_salto);
+    add(ns_cpu, d.ns_cpu);
+}
+
+std::shared_ptr<EstadisticasHW> RegistroHW::registrar(const std::string& tipo) {
+    auto stats = std::make_shared<EstadisticasHW>();
+    stats->tipo = tipo;
+    Registro& r = registro();
+    std::lock_guard<std::mutex> lock(r.mtx);
+    r.hilos.push_back(stats);
+    return stats;
+}
+
+std::vector<RegistroHW::Resumen> RegistroHW::resumen() {
+    std::map<std::string, Resumen> por_tipo;
+    {
+        Registro& r = registro();
+        std::lock_guard<std::mutex> lock(r.mtx);
+        for (const auto& h : r.hilos) {
+            Resumen& s = por_tipo[h->tipo];
+            s.tipo = h->tipo;
+            s.llamadas += h->llamadas.load(std::memory_order_relaxed);
+            s.ciclos += h->ciclos.load(std::memory_order_relaxed);
+            s.instrucciones += h->instrucciones.load(std::memory_order_relaxed);
+            s.fallos_cache += h->fallos_cache.load(std::memory_order_relaxed);
+            s.fallos_salto += h->fallos_salto.load(std::memory_order_relaxed);
+            s.ns_cpu += h->ns_cpu.load(std::memory_order_relaxed);
+        }
+    }
+    std::vector<Resumen> out;
+    for (const auto& kv : por_tipo) {
+        out.push_back(kv.second);
+    }
+    return out;
+}
+
+std::string RegistroHW::toJson() {
+    std::ostringstream os;
+    os << "[";
+    auto lista = resumen();
+    for (std::size_t i = 0; i < lista.size(); ++i) {
+        const Resumen& s = lista[i];
+        os << (i ? ", " : "") << "{\"tipo\": \"" << s.tipo << "\", \"llamadas\": " << s.llamadas
+           << ", \"ciclos\": " << s.ciclos << ", \"instrucciones\": " << s.instrucciones
+           << ", \"fallos_cache\": " << s.fallos_cache << ", \"fallos_salto\": " << s.fallos_salto
+           << ", \"ns_cpu\": " << s.ns_cpu << ", \"ipc\": " << s.ipc() << ", \"ghz\": " << s.ghz() << "}";
+    }
+    os << "]";
+    return os.str();
+}
+
+std::string RegistroHW::nombreTipo(const std::type_info& tipo) {
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(tipo.name(), nullptr, nullptr, &status);
+    std::string nombre = (status == 0 && demangled) ? demangled : tipo.name();
+    std::free(demangled);
+    std::size_t pos = nombre.rfind("::");
+    return pos == std::string::npos ? nombre : nombre.substr(pos + 2);
+}
+
+// ============================================================================
+// MedidorHW
+// ============================================================================
+
+bool MedidorHW::iniciar(const std::type_info& tipo) {
+    auto contadores = std::make_unique<ContadoresHW>();
+    if (!contadores->disponible()) {
+        return false;
+    }
+    contadores_ = std::move(contadores);
+    stats_ = RegistroHW::registrar(RegistroHW::nombreTipo(tipo));
+    return true;
+}
+
+void MedidorHW::despues() {
+    if (!contadores_ || !valida_) {
+        return;
+    }
+    LecturaHW ahora;
+    if (!contadores_->leer(ahora)) {
+        return;
+    }
+    LecturaHW d;
+    d.ciclos = ahora.ciclos - previa_.ciclos;
+    d.instrucciones = ahora.instrucciones - previa_.instrucciones;
+    d.fallos_cache = ahora.fallos_cache - previa_.fallos_cache;
+    d.fallos_salto = ahora.fallos_salto - previa_.fallos_salto;
+    d.ns_cpu = ahora.ns_cpu - previa_.ns_cpu;
+    stats_->sumar(d);
+}
+
+} // namespace DiscreteSystems
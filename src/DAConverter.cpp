@@ -6,6 +6,7 @@
  */
 
 #include "DAConverter.h"
+#include "Diagnostico.h"
 
 namespace DiscreteSystems {
 
@@ -18,7 +19,7 @@ namespace DiscreteSystems {
 DAConverter::DAConverter(double Ts, size_t bufferSize)
     : DiscreteSystem(Ts, bufferSize), u_out_(0.0)
 {
-    std::cout << "Objeto de tipo DAConverter creado correctamente" << std::endl;
+    DS_DIAG("Objeto de tipo DAConverter creado correctamente");
 }
 
 /**
@@ -42,7 +43,7 @@ double DAConverter::compute(double uk)
 void DAConverter::resetState()
 {
     u_out_ = 0.0;
-    std::cout << "ResetState de DAConverter ejecutado" << std::endl;
+    DS_DIAG("ResetState de DAConverter ejecutado");
 }
 
 } // namespace DiscreteSystems
@@ -0,0 +1,127 @@
+/**
+ * @file Decimador.cpp
+ * @brief Implementación del decimador CIC / FIR polifásico
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "Decimador.h"
+#include "Diagnostico.h"
+#include "EntornoFP.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace DiscreteSystems {
+
+/**
+ * @brief Constructor con filtro por defecto (CIC de orden parametro o FIR diseñado)
+ */
+Decimador::Decimador(size_t factor, FiltroMultitasa tipo, double Ts,
+                     size_t parametro, size_t bufferSize)
+    : Decimador(factor,
+                tipo == FiltroMultitasa::FIR ? disenarPasoBajoMultitasa(factor, parametro)
+                                             : std::vector<double>{1.0},
+                Ts, bufferSize)
+{
+    if (tipo == FiltroMultitasa::CIC) {
+        CuantificadorCIC::validar(factor, parametro);
+        tipo_ = FiltroMultitasa::CIC;
+        integradores_.assign(parametro, 0);
+        peines_.assign(parametro, 0);
+        ganancia_ = std::pow(static_cast<double>(factor), static_cast<double>(parametro));
+        polifase_.clear();
+        acc_.clear();
+        K_ = 0;
+    }
+}
+
+/**
+ * @brief Constructor FIR: reordena h en subfiltros polifásicos
+ */
+Decimador::Decimador(size_t factor, const std::vector<double>& h, double Ts, size_t bufferSize)
+    : DiscreteSystem(Ts, bufferSize), factor_(factor), tipo_(FiltroMultitasa::FIR),
+      fase_(0), salida_(0.0), nuevas_(0), K_(0), ganancia_(1.0)
+{
+    if (factor_ < 2 || h.empty()) {
+        throw std::invalid_argument("Decimador: factor >= 2 y al menos un coeficiente");
+    }
+    // Una entrada a distancia r del final de su grupo aporta h[r + j·N] a la
+    // salida de j grupos más adelante
+    K_ = (h.size() + factor_ - 1) / factor_;
+    polifase_.assign(factor_ * K_, 0.0);
+    for (size_t r = 0; r < factor_; ++r) {
+        for (size_t j = 0; j < K_; ++j) {
+            size_t i = r + j * factor_;
+            polifase_[r * K_ + j] = i < h.size() ? h[i] : 0.0;
+        }
+    }
+    acc_.assign(K_, 0.0);
+
+    DS_DIAG("Objeto de tipo Decimador creado correctamente (factor = " << factor_ << ")");
+}
+
+double Decimador::compute(double uk)
+{
+    return tipo_ == FiltroMultitasa::FIR ? computeFIR(uk) : computeCIC(uk);
+}
+
+/**
+ * @brief FIR polifásico: ⌈L/N⌉ MAC por entrada; cada N entradas sale acc_[0]
+ */
+double Decimador::computeFIR(double uk)
+{
+    const double* c = &polifase_[(factor_ - 1 - fase_) * K_];
+    double* acc = acc_.data();
+    for (size_t j = 0; j < K_; ++j) {
+        acc[j] += c[j] * uk;
+    }
+    if (++fase_ == factor_) {
+        salida_ = acc[0];
+        std::copy(acc + 1, acc + K_, acc);
+        acc[K_ - 1] = 0.0;
+        fase_ = 0;
+        ++nuevas_;
+    }
+    return salida_;
+}
+
+/**
+ * @brief CIC: integradores en cada entrada, peines en cada N-ésima
+ */
+double Decimador::computeCIC(double uk)
+{
+    std::uint64_t v = CuantificadorCIC::cuantificar(uk);
+    for (auto& integ : integradores_) {
+        integ += v;
+        v = integ;
+    }
+    if (++fase_ == factor_) {
+        for (auto& prev : peines_) {
+            std::uint64_t d = v - prev;
+            prev = v;
+            v = d;
+        }
+        salida_ = CuantificadorCIC::reconstruir(v, ganancia_);
+        fase_ = 0;
+        ++nuevas_;
+    }
+    return salida_;
+}
+
+void Decimador::resetState()
+{
+    fase_ = 0;
+    salida_ = 0.0;
+    nuevas_ = 0;
+    std::fill(acc_.begin(), acc_.end(), 0.0);
+    std::fill(integradores_.begin(), integradores_.end(), 0);
+    std::fill(peines_.begin(), peines_.end(), 0);
+}
+
+size_t Decimador::contarSubnormales() const
+{
+    return DiscreteSystems::contarSubnormales(acc_.data(), acc_.size());
+}
+
+} // namespace DiscreteSystems
@@ -0,0 +1,52 @@
+/**
+ * @file Diagnostico.cpp
+ * @brief Implementación del sumidero de diagnóstico
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/Diagnostico.h"
+
+#include <iostream>
+#include <mutex>
+
+namespace DiscreteSystems {
+
+namespace {
+
+struct Estado {
+    std::mutex mtx;
+    Diagnostico::Sumidero sumidero;
+};
+
+Estado& estado() {
+    static Estado e;
+    return e;
+}
+
+} // namespace
+
+std::atomic<bool> Diagnostico::activo_{false};
+
+void Diagnostico::setSumidero(Sumidero sumidero) {
+    Estado& e = estado();
+    std::lock_guard<std::mutex> lock(e.mtx);
+    e.sumidero = std::move(sumidero);
+    activo_.store(static_cast<bool>(e.sumidero), std::memory_order_relaxed);
+}
+
+void Diagnostico::consola() {
+    setSumidero([](const std::string& mensaje) {
+        std::cout << mensaje << std::endl;
+    });
+}
+
+void Diagnostico::emitir(const std::string& mensaje) {
+    Estado& e = estado();
+    std::lock_guard<std::mutex> lock(e.mtx);
+    if (e.sumidero) {
+        e.sumidero(mensaje);
+    }
+}
+
+} // namespace DiscreteSystems
@@ -1,19 +1,34 @@
 
 #include "DiscreteSystem.h"
+#include "Diagnostico.h"
+
+#include <iomanip>
+#include <stdexcept>
+#include <limits>
 
 namespace DiscreteSystems {
 
     DiscreteSystem::DiscreteSystem(double Ts, size_t bufferSize):
      Ts_(Ts),
       k_(0),
+      politica_(bufferSize > 0 ? PoliticaHistorial::Anillo : PoliticaHistorial::Ninguno),
+      registrador_(nullptr),
       bufferSize_(bufferSize),
-      writeIndex_(0),
-      count_(0),
-      buffer_(bufferSize)   
+      mascara_(0),
+      total_(0),
+      seq_(0)
 {
     if (Ts <= 0) throw std::runtime_error("InvalidSamplingTime: Ts must be > 0");
+
+    if (bufferSize_ > 0) {
+        // Potencia de 2: el índice es total_ & mascara_, sin módulo
+        size_t capacidad = 1;
+        while (capacidad < bufferSize_) capacidad <<= 1;
+        buffer_.resize(capacidad);
+        mascara_ = capacidad - 1;
+    }
     
-    std::cout << "Objeto de tipo DiscreteSystem creado correctamente" << std::endl;
+    DS_DIAG("Objeto de tipo DiscreteSystem creado correctamente");
 }
     
         
@@ -21,7 +36,6 @@ namespace DiscreteSystems {
      
     double yk = compute(uk);
     storeSample(uk, yk);
-    int currentK = k_;
     k_++;
     return yk;
 
@@ -31,30 +45,157 @@ namespace DiscreteSystems {
      
     double yk = compute(in1, in2);
     storeSample(in1, yk); //no necesito almacenar la referencia, es solo para el sumador este bloque
-    int currentK = k_;
     k_++;
     return yk;
 
     }
     
+    void DiscreteSystem::process(const double* u, double* y, size_t n){
+
+    computeBlock(u, y, n);
+    storeBlock(u, y, n);
+
+    }
+
+    void DiscreteSystem::process(const double* in1, const double* in2, double* y, size_t n){
+
+    computeBlock(in1, in2, y, n);
+    storeBlock(in1, y, n); //igual que next(in1, in2): se guarda solo la primera entrada
+
+    }
+
+    void DiscreteSystem::computeBlock(const double* u, double* y, size_t n){
+        for (size_t i = 0; i < n; ++i)
+            y[i] = compute(u[i]);
+    }
+
+    void DiscreteSystem::computeBlock(const double* in1, const double* in2, double* y, size_t n){
+        for (size_t i = 0; i < n; ++i)
+            y[i] = compute(in1[i], in2[i]);
+    }
+
     void DiscreteSystem::reset(){
-        std::cout << "Reset ejecutado" << std::endl; 
+
+    // Vaciar el historial dentro del seqlock: un snapshot() concurrente lo detecta
+    std::uint64_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    k_ = 0;
+    total_ = 0;
+    seq_.store(seq + 2, std::memory_order_release);
+
+    resetState();
+    DS_DIAG("Reset ejecutado");
+
     }
    
-    //void bufferDump(std::ostream& os, ExportFormat format = ExportFormat::TSV) const;
+    void DiscreteSystem::setHistorial(PoliticaHistorial politica, RegistradorMuestras* registrador){
+
+    if (politica == PoliticaHistorial::Anillo && bufferSize_ == 0) {
+        throw std::invalid_argument("setHistorial: Anillo requiere bufferSize > 0");
+    }
+    if (politica == PoliticaHistorial::Externo && registrador == nullptr) {
+        throw std::invalid_argument("setHistorial: Externo requiere un registrador");
+    }
+
+    std::uint64_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    politica_ = politica;
+    registrador_ = registrador;
+    total_ = 0;
+    seq_.store(seq + 2, std::memory_order_release);
+
+    }
+
+    BufferSnapshot DiscreteSystem::snapshot() const{
 
-    void DiscreteSystem::storeSample(double uk, double yk){
-       
+    BufferSnapshot s;
+    // Esperar a que no haya una escritura en curso (secuencia par)
+    do {
+        s.seq = seq_.load(std::memory_order_acquire);
+    } while (s.seq & 1u);
 
-          // Guardar la muestra en la posición actual del buffer circular
-    buffer_[writeIndex_] = Sample{ uk, yk, k_ };
+    if (politica_ != PoliticaHistorial::Anillo) {
+        return s;
+    }
+
+    // Las últimas count muestras empiezan en inicio y pueden dar la vuelta
+    // al final del anillo (capacidad = mascara_ + 1)
+    size_t count = getCount();
+    size_t inicio = static_cast<size_t>(total_ - count) & mascara_;
+    size_t hastaFinal = mascara_ + 1 - inicio;
+    s.first = buffer_.data() + inicio;
+    if (count <= hastaFinal) {
+        s.n_first = count;
+    } else {
+        s.n_first = hastaFinal;
+        s.second = buffer_.data();
+        s.n_second = count - hastaFinal;
+    }
+    return s;
+
+    }
+
+    bool DiscreteSystem::validate(const BufferSnapshot& s) const{
+
+    // Las lecturas de la vista no pueden reordenarse después de esta carga
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return seq_.load(std::memory_order_relaxed) == s.seq;
+
+    }
+
+    std::vector<Sample> DiscreteSystem::snapshotCopy() const{
+
+    std::vector<Sample> copia;
+    copia.reserve(bufferSize_);
+    BufferSnapshot s;
+    do {
+        s = snapshot();
+        copia.assign(s.first, s.first + s.n_first);
+        copia.insert(copia.end(), s.second, s.second + s.n_second);
+    } while (!validate(s));
+    return copia;
+
+    }
 
-    // Si aún no está lleno, incrementa count_
-    if (count_ < bufferSize_)
-        count_++;
+    void DiscreteSystem::bufferDump(std::ostream& os, ExportFormat format) const{
+
+    std::vector<Sample> muestras = snapshotCopy();
+
+    const char sep = format == ExportFormat::TSV ? '\t' : ' ';
+    if (format == ExportFormat::TSV) {
+        os << "k\tin\tout\n";
+    } else {
+        os << "% k in out (Ts = " << Ts_ << ")\n";
+    }
+
+    std::ios::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision(std::numeric_limits<double>::max_digits10);
+    for (const Sample& m : muestras) {
+        os << m.k << sep << m.in << sep << m.out << '\n';
+    }
+    os.precision(precision);
+    os.flags(flags);
+
+    }
+
+    void DiscreteSystem::storeBlock(const double* u, const double* y, size_t n){
+
+    if (politica_ == PoliticaHistorial::Ninguno) {
+        k_ += static_cast<std::int64_t>(n);
+        return;
+    }
+
+    // En el anillo solo sobreviven las últimas bufferSize_ muestras; el
+    // registrador externo las recibe todas
+    size_t first = politica_ == PoliticaHistorial::Anillo && n > bufferSize_ ? n - bufferSize_ : 0;
+    k_ += static_cast<std::int64_t>(first);
+    for (size_t i = first; i < n; ++i) {
+        storeSample(u[i], y[i]);
+        k_++;
+    }
 
-    // Mover índice circular
-    writeIndex_ = (writeIndex_ + 1) % bufferSize_;
     }
 
 
@@ -5,6 +5,8 @@
 
 #include "../include/Discretizer.h"
 #include <cmath>
+#include <algorithm>
+#include <limits>
 
 namespace DiscreteSystems {
 
@@ -100,6 +102,8 @@ DiscreteTF discretizeTF(const std::vector<double>& num_s,
 
         return DiscreteTF{bd, ad};
     }
+    case DiscretizationMethod::TustinZPK:
+        return zpkToTF(bilinearZPK(tf2zpk(num_s, den_s), Ts));
     case DiscretizationMethod::ZOH:
         throw std::invalid_argument("Método ZOH no implementado aún");
     default:
@@ -107,4 +111,272 @@ DiscreteTF discretizeTF(const std::vector<double>& num_s,
     }
 }
 
+// --- Helpers de la forma polo-cero ---
+
+using cplx = std::complex<double>;
+
+// Evalúa p(x) y p'(x) por Horner (coeficientes descendentes)
+static void hornerDeriv(const std::vector<double>& c, cplx x, cplx& p, cplx& dp) {
+    p = c[0];
+    dp = 0.0;
+    for (size_t i = 1; i < c.size(); ++i) {
+        dp = dp * x + p;
+        p = p * x + c[i];
+    }
+}
+
+// Proyecta raíces casi reales al eje real y simetriza pares conjugados
+static void cleanRoots(std::vector<cplx>& r) {
+    const double tol = 1e-9;
+    for (auto& z : r) {
+        if (std::abs(z.imag()) <= tol * std::max(1.0, std::abs(z))) z = cplx(z.real(), 0.0);
+    }
+    std::vector<bool> used(r.size(), false);
+    for (size_t i = 0; i < r.size(); ++i) {
+        if (used[i] || r[i].imag() <= 0.0) continue;
+        size_t best = r.size();
+        double bestDist = std::numeric_limits<double>::infinity();
+        for (size_t j = 0; j < r.size(); ++j) {
+            if (used[j] || j == i || r[j].imag() >= 0.0) continue;
+            double d = std::abs(r[j] - std::conj(r[i]));
+            if (d < bestDist) { bestDist = d; best = j; }
+        }
+        if (best == r.size()) continue;
+        cplx avg((r[i].real() + r[best].real()) / 2.0,
+                 (r[i].imag() - r[best].imag()) / 2.0);
+        r[i] = avg;
+        r[best] = std::conj(avg);
+        used[i] = used[best] = true;
+    }
+}
+
+std::vector<cplx> polyRoots(const std::vector<double>& coeffs) {
+    if (coeffs.empty() || coeffs[0] == 0.0) {
+        throw std::invalid_argument("polyRoots: coeficiente principal nulo");
+    }
+
+    // Raíces en el origen (coeficientes finales nulos) se extraen directamente
+    std::vector<double> c(coeffs);
+    std::vector<cplx> roots;
+    while (c.size() > 1 && c.back() == 0.0) {
+        c.pop_back();
+        roots.emplace_back(0.0, 0.0);
+    }
+    const size_t n = c.size() - 1;
+    if (n == 0) return roots;
+
+    // Polinomio mónico
+    const double c0 = c[0];
+    for (double& v : c) v /= c0;
+
+    // Estimación inicial: circunferencia con radio = media geométrica de |raíces|
+    const double radius = std::pow(std::abs(c[n]), 1.0 / static_cast<double>(n));
+    std::vector<cplx> z(n);
+    for (size_t k = 0; k < n; ++k) {
+        double ang = 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(n) + 0.4;
+        z[k] = std::polar(radius, ang);
+    }
+
+    // Iteración de Aberth-Ehrlich
+    for (int it = 0; it < 500; ++it) {
+        double maxStep = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            cplx p, dp;
+            hornerDeriv(c, z[i], p, dp);
+            if (p == 0.0) continue;
+            cplx ratio = p / dp;
+            cplx sum = 0.0;
+            for (size_t j = 0; j < n; ++j) {
+                if (j != i) sum += 1.0 / (z[i] - z[j]);
+            }
+            cplx w = ratio / (1.0 - ratio * sum);
+            z[i] -= w;
+            maxStep = std::max(maxStep, std::abs(w) / std::max(1.0, std::abs(z[i])));
+        }
+        if (maxStep < 1e-15) break;
+    }
+
+    // Pulido de Newton sobre el polinomio original
+    for (auto& zi : z) {
+        for (int it = 0; it < 3; ++it) {
+            cplx p, dp;
+            hornerDeriv(c, zi, p, dp);
+            if (dp == 0.0) break;
+            zi -= p / dp;
+        }
+    }
+
+    roots.insert(roots.end(), z.begin(), z.end());
+    cleanRoots(roots);
+    return roots;
+}
+
+ContinuousZPK tf2zpk(const std::vector<double>& num_s,
+                     const std::vector<double>& den_s) {
+    if (den_s.empty() || std::abs(den_s[0]) < 1e-12) {
+        throw std::invalid_argument("Denominador continuo inválido");
+    }
+
+    // Eliminar ceros a la izquierda del numerador
+    size_t first = 0;
+    while (first < num_s.size() && num_s[first] == 0.0) ++first;
+    if (first == num_s.size()) {
+        return ContinuousZPK{{}, polyRoots(den_s), 0.0};
+    }
+    std::vector<double> num(num_s.begin() + first, num_s.end());
+    if (num.size() > den_s.size()) {
+        throw std::invalid_argument("tf2zpk: sistema impropio (grado B > grado A)");
+    }
+
+    return ContinuousZPK{polyRoots(num), polyRoots(den_s), num[0] / den_s[0]};
+}
+
+DiscreteZPK bilinearZPK(const ContinuousZPK& zpk, double Ts) {
+    if (Ts <= 0.0) {
+        throw std::invalid_argument("Ts debe ser > 0");
+    }
+    if (zpk.zeros.size() > zpk.poles.size()) {
+        throw std::invalid_argument("bilinearZPK: sistema impropio (más ceros que polos)");
+    }
+
+    const double K = 2.0 / Ts; // s = K*(z - 1)/(z + 1)
+    DiscreteZPK d;
+    cplx factor = 1.0;
+
+    // (s - r) = (K - r) * (z - (K + r)/(K - r)) / (z + 1)
+    auto mapRoot = [K](cplx r) {
+        cplx den = K - r;
+        if (std::abs(den) < 1e-12 * K) {
+            throw std::invalid_argument("bilinearZPK: raíz en s = 2/Ts");
+        }
+        return (K + r) / den;
+    };
+
+    for (const auto& z : zpk.zeros) {
+        d.zeros.push_back(mapRoot(z));
+        factor *= (K - z);
+    }
+    for (const auto& p : zpk.poles) {
+        d.poles.push_back(mapRoot(p));
+        factor /= (K - p);
+    }
+    // Ceros en el infinito → z = -1
+    for (size_t i = zpk.zeros.size(); i < zpk.poles.size(); ++i) {
+        d.zeros.emplace_back(-1.0, 0.0);
+    }
+
+    d.gain = zpk.gain * factor.real();
+    return d;
+}
+
+// prod(1 - r_i x) en coeficientes ascendentes de x = z^-1
+static std::vector<double> polyFromRoots(const std::vector<cplx>& roots) {
+    std::vector<cplx> acc{1.0};
+    for (const auto& r : roots) {
+        acc.push_back(0.0);
+        for (size_t i = acc.size() - 1; i > 0; --i) {
+            acc[i] -= r * acc[i - 1];
+        }
+    }
+    std::vector<double> out(acc.size());
+    for (size_t i = 0; i < acc.size(); ++i) out[i] = acc[i].real();
+    return out;
+}
+
+DiscreteTF zpkToTF(const DiscreteZPK& zpk) {
+    auto b = polyFromRoots(zpk.zeros);
+    auto a = polyFromRoots(zpk.poles);
+    for (double& v : b) v *= zpk.gain;
+    return DiscreteTF{b, a};
+}
+
+// Agrupa raíces en pares: conjugados primero, reales consecutivos por |r| después.
+// Si el total es impar queda un grupo de una sola raíz al final.
+static std::vector<std::vector<cplx>> groupRoots(const std::vector<cplx>& roots) {
+    std::vector<std::vector<cplx>> groups;
+    std::vector<cplx> reals;
+    for (const auto& r : roots) {
+        if (r.imag() > 0.0) {
+            groups.push_back({r, std::conj(r)});
+        } else if (r.imag() == 0.0) {
+            reals.push_back(r);
+        }
+    }
+    std::sort(reals.begin(), reals.end(),
+              [](const cplx& x, const cplx& y) { return std::abs(x) < std::abs(y); });
+    for (size_t i = 0; i + 1 < reals.size(); i += 2) {
+        groups.push_back({reals[i], reals[i + 1]});
+    }
+    if (reals.size() % 2 == 1) {
+        groups.push_back({reals.back()});
+    }
+    return groups;
+}
+
+static double groupRadius(const std::vector<cplx>& g) {
+    double r = 0.0;
+    for (const auto& v : g) r = std::max(r, std::abs(v));
+    return r;
+}
+
+std::vector<SecondOrderSection> zpkToSOS(const DiscreteZPK& zpk) {
+    if (zpk.zeros.size() > zpk.poles.size()) {
+        throw std::invalid_argument("zpkToSOS: más ceros que polos");
+    }
+
+    // Completar con ceros en el origen (factor 1 en z^-1)
+    std::vector<cplx> zeros(zpk.zeros);
+    zeros.resize(zpk.poles.size(), cplx(0.0, 0.0));
+
+    auto poleGroups = groupRoots(zpk.poles);
+    auto zeroGroups = groupRoots(zeros);
+    std::sort(poleGroups.begin(), poleGroups.end(),
+              [](const std::vector<cplx>& x, const std::vector<cplx>& y) {
+                  return groupRadius(x) < groupRadius(y);
+              });
+
+    // Emparejar empezando por el polo más resonante con el cero más cercano
+    std::vector<std::vector<cplx>> matchedZeros(poleGroups.size());
+    std::vector<bool> usedZero(zeroGroups.size(), false);
+    for (size_t gi = poleGroups.size(); gi-- > 0;) {
+        const auto& pg = poleGroups[gi];
+        size_t best = zeroGroups.size();
+        double bestDist = std::numeric_limits<double>::infinity();
+        for (size_t zi = 0; zi < zeroGroups.size(); ++zi) {
+            if (usedZero[zi] || zeroGroups[zi].size() != pg.size()) continue;
+            double d = std::abs(zeroGroups[zi][0] - pg[0]);
+            if (d < bestDist) { bestDist = d; best = zi; }
+        }
+        if (best == zeroGroups.size()) {
+            throw std::logic_error("zpkToSOS: no se pudieron emparejar ceros y polos");
+        }
+        usedZero[best] = true;
+        matchedZeros[gi] = zeroGroups[best];
+    }
+
+    std::vector<SecondOrderSection> sos;
+    sos.reserve(poleGroups.size());
+    for (size_t gi = 0; gi < poleGroups.size(); ++gi) {
+        auto a = polyFromRoots(poleGroups[gi]);
+        auto b = polyFromRoots(matchedZeros[gi]);
+        a.resize(3, 0.0);
+        b.resize(3, 0.0);
+        sos.push_back(SecondOrderSection{b[0], b[1], b[2], a[1], a[2]});
+    }
+
+    // Ganancia total en la primera sección
+    if (!sos.empty()) {
+        sos[0].b0 *= zpk.gain;
+        sos[0].b1 *= zpk.gain;
+        sos[0].b2 *= zpk.gain;
+    }
+    return sos;
+}
+
+std::vector<SecondOrderSection> discretizeSOS(const std::vector<double>& num_s,
+                                              const std::vector<double>& den_s,
+                                              double Ts) {
+    return zpkToSOS(bilinearZPK(tf2zpk(num_s, den_s), Ts));
+}
+
 } // namespace DiscreteSystems
@@ -0,0 +1,53 @@
+/**
+ * @file EntornoFP.cpp
+ * @brief Control FTZ/DAZ por hilo
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/EntornoFP.h"
+
+#if defined(__SSE__) || defined(__x86_64__)
+#include <xmmintrin.h>
+#endif
+
+namespace DiscreteSystems {
+
+namespace {
+
+#if defined(__SSE__) || defined(__x86_64__)
+constexpr unsigned int kMxcsrFtz = 0x8000;   // Flush-to-zero
+constexpr unsigned int kMxcsrDaz = 0x0040;   // Denormals-are-zero
+#elif defined(__aarch64__)
+constexpr unsigned long kFpcrFz = 1ul << 24; // FZ (cubre resultados y operandos)
+#endif
+
+} // namespace
+
+bool activarFlushToZero() {
+#if defined(__SSE__) || defined(__x86_64__)
+    _mm_setcsr(_mm_getcsr() | kMxcsrFtz | kMxcsrDaz);
+    return true;
+#elif defined(__aarch64__)
+    unsigned long fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    __asm__ __volatile__("msr fpcr, %0" : : "r"(fpcr | kFpcrFz));
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool flushToZeroActivo() {
+#if defined(__SSE__) || defined(__x86_64__)
+    return (_mm_getcsr() & kMxcsrFtz) != 0;
+#elif defined(__aarch64__)
+    unsigned long fpcr;
+    __asm__ __volatile__("mrs %0, fpcr" : "=r"(fpcr));
+    return (fpcr & kFpcrFz) != 0;
+#else
+    return false;
+#endif
+}
+
+} // namespace DiscreteSystems
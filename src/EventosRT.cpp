@@ -0,0 +1,269 @@
+/**
+ * @file EventosRT.cpp
+ * @brief Cola de incidencias de tiempo real, agregación y hilo de vaciado
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/EventosRT.h"
+
+#include <time.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace DiscreteSystems {
+
+// ============================================================================
+// ColaEventosRT
+// ============================================================================
+
+ColaEventosRT::ColaEventosRT(std::size_t capacidad)
+    : celdas_(nullptr), mascara_(capacidad - 1), cola_(0), cabeza_(0), descartados_(0)
+{
+    if (capacidad < 2 || (capacidad & (capacidad - 1)) != 0) {
+        throw std::invalid_argument("ColaEventosRT: la capacidad debe ser potencia de 2");
+    }
+    celdas_.reset(new Celda[capacidad]);
+    for (std::size_t i = 0; i < capacidad; ++i) {
+        celdas_[i].seq.store(i, std::memory_order_relaxed);
+    }
+}
+
+// ============================================================================
+// EventosRT
+// ============================================================================
+
+namespace {
+
+using Clave = std::pair<std::string, CodigoEventoRT>;
+
+/// Incidencias de una clave en la ventana actual (sin contar la ya escrita)
+struct Acumulado {
+    std::uint64_t n = 0;
+    double max = 0.0;
+    double limite = 0.0;
+    std::uint64_t iter_min = 0;
+    std::uint64_t iter_max = 0;
+};
+
+struct Estado {
+    ColaEventosRT cola{1024};
+
+    std::mutex mtx;                          // Consumidor único, sumidero y agregados
+    EventosRT::Sumidero sumidero;
+    std::map<Clave, Acumulado> ventana;      // Claves con actividad en la ventana actual
+    std::set<Clave> anteriores;              // Claves con actividad en la ventana anterior
+    std::uint64_t descartados_informados = 0;
+    double ventana_s = 1.0;
+
+    std::mutex mtx_hilo;
+    std::condition_variable cv;
+    std::thread hilo;
+    bool parar = false;
+
+    ~Estado();
+};
+
+Estado& estado() {
+    static Estado e;
+    return e;
+}
+
+// La cola (1024 celdas) se reserva al cargar el programa y no en el primer
+// reportar(), que puede llegar desde un hilo de tiempo real
+const bool estado_construido = (estado(), true);
+
+void escribir(Estado& e, const std::string& linea) {
+    if (e.sumidero) {
+        e.sumidero(linea);
+    } else {
+        std::cerr << linea << std::endl;
+    }
+}
+
+void formatearValor(std::ostringstream& os, CodigoEventoRT codigo, double valor, double limite) {
+    if (codigo == CodigoEventoRT::ErrorMutex) {
+        os << "código " << static_cast<long>(valor);
+    } else {
+        os << valor << " > " << limite << " us";
+    }
+}
+
+/// Vacía la cola: primera aparición de cada clave en seguida, el resto se acumula
+void procesar(Estado& e) {
+    EventoRT ev;
+    while (e.cola.pop(ev)) {
+        Clave clave(ev.origen, ev.codigo);
+        auto it = e.ventana.find(clave);
+        if (it == e.ventana.end() && e.anteriores.count(clave) == 0) {
+            e.ventana.emplace(clave, Acumulado());
+            std::ostringstream os;
+            os << "[" << ev.origen << "] " << EventosRT::gravedad(ev.codigo) << " iter " << ev.iter
+               << ": " << EventosRT::descripcion(ev.codigo) << " (";
+            formatearValor(os, ev.codigo, ev.valor, ev.limite);
+            os << ")";
+            escribir(e, os.str());
+            continue;
+        }
+        Acumulado& a = e.ventana[clave];
+        if (a.n == 0 || ev.valor > a.max) {
+            a.max = ev.valor;
+            a.limite = ev.limite;
+        }
+        a.iter_min = a.n == 0 ? ev.iter : a.iter_min;
+        a.iter_max = ev.iter;
+        ++a.n;
+    }
+}
+
+/// Resume la ventana actual en una línea por clave y abre la siguiente
+void cerrarVentana(Estado& e) {
+    for (const auto& kv : e.ventana) {
+        const Acumulado& a = kv.second;
+        if (a.n == 0) {
+            continue;
+        }
+        std::ostringstream os;
+        os << "[" << kv.first.first << "] " << EventosRT::gravedad(kv.first.second) << " " << a.n
+           << " × " << EventosRT::descripcion(kv.first.second) << " en " << e.ventana_s << " s (máx ";
+        formatearValor(os, kv.first.second, a.max, a.limite);
+        os << ", iter " << a.iter_min << "-" << a.iter_max << ")";
+        escribir(e, os.str());
+    }
+    e.anteriores.clear();
+    for (const auto& kv : e.ventana) {
+        e.anteriores.insert(kv.first);
+    }
+    e.ventana.clear();
+
+    std::uint64_t descartados = e.cola.descartados();
+    if (descartados > e.descartados_informados) {
+        std::ostringstream os;
+        os << "[EventosRT] " << descartados - e.descartados_informados
+           << " eventos descartados (cola llena)";
+        escribir(e, os.str());
+        e.descartados_informados = descartados;
+    }
+}
+
+void bucleVaciado(Estado& e) {
+    const auto paso = std::chrono::milliseconds(100);
+    auto cierre = std::chrono::steady_clock::now() +
+                  std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                      std::chrono::duration<double>(e.ventana_s));
+    std::unique_lock<std::mutex> lock_hilo(e.mtx_hilo);
+    while (!e.parar) {
+        e.cv.wait_for(lock_hilo, paso, [&e] { return e.parar; });
+        std::lock_guard<std::mutex> lock(e.mtx);
+        procesar(e);
+        if (std::chrono::steady_clock::now() >= cierre) {
+            cerrarVentana(e);
+            cierre += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(e.ventana_s));
+        }
+    }
+}
+
+void pararYVaciar(Estado& e) {
+    {
+        std::lock_guard<std::mutex> lock_hilo(e.mtx_hilo);
+        e.parar = true;
+    }
+    e.cv.notify_all();
+    if (e.hilo.joinable()) {
+        e.hilo.join();
+    }
+    std::lock_guard<std::mutex> lock(e.mtx);
+    procesar(e);
+    cerrarVentana(e);
+}
+
+// Al salir del proceso se escriben los resúmenes pendientes
+Estado::~Estado() {
+    pararYVaciar(*this);
+}
+
+} // namespace
+
+void EventosRT::reportar(const char* origen, CodigoEventoRT codigo, std::uint64_t iter,
+                         double valor, double limite) noexcept {
+    EventoRT ev;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ev.t_ns = static_cast<std::int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    ev.iter = iter;
+    ev.valor = valor;
+    ev.limite = limite;
+    ev.codigo = codigo;
+    if (origen) {
+        std::strncpy(ev.origen, origen, sizeof(ev.origen) - 1);
+    }
+    estado().cola.push(ev);
+}
+
+void EventosRT::iniciar(double ventana_s) {
+    Estado& e = estado();
+    std::lock_guard<std::mutex> lock_hilo(e.mtx_hilo);
+    if (e.hilo.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(e.mtx);
+        e.ventana_s = ventana_s > 0.0 ? ventana_s : 1.0;
+    }
+    e.parar = false;
+    e.hilo = std::thread(bucleVaciado, std::ref(e));
+}
+
+void EventosRT::detener() {
+    pararYVaciar(estado());
+}
+
+void EventosRT::vaciar() {
+    Estado& e = estado();
+    std::lock_guard<std::mutex> lock(e.mtx);
+    procesar(e);
+    cerrarVentana(e);
+}
+
+void EventosRT::setSumidero(Sumidero sumidero) {
+    Estado& e = estado();
+    std::lock_guard<std::mutex> lock(e.mtx);
+    e.sumidero = std::move(sumidero);
+}
+
+std::uint64_t EventosRT::descartados() {
+    return estado().cola.descartados();
+}
+
+const char* EventosRT::descripcion(CodigoEventoRT codigo) {
+    switch (codigo) {
+        case CodigoEventoRT::CercaPlazo:        return "cerca del plazo (>90 %)";
+        case CodigoEventoRT::PlazoPerdido:      return "plazo perdido";
+        case CodigoEventoRT::MutexOcupado:      return "mutex ocupado, iteración saltada";
+        case CodigoEventoRT::ErrorMutex:        return "error de mutex";
+        case CodigoEventoRT::TimeoutParametros: return "timeout leyendo parámetros";
+        case CodigoEventoRT::TimeoutSalida:     return "timeout escribiendo la salida";
+    }
+    return "?";
+}
+
+const char* EventosRT::gravedad(CodigoEventoRT codigo) {
+    switch (codigo) {
+        case CodigoEventoRT::CercaPlazo:   return "WARNING";
+        case CodigoEventoRT::PlazoPerdido: return "CRITICAL";
+        default:                           return "ERROR";
+    }
+}
+
+} // namespace DiscreteSystems
@@ -6,7 +6,14 @@
  */
 
 #include "Hilo.h"
+#include "../include/BaseTiempoComun.h"
 #include "../include/Temporizador.h"
+#include "../include/TokenParada.h"
+#include "../include/Tracer.h"
+#include "../include/ContadoresHW.h"
+#include "../include/EntornoFP.h"
+
+#include <limits>
 
 namespace DiscreteSystems {
 
@@ -19,12 +26,14 @@ Hilo::Hilo(std::shared_ptr<DiscreteSystem> system,
            bool* running,
            std::shared_ptr<pthread_mutex_t> mtx, 
            double frequency,
-           const std::string& log_prefix)
+           const std::string& log_prefix,
+           const ConfigHilo& config)
     : system_(system), input_(input), output_(output), running_(running), mtx_(mtx), 
     frequency_(frequency), system_raw_(nullptr), input_raw_(nullptr), output_raw_(nullptr),
-    running_raw_(nullptr), mtx_raw_(nullptr), logger_(log_prefix, 1000), iterations_(0)
+    running_raw_(nullptr), mtx_raw_(nullptr), logger_(log_prefix, 1000), config_(config), iterations_(0)
 {
     logger_.initializeHilo(frequency);
+    logger_.setCpuAccounting(config_.contabilidad_cpu);
     int ret = pthread_create(&thread_, nullptr, &Hilo::threadFunc, this);
     if (ret != 0) {
         std::cerr << "[Hilo::Hilo] Error: pthread_create falló con código " << ret << std::endl;
@@ -37,12 +46,14 @@ Hilo::Hilo(std::shared_ptr<DiscreteSystem> system,
  */
 Hilo::Hilo(DiscreteSystem* system, double* input, double* output, bool* running,
            pthread_mutex_t* mtx, double frequency,
-           const std::string& log_prefix)
+           const std::string& log_prefix,
+           const ConfigHilo& config)
     : system_(nullptr), input_(nullptr), output_(nullptr), running_(nullptr), mtx_(nullptr),
     frequency_(frequency), system_raw_(system), input_raw_(input), output_raw_(output),
-    running_raw_(running), mtx_raw_(mtx), logger_(log_prefix, 1000), iterations_(0)
+    running_raw_(running), mtx_raw_(mtx), logger_(log_prefix, 1000), config_(config), iterations_(0)
 {
     logger_.initializeHilo(frequency);
+    logger_.setCpuAccounting(config_.contabilidad_cpu);
     int ret = pthread_create(&thread_, nullptr, &Hilo::threadFunc, this);
     if (ret != 0) {
         std::cerr << "[Hilo::Hilo] Error: pthread_create falló con código " << ret << std::endl;
@@ -89,77 +100,124 @@ void* Hilo::threadFunc(void* arg) {
  * @invariant Acceso a *input_, *output_ y *running_ solo dentro de lock_guard
  */
 void Hilo::run() {
-    Temporizador timer(frequency_);
-    const double periodo_us = 1000000.0 / frequency_;
+    Temporizador timer = crearTemporizador(frequency_, config_);
+    const std::int64_t periodo_ns = timer.periodoNs();
     clock_gettime(CLOCK_MONOTONIC, &t_prev_iteration_);
+    DS_TRACE_THREAD_NAME(logger_.getPrefix());
+
+    // FTZ/DAZ en este hilo: los estados que decaen no entran en rango subnormal
+    if (config_.flush_to_zero) {
+        activarFlushToZero();
+    }
+
+    // Contadores hardware opcionales (se abren en este hilo)
+    DiscreteSystem* sys = system_ ? system_.get() : system_raw_;
+    MedidorHW hw;
+    if (config_.contadores_hw) {
+        hw.iniciar(typeid(*sys));
+    }
+
+    // Ejecución por cambio: solo con bloque sin memoria y marca de entrada
+    const bool por_cambio = config_.por_cambio && config_.marca_entrada && sys->sinMemoria();
+    std::uint64_t seq_evaluada = std::numeric_limits<std::uint64_t>::max();
 
     while (true) {
         iterations_++;
         struct timespec t0;
         clock_gettime(CLOCK_MONOTONIC, &t0);
         
-        double ts_real_us = (t0.tv_sec - t_prev_iteration_.tv_sec) * 1000000.0 +
-                            (t0.tv_nsec - t_prev_iteration_.tv_nsec) / 1000.0;
+        std::int64_t ts_real_ns = difNs(t0, t_prev_iteration_);
         t_prev_iteration_ = t0;
 
         bool isRunning;
         
-        pthread_mutex_lock(mtx_ ? mtx_.get() : mtx_raw_);
-        isRunning = running_ ? *running_ : *running_raw_;
-        pthread_mutex_unlock(mtx_ ? mtx_.get() : mtx_raw_);
+        if (config_.parada) {
+            isRunning = !config_.parada->detenido();   // Sin lock
+        } else {
+            pthread_mutex_lock(mtx_ ? mtx_.get() : mtx_raw_);
+            isRunning = running_ ? *running_ : *running_raw_;
+            pthread_mutex_unlock(mtx_ ? mtx_.get() : mtx_raw_);
+        }
 
         if (!isRunning) {
             break;
         }
 
         double input;
+        MarcaTemporal marca_in;
         
-        // Obtener entrada
-        if (input_) {
+        // Obtener entrada (con mutex si hay que leer también su marca)
+        if (input_ && !config_.marca_entrada) {
             input = *input_;
         } else {
-            pthread_mutex_lock(mtx_raw_);
-            input = *input_raw_;
-            pthread_mutex_unlock(mtx_raw_);
+            pthread_mutex_t* mtx = mtx_ ? mtx_.get() : mtx_raw_;
+            pthread_mutex_lock(mtx);
+            input = input_ ? *input_ : *input_raw_;
+            if (config_.marca_entrada) {
+                marca_in = *config_.marca_entrada;
+            }
+            pthread_mutex_unlock(mtx);
+        }
+        if (marca_in.valida()) {
+            timing_.recordEdad(marca_in.t_escritura_ns, marca_in.t_origen_ns, MarcaTemporal::ahoraNs());
         }
 
         struct timespec t1;
         clock_gettime(CLOCK_MONOTONIC, &t1);
-        double t_ejecucion_us;
-
-        // Computar
-        DiscreteSystem* sys = system_ ? system_.get() : system_raw_;
-        double y = sys->next(input);
-
-        struct timespec t2;
-        clock_gettime(CLOCK_MONOTONIC, &t2);
-        t_ejecucion_us = (t2.tv_sec - t1.tv_sec) * 1000000.0 + 
-                         (t2.tv_nsec - t1.tv_nsec) / 1000.0;
+        struct timespec t2 = t1;
+        std::int64_t t_ejecucion_ns = 0;
 
-        // Escribir salida
-        if (output_) {
-            *output_ = y;
+        if (por_cambio && marca_in.seq == seq_evaluada) {
+            // Entrada sin reescribir: la salida publicada sigue siendo válida
+            omitidas_.fetch_add(1, std::memory_order_relaxed);
         } else {
-            pthread_mutex_lock(mtx_raw_);
-            *output_raw_ = y;
-            pthread_mutex_unlock(mtx_raw_);
+            // Computar
+            hw.antes();
+            double y = sys->next(input);
+            hw.despues();
+            if (config_.contar_subnormales) {
+                subnormales_.registrar(sys->contarSubnormales());
+            }
+            seq_evaluada = marca_in.seq;
+
+            clock_gettime(CLOCK_MONOTONIC, &t2);
+            t_ejecucion_ns = difNs(t2, t1);
+
+            // Escribir salida (propagando el origen de la entrada a su marca)
+            if (output_ && !config_.marca_salida) {
+                *output_ = y;
+            } else {
+                pthread_mutex_t* mtx = mtx_ ? mtx_.get() : mtx_raw_;
+                pthread_mutex_lock(mtx);
+                if (output_) {
+                    *output_ = y;
+                } else {
+                    *output_raw_ = y;
+                }
+                if (config_.marca_salida && marca_in.valida()) {
+                    config_.marca_salida->marcar(marca_in.t_origen_ns, MarcaTemporal::ahoraNs());
+                }
+                pthread_mutex_unlock(mtx);
+            }
         }
 
         struct timespec t3;
         clock_gettime(CLOCK_MONOTONIC, &t3);
-        double t_total_us = (t3.tv_sec - t0.tv_sec) * 1000000.0 + 
-                            (t3.tv_nsec - t0.tv_nsec) / 1000.0;
+        std::int64_t t_total_ns = difNs(t3, t0);
 
         const char* status;
-        if (t_total_us > periodo_us) {
+        if (t_total_ns > periodo_ns) {
             status = "CRITICAL";
-        } else if (t_total_us > 0.9 * periodo_us) {
+        } else if (10 * t_total_ns > 9 * periodo_ns) {
             status = "WARNING";
         } else {
             status = "OK";
         }
 
-        logger_.writeLine(iterations_, 0, t_ejecucion_us, t_total_us, periodo_us, ts_real_us, status);
+        timing_.record(timer.objetivo(), t0, ts_real_ns, periodo_ns, t_total_ns, iterations_ == 1);
+        DS_TRACE_COMPLETE("next", t1, t2);
+        DS_TRACE_COMPLETE("iteracion", t0, t3);
+        logger_.writeLine(iterations_, 0, t_ejecucion_ns, t_total_ns, periodo_ns, ts_real_ns, status);
 
         timer.esperar();
     }
@@ -6,12 +6,18 @@
  */
 
 #include "Hilo2in.h"
+#include "../include/BaseTiempoComun.h"
 #include "../include/Temporizador.h"
+#include "../include/TokenParada.h"
+#include "../include/Tracer.h"
+#include "../include/ContadoresHW.h"
+#include "../include/EntornoFP.h"
 #include "system_config.h"
 #include <csignal>
 #include <iostream>
 #include <stdexcept>
 #include <ctime>
+#include <limits>
 
 namespace DiscreteSystems {
 
@@ -25,13 +31,14 @@ Hilo2in::Hilo2in(std::shared_ptr<DiscreteSystem> system,
                  bool* running,
                  std::shared_ptr<pthread_mutex_t> mtx, 
                  double frequency,
-                 const std::string& log_prefix)
+                 const std::string& log_prefix,
+                 const ConfigHilo& config)
     : system_(system), input1_(input1), input2_(input2), output_(output),
       running_(running), mtx_(mtx), frequency_(frequency),
       system_raw_(nullptr), input1_raw_(nullptr), input2_raw_(nullptr),
       output_raw_(nullptr), running_raw_(nullptr), mtx_raw_(nullptr),
-      logger_(log_prefix, SystemConfig::BUFFER_SIZE_LOGGER),
-      t_prev_iteration_(0.0), iterations_(0)
+      logger_(log_prefix, SystemConfig::BUFFER_SIZE_LOGGER), config_(config),
+      t_prev_iteration_{}, iterations_(0)
 {
     int ret = pthread_create(&thread_, nullptr, &Hilo2in::threadFunc, this);
     if (ret != 0) {
@@ -45,13 +52,14 @@ Hilo2in::Hilo2in(std::shared_ptr<DiscreteSystem> system,
  */
 Hilo2in::Hilo2in(DiscreteSystem* system, double* input1, double* input2, double* output,
                  bool *running, pthread_mutex_t* mtx, double frequency,
-                 const std::string& log_prefix)
+                 const std::string& log_prefix,
+                 const ConfigHilo& config)
     : system_(nullptr), input1_(nullptr), input2_(nullptr), output_(nullptr),
       running_(nullptr), mtx_(nullptr), frequency_(frequency),
       system_raw_(system), input1_raw_(input1), input2_raw_(input2),
       output_raw_(output), running_raw_(running), mtx_raw_(mtx),
-      logger_(log_prefix, SystemConfig::BUFFER_SIZE_LOGGER),
-      t_prev_iteration_(0.0), iterations_(0)
+      logger_(log_prefix, SystemConfig::BUFFER_SIZE_LOGGER), config_(config),
+      t_prev_iteration_{}, iterations_(0)
 {
     int ret = pthread_create(&thread_, nullptr, &Hilo2in::threadFunc, this);
     if (ret != 0) {
@@ -100,10 +108,17 @@ void* Hilo2in::threadFunc(void* arg) {
  */
 void Hilo2in::run() {
     // Temporizador con retardo absoluto para evitar drift
-    Temporizador timer(frequency_);
+    Temporizador timer = crearTemporizador(frequency_, config_);
     
     // Inicializar logger
     logger_.initializeHilo(frequency_);
+    logger_.setCpuAccounting(config_.contabilidad_cpu);
+    DS_TRACE_THREAD_NAME(logger_.getPrefix());
+
+    // FTZ/DAZ en este hilo: los estados que decaen no entran en rango subnormal
+    if (config_.flush_to_zero) {
+        activarFlushToZero();
+    }
 
     // Obtener punteros a los objetos
     DiscreteSystem* sys = system_ ? system_.get() : system_raw_;
@@ -115,17 +130,35 @@ void Hilo2in::run() {
     if (!sys || !in1 || !in2 || !out || !mtx) {
         return;
     }
+
+    // Contadores hardware opcionales (se abren en este hilo)
+    MedidorHW hw;
+    if (config_.contadores_hw) {
+        hw.iniciar(typeid(*sys));
+    }
+
+    // Ejecución por cambio: solo con bloque sin memoria y marca en las dos entradas
+    const bool por_cambio = config_.por_cambio && config_.marca_entrada &&
+                            config_.marca_entrada2 && sys->sinMemoria();
+    std::uint64_t seq1_evaluada = std::numeric_limits<std::uint64_t>::max();
+    std::uint64_t seq2_evaluada = std::numeric_limits<std::uint64_t>::max();
     
     struct timespec t_start, t_end;
-    const double period_us = 1e6 / frequency_;
+    const std::int64_t periodo_ns = timer.periodoNs();
+    const std::int64_t limite_critico_ns = static_cast<std::int64_t>(SystemConfig::CRITICAL_THRESHOLD * periodo_ns);
+    const std::int64_t limite_aviso_ns = static_cast<std::int64_t>(SystemConfig::WARNING_THRESHOLD * periodo_ns);
 
     while (true) {
         clock_gettime(CLOCK_MONOTONIC, &t_start);
         
         bool isRunning;
-        pthread_mutex_lock(mtx);
-        isRunning = running_ ? *running_ : *running_raw_;
-        pthread_mutex_unlock(mtx);
+        if (config_.parada) {
+            isRunning = !config_.parada->detenido();   // Sin lock
+        } else {
+            pthread_mutex_lock(mtx);
+            isRunning = running_ ? *running_ : *running_raw_;
+            pthread_mutex_unlock(mtx);
+        }
 
         if (!isRunning)
             break; // salir si se recibió SIGINT/SIGTERM o running_ es false
@@ -135,51 +168,80 @@ void Hilo2in::run() {
         clock_gettime(CLOCK_MONOTONIC, &t_before_read);
         
         double in1_val, in2_val;
+        MarcaTemporal marca1, marca2;
         
         pthread_mutex_lock(mtx);
         in1_val = *in1;
         in2_val = *in2;
+        if (config_.marca_entrada) marca1 = *config_.marca_entrada;
+        if (config_.marca_entrada2) marca2 = *config_.marca_entrada2;
         pthread_mutex_unlock(mtx);
         
         clock_gettime(CLOCK_MONOTONIC, &t_after_read);
 
-        double y = sys->next(in1_val, in2_val);
+        // Edad: se registra la entrada más antigua (en el Sumador, la
+        // realimentación ykd: ref→ykd completo). Hacia la salida se propaga
+        // el origen más reciente (la referencia que está actuando).
+        const MarcaTemporal* antigua = nullptr;
+        const MarcaTemporal* reciente = nullptr;
+        for (const MarcaTemporal* m : {&marca1, &marca2}) {
+            if (!m->valida()) continue;
+            if (!antigua || m->t_origen_ns < antigua->t_origen_ns) antigua = m;
+            if (!reciente || m->t_origen_ns > reciente->t_origen_ns) reciente = m;
+        }
+        if (antigua) {
+            timing_.recordEdad(antigua->t_escritura_ns, antigua->t_origen_ns, aNs(t_after_read));
+        }
 
-        pthread_mutex_lock(mtx);
-        *out = y;
-        pthread_mutex_unlock(mtx);
+        if (por_cambio && marca1.seq == seq1_evaluada && marca2.seq == seq2_evaluada) {
+            // Ninguna entrada reescrita: la salida publicada sigue siendo válida
+            omitidas_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            hw.antes();
+            double y = sys->next(in1_val, in2_val);
+            hw.despues();
+            if (config_.contar_subnormales) {
+                subnormales_.registrar(sys->contarSubnormales());
+            }
+            seq1_evaluada = marca1.seq;
+            seq2_evaluada = marca2.seq;
+
+            pthread_mutex_lock(mtx);
+            *out = y;
+            if (config_.marca_salida && reciente) {
+                config_.marca_salida->marcar(reciente->t_origen_ns, MarcaTemporal::ahoraNs());
+            }
+            pthread_mutex_unlock(mtx);
+        }
         
         clock_gettime(CLOCK_MONOTONIC, &t_end);
         
-        // Calcular tiempos
-        double t_wait_us = (t_after_read.tv_sec - t_before_read.tv_sec) * 1e6
-                         + (t_after_read.tv_nsec - t_before_read.tv_nsec) / 1000.0;
-        double t_total_us = (t_end.tv_sec - t_start.tv_sec) * 1e6
-                          + (t_end.tv_nsec - t_start.tv_nsec) / 1000.0;
+        // Calcular tiempos [ns]
+        std::int64_t t_wait_ns = difNs(t_after_read, t_before_read);
+        std::int64_t t_total_ns = difNs(t_end, t_start);
         
         // Calcular período real (ts_real)
-        double ts_real_us = 0.0;
-        if (iterations_ > 0) {
-            double t_current = t_end.tv_sec * 1e6 + t_end.tv_nsec / 1000.0;
-            ts_real_us = t_current - t_prev_iteration_;
-        }
-        t_prev_iteration_ = t_end.tv_sec * 1e6 + t_end.tv_nsec / 1000.0;
+        std::int64_t ts_real_ns = iterations_ > 0 ? difNs(t_end, t_prev_iteration_) : 0;
+        t_prev_iteration_ = t_end;
         
         // t_ejec = t_total - t_wait
-        double t_ejec_us = t_total_us - t_wait_us;
+        std::int64_t t_ejec_ns = t_total_ns - t_wait_ns;
         
         // Determinar status
-        double perc_computation = (t_total_us / period_us) * 100.0;
         const char* status = "OK";
-        if (perc_computation > (SystemConfig::CRITICAL_THRESHOLD * 100.0)) {
+        if (t_total_ns > limite_critico_ns) {
             status = "CRITICAL";
-        } else if (perc_computation > (SystemConfig::WARNING_THRESHOLD * 100.0)) {
+        } else if (t_total_ns > limite_aviso_ns) {
             status = "WARNING";
         }
         
+        timing_.record(timer.objetivo(), t_start, ts_real_ns, periodo_ns, t_total_ns, iterations_ == 0);
+        DS_TRACE_COMPLETE("lock", t_before_read, t_after_read);
+        DS_TRACE_COMPLETE("iteracion", t_start, t_end);
+
         // Guardar en logger
-        logger_.writeLine(iterations_, t_wait_us, t_ejec_us, t_total_us, 
-                         period_us, ts_real_us, status);
+        logger_.writeLine(iterations_, t_wait_ns, t_ejec_ns, t_total_ns, 
+                         periodo_ns, ts_real_ns, status);
         
         iterations_++;
         
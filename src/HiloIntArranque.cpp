@@ -1,5 +1,7 @@
 #include "HiloIntArranque.h"
 #include "../include/Temporizador.h"
+#include "../include/TokenParada.h"
+#include <cerrno>
 #include <csignal>
 #include <iostream>
 #include <stdexcept>
@@ -8,10 +10,16 @@ volatile sig_atomic_t g_signal_run = 1;
 bool* g_running_ptr = nullptr;
 
 void manejador_signal(int sig) {
+    const int errno_guardado = errno;   // futex() puede cambiarlo bajo el código interrumpido
     g_signal_run = 0;
+    DiscreteSystems::TokenParada::proceso().detener();   // async-signal-safe
+    errno = errno_guardado;
 }
 
 void instalar_manejador_signal() {
+    // Construye el token del proceso aquí: la guarda del static local no es
+    // async-signal-safe y no debe ejecutarse por primera vez en el manejador
+    DiscreteSystems::TokenParada::proceso();
     signal(SIGINT, manejador_signal);
     signal(SIGTERM, manejador_signal);
 }
@@ -27,6 +35,7 @@ HiloIntArranque::HiloIntArranque(std::shared_ptr<InterruptorArranque> interrupto
 {
     logger_.initializeHilo(frequency);
     instalar_manejador_signal();
+    publicarArranque();
     int ret = pthread_create(&thread_, nullptr, &HiloIntArranque::threadFunc, this);
     if (ret != 0) {
         std::cerr << "[HiloIntArranque] Error: pthread_create falló con código " << ret << std::endl;
@@ -44,6 +53,7 @@ HiloIntArranque::HiloIntArranque(InterruptorArranque* interruptor, bool* running
     logger_.initializeHilo(frequency);
     g_running_ptr = running_raw_;
     instalar_manejador_signal();
+    publicarArranque();
     int ret = pthread_create(&thread_, nullptr, &HiloIntArranque::threadFunc, this);
     if (ret != 0) {
         std::cerr << "[HiloIntArranque] Error: pthread_create falló con código " << ret << std::endl;
@@ -58,15 +68,42 @@ HiloIntArranque::~HiloIntArranque() {
     }
 }
 
+/**
+ * @brief Copia el estado del interruptor a running antes de crear el hilo
+ *
+ * Se hace en el constructor, no en run(), para que running ya sea true
+ * cuando se crean los hilos que lo leen (HiloTransmisor, HiloReceptor, el
+ * bucle principal).
+ */
+void HiloIntArranque::publicarArranque() {
+    InterruptorArranque* int_ptr = interruptor_ ? interruptor_.get() : interruptor_raw_;
+    if (!int_ptr || !g_signal_run || int_ptr->getRun() == 0) {
+        return;
+    }
+    pthread_mutex_lock(mtx_ ? mtx_.get() : mtx_raw_);
+    if (running_) {
+        *running_ = true;
+    } else {
+        *running_raw_ = true;
+    }
+    pthread_mutex_unlock(mtx_ ? mtx_.get() : mtx_raw_);
+}
+
 void* HiloIntArranque::threadFunc(void* arg) {
     HiloIntArranque* self = static_cast<HiloIntArranque*>(arg);
     self->run();
     return nullptr;
 }
 
+/**
+ * @brief Espera la orden de parada y la propaga a running
+ *
+ * No sondea: duerme sobre TokenParada::proceso(), que despiertan el
+ * manejador de SIGINT/SIGTERM e InterruptorArranque::setRun(0). Al
+ * despertar pone running a false bajo el mutex (para los hilos que aún lo
+ * leen) y termina.
+ */
 void HiloIntArranque::run() {
-    DiscreteSystems::Temporizador timer(frequency_);
-    const double periodo_us = 1000000.0 / frequency_;
     clock_gettime(CLOCK_MONOTONIC, &t_prev_iteration_);
     
     // Obtener punteros
@@ -74,65 +111,29 @@ void HiloIntArranque::run() {
     if (!int_ptr) {
         return;
     }
-    
-    while (true) {
-        iterations_++;
-        struct timespec t0;
-        clock_gettime(CLOCK_MONOTONIC, &t0);
-        
-        double ts_real_us = (t0.tv_sec - t_prev_iteration_.tv_sec) * 1000000.0 +
-                            (t0.tv_nsec - t_prev_iteration_.tv_nsec) / 1000.0;
-        t_prev_iteration_ = t0;
 
-        if (!g_signal_run) {
-            pthread_mutex_lock(mtx_ ? mtx_.get() : mtx_raw_);
-            if (running_) {
-                *running_ = false;
-            } else {
-                *running_raw_ = false;
-            }
-            pthread_mutex_unlock(mtx_ ? mtx_.get() : mtx_raw_);
-            break;
-        }
-        
-        struct timespec t1;
-        clock_gettime(CLOCK_MONOTONIC, &t1);
-        
-        int run_state = int_ptr->getRun();
-        
-        struct timespec t2;
-        clock_gettime(CLOCK_MONOTONIC, &t2);
-        double t_ejecucion_us = (t2.tv_sec - t1.tv_sec) * 1000000.0 + 
-                                (t2.tv_nsec - t1.tv_nsec) / 1000.0;
-        
-        pthread_mutex_lock(mtx_ ? mtx_.get() : mtx_raw_);
-        if (running_) {
-            *running_ = (run_state != 0);
-        } else {
-            *running_raw_ = (run_state != 0);
-        }
-        pthread_mutex_unlock(mtx_ ? mtx_.get() : mtx_raw_);
-        
-        struct timespec t3;
-        clock_gettime(CLOCK_MONOTONIC, &t3);
-        double t_total_us = (t3.tv_sec - t0.tv_sec) * 1000000.0 + 
-                            (t3.tv_nsec - t0.tv_nsec) / 1000.0;
+    DiscreteSystems::TokenParada& parada = DiscreteSystems::TokenParada::proceso();
+    if (!g_signal_run || int_ptr->getRun() == 0) {
+        parada.detener();   // Parado antes de arrancar este hilo
+    }
+    parada.esperar();
+    iterations_++;
 
-        const char* status;
-        if (t_total_us > periodo_us) {
-            status = "CRITICAL";
-        } else if (t_total_us > 0.9 * periodo_us) {
-            status = "WARNING";
-        } else {
-            status = "OK";
-        }
+    struct timespec t0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
 
-        logger_.writeLine(iterations_, 0, t_ejecucion_us, t_total_us, periodo_us, ts_real_us, status);
-        
-        if (run_state == 0) {
-            break;
-        }
-        
-        timer.esperar();
+    pthread_mutex_lock(mtx_ ? mtx_.get() : mtx_raw_);
+    if (running_) {
+        *running_ = false;
+    } else {
+        *running_raw_ = false;
     }
+    pthread_mutex_unlock(mtx_ ? mtx_.get() : mtx_raw_);
+
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    std::int64_t t_total_ns = DiscreteSystems::difNs(t1, t0);
+    std::int64_t t_activo_ns = DiscreteSystems::difNs(t0, t_prev_iteration_);
+    logger_.writeLine(iterations_, t_total_ns, 0, t_total_ns,
+                      static_cast<std::int64_t>(1e9 / frequency_), t_activo_ns, "STOP");
 }
@@ -8,7 +8,13 @@
 
 #include "../include/HiloPID.h"
 #include "../include/PIDController.h"
+#include "../include/BaseTiempoComun.h"
 #include "../include/Temporizador.h"
+#include "../include/TokenParada.h"
+#include "../include/EventosRT.h"
+#include "../include/Tracer.h"
+#include "../include/ContadoresHW.h"
+#include "../include/EntornoFP.h"
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -25,14 +31,19 @@ namespace DiscreteSystems {
  */
 HiloPID::HiloPID(DiscreteSystem* pid, VariablesCompartidas* vars, 
                  ParametrosCompartidos* params, double frequency,
-                 const std::string& log_prefix)
+                 const std::string& log_prefix,
+                 const ConfigHilo& config)
     : system_(pid), vars_(vars), params_(params), frequency_(frequency), 
-    iterations_(0), logger_(log_prefix, 1000)
+    iterations_(0), logger_(log_prefix, 1000), config_(config)
 {
     // Inicializar logger con configuración específica de HiloPID
     logger_.initializeHiloPID(frequency);
+    logger_.setCpuAccounting(config_.contabilidad_cpu);
     
     std::cout << "HiloPID log: " << logger_.getLogPath() << std::endl;
+
+    // Los avisos del lazo van a la cola de EventosRT; su hilo de vaciado los escribe
+    EventosRT::iniciar();
     
     int ret = pthread_create(&thread_, nullptr, &HiloPID::threadFunc, this);
     if (ret != 0) {
@@ -97,16 +108,17 @@ void* HiloPID::threadFunc(void* arg) {
  */
 void HiloPID::run() {
     // Crear temporizador con retardo absoluto (evita drift acumulativo)
-    Temporizador timer(frequency_);
+    Temporizador timer = crearTemporizador(frequency_, config_);
     
     if (!system_ || !vars_ || !params_) {
         return;
     }
     
-    // Calcular período en microsegundos
-    const double periodo_us = 1000000.0 / frequency_;
-    const double threshold_80 = 0.80 * periodo_us;
-    const double threshold_90 = 0.90 * periodo_us;
+    // Período y umbrales en nanosegundos enteros (los de EventosRT van en us)
+    const std::int64_t periodo_ns = timer.periodoNs();
+    const std::int64_t threshold_80 = periodo_ns * 8 / 10;
+    const std::int64_t threshold_90 = periodo_ns * 9 / 10;
+    const std::int64_t timeout_ns = periodo_ns / 5;   // Timedlock: 20 % del período
 
     // Cast a PIDController para usar setGains
     PIDController* pid = dynamic_cast<PIDController*>(system_);
@@ -116,6 +128,19 @@ void HiloPID::run() {
     
     // Inicializar timestamp anterior
     clock_gettime(CLOCK_MONOTONIC, &t_prev_iteration_);
+    DS_TRACE_THREAD_NAME(logger_.getPrefix());
+    const char* origen = logger_.getPrefix().c_str();   // Para EventosRT::reportar()
+
+    // FTZ/DAZ en este hilo: los estados que decaen no entran en rango subnormal
+    if (config_.flush_to_zero) {
+        activarFlushToZero();
+    }
+
+    // Contadores hardware opcionales (se abren en este hilo)
+    MedidorHW hw;
+    if (config_.contadores_hw) {
+        hw.iniciar(typeid(*system_));
+    }
     
     while (true) {
         iterations_++;
@@ -124,33 +149,35 @@ void HiloPID::run() {
         clock_gettime(CLOCK_MONOTONIC, &t0);
         
         // Calcular Ts real (tiempo desde iteración anterior)
-        double ts_real_us = (t0.tv_sec - t_prev_iteration_.tv_sec) * 1000000.0 +
-                            (t0.tv_nsec - t_prev_iteration_.tv_nsec) / 1000.0;
+        std::int64_t ts_real_ns = difNs(t0, t_prev_iteration_);
         t_prev_iteration_ = t0;  // Actualizar timestamp anterior
         
-        // 1. Verificar si debe seguir ejecutando (con trylock)
+        // 1. Verificar si debe seguir ejecutando (sin lock con token de parada;
+        //    running se sigue leyendo junto a e bajo el mutex)
+        if (config_.parada && config_.parada->detenido()) {
+            break;
+        }
         int ret_trylock = pthread_mutex_trylock(&vars_->mtx);
         clock_gettime(CLOCK_MONOTONIC, &t1);
         
         // Calcular tiempo de espera del mutex
-        double t_espera_us = (t1.tv_sec - t0.tv_sec) * 1000000.0 + 
-                             (t1.tv_nsec - t0.tv_nsec) / 1000.0;
+        std::int64_t t_espera_ns = difNs(t1, t0);
         
         if (ret_trylock == EBUSY) {
+            DS_TRACE_INSTANT("mutex_ocupado");
             // Mutex bloqueado, verificar si supera 80% del período
-            if (t_espera_us > threshold_80) {
-                std::cerr << "ERROR HiloPID [iter " << iterations_ 
-                          << "]: Mutex locked for " << t_espera_us 
-                          << " us (>" << threshold_80 << " us, 80% period). Skipping iteration.\n";
+            if (t_espera_ns > threshold_80) {
+                EventosRT::reportar(origen, CodigoEventoRT::MutexOcupado, iterations_,
+                                    t_espera_ns / 1e3, threshold_80 / 1e3);
                 
                 // Log del error
-                logger_.writeLine(iterations_, t_espera_us, 0, t_espera_us, periodo_us, ts_real_us, "ERROR_MUTEX");
+                logger_.writeLine(iterations_, t_espera_ns, 0, t_espera_ns, periodo_ns, ts_real_ns, "ERROR_MUTEX");
             }
             // Saltar iteración y esperar al siguiente período
             timer.esperar();
             continue;
         } else if (ret_trylock != 0) {
-            std::cerr << "ERROR HiloPID: pthread_mutex_trylock failed with code " << ret_trylock << std::endl;
+            EventosRT::reportar(origen, CodigoEventoRT::ErrorMutex, iterations_, ret_trylock, 0.0);
             timer.esperar();
             continue;
         }
@@ -163,17 +190,20 @@ void HiloPID::run() {
             break; // salir si se recibió SIGINT/SIGTERM o running es false
         }
         
-        // Leer error de entrada (mutex ya bloqueado)
+        // Leer error de entrada y su marca (mutex ya bloqueado)
         double input = vars_->e;
+        MarcaTemporal marca_e = vars_->marca_e;
         pthread_mutex_unlock(&vars_->mtx);
+        if (marca_e.valida()) {
+            timing_.recordEdad(marca_e.t_escritura_ns, marca_e.t_origen_ns, aNs(t1));
+        }
         
         // === EJECUCIÓN DE TAREA ===
         
         // 2. Leer parámetros dinámicos (kp, ki, kd) con timeout de 20% período
-        double timeout_20pct = 0.2 * periodo_us;
         struct timespec timeout_params;
         clock_gettime(CLOCK_MONOTONIC, &timeout_params);
-        long timeout_ns = (long)(timeout_20pct * 1000);
+        const struct timespec inicio_params = timeout_params;
         timeout_params.tv_nsec += timeout_ns;
         if (timeout_params.tv_nsec >= 1000000000L) {
             timeout_params.tv_sec += timeout_params.tv_nsec / 1000000000L;
@@ -184,7 +214,8 @@ void HiloPID::run() {
         double ki = params_->ki;
         double kd = params_->kd;
         
-        int ret_params = pthread_mutex_timedlock(&params_->mtx, &timeout_params);
+        // clocklock: timedlock compararía el plazo (MONOTONIC) con CLOCK_REALTIME
+        int ret_params = pthread_mutex_clocklock(&params_->mtx, CLOCK_MONOTONIC, &timeout_params);
         if (ret_params == 0) {
             // Lock adquirido, leer parámetros frescos
             kp = params_->kp;
@@ -192,10 +223,14 @@ void HiloPID::run() {
             kd = params_->kd;
             pthread_mutex_unlock(&params_->mtx);
         } else if (ret_params == ETIMEDOUT) {
-            logger_.writeLine(iterations_, t_espera_us, 0, t_espera_us, periodo_us, ts_real_us, "ERROR_TIMEDLOCK_PARAMS");
+            logger_.writeLine(iterations_, t_espera_ns, 0, t_espera_ns, periodo_ns, ts_real_ns, "ERROR_TIMEDLOCK_PARAMS");
+            struct timespec fin_params;
+            clock_gettime(CLOCK_MONOTONIC, &fin_params);
+            EventosRT::reportar(origen, CodigoEventoRT::TimeoutParametros, iterations_,
+                                difNs(fin_params, inicio_params) / 1e3, timeout_ns / 1e3);
             // Continuar con parámetros anteriores (cache)
         } else {
-            std::cerr << "ERROR HiloPID: pthread_mutex_timedlock(params) failed with code " << ret_params << std::endl;
+            EventosRT::reportar(origen, CodigoEventoRT::ErrorMutex, iterations_, ret_params, 0.0);
         }
 
         // 3. Actualizar ganancias del PID (fuera de sección crítica)
@@ -204,55 +239,68 @@ void HiloPID::run() {
         }
 
         // 4. Ejecutar PID (no necesita mutex)
+        hw.antes();
         double output = system_->next(input);
+        hw.despues();
+        if (config_.contar_subnormales) {
+            subnormales_.registrar(system_->contarSubnormales());
+        }
         
         // 5. Escribir acción de control (requiere mutex con timeout de 20% período)
         struct timespec timeout_output;
         clock_gettime(CLOCK_MONOTONIC, &timeout_output);
+        const struct timespec inicio_output = timeout_output;
         timeout_output.tv_nsec += timeout_ns;
         if (timeout_output.tv_nsec >= 1000000000L) {
             timeout_output.tv_sec += timeout_output.tv_nsec / 1000000000L;
             timeout_output.tv_nsec %= 1000000000L;
         }
         
-        int ret_output = pthread_mutex_timedlock(&vars_->mtx, &timeout_output);
+        int ret_output = pthread_mutex_clocklock(&vars_->mtx, CLOCK_MONOTONIC, &timeout_output);
         if (ret_output == 0) {
             vars_->u = output;
+            if (marca_e.valida()) {
+                vars_->marca_u.marcar(marca_e.t_origen_ns, MarcaTemporal::ahoraNs());
+            }
             pthread_mutex_unlock(&vars_->mtx);
         } else if (ret_output == ETIMEDOUT) {
-            logger_.writeLine(iterations_, t_espera_us, 0, t_espera_us, periodo_us, ts_real_us, "ERROR_TIMEDLOCK_OUTPUT");
+            logger_.writeLine(iterations_, t_espera_ns, 0, t_espera_ns, periodo_ns, ts_real_ns, "ERROR_TIMEDLOCK_OUTPUT");
+            struct timespec fin_output;
+            clock_gettime(CLOCK_MONOTONIC, &fin_output);
+            EventosRT::reportar(origen, CodigoEventoRT::TimeoutSalida, iterations_,
+                                difNs(fin_output, inicio_output) / 1e3, timeout_ns / 1e3);
             // No escribir si timeout: control anterior se mantiene
         } else {
-            std::cerr << "ERROR HiloPID: pthread_mutex_timedlock(output) failed with code " << ret_output << std::endl;
+            EventosRT::reportar(origen, CodigoEventoRT::ErrorMutex, iterations_, ret_output, 0.0);
         }
         
         // === FIN MEDICIÓN CICLO ===
         clock_gettime(CLOCK_MONOTONIC, &t2);
         
         // Calcular tiempos
-        double t_ejecucion_us = (t2.tv_sec - t1.tv_sec) * 1000000.0 + 
-                                (t2.tv_nsec - t1.tv_nsec) / 1000.0;
-        double t_total_us = (t2.tv_sec - t0.tv_sec) * 1000000.0 + 
-                            (t2.tv_nsec - t0.tv_nsec) / 1000.0;
+        std::int64_t t_ejecucion_ns = difNs(t2, t1);
+        std::int64_t t_total_ns = difNs(t2, t0);
         
         // Determinar estado basado en umbrales
         const char* status;
-        if (t_total_us > periodo_us) {
+        if (t_total_ns > periodo_ns) {
             status = "CRITICAL";
-            std::cerr << "CRITICAL HiloPID [iter " << iterations_ 
-                      << "]: Deadline missed! t_total=" << t_total_us 
-                      << " us > period=" << periodo_us << " us\n";
-        } else if (t_total_us > threshold_90) {
+            EventosRT::reportar(origen, CodigoEventoRT::PlazoPerdido, iterations_,
+                                t_total_ns / 1e3, periodo_ns / 1e3);
+        } else if (t_total_ns > threshold_90) {
             status = "WARNING";
-            std::cerr << "WARNING HiloPID [iter " << iterations_ 
-                      << "]: Near deadline (>90%). t_total=" << t_total_us << " us\n";
+            EventosRT::reportar(origen, CodigoEventoRT::CercaPlazo, iterations_,
+                                t_total_ns / 1e3, threshold_90 / 1e3);
         } else {
             status = "OK";
         }
         
         // Log de timing
-        logger_.writeLine(iterations_, t_espera_us, t_ejecucion_us, t_total_us, 
-                          periodo_us, ts_real_us, status);
+        timing_.record(timer.objetivo(), t0, ts_real_ns, periodo_ns, t_total_ns, iterations_ == 1);
+        DS_TRACE_COMPLETE("lock", t0, t1);
+        DS_TRACE_COMPLETE("iteracion", t0, t2);
+        logger_.writeLine(iterations_, t_espera_ns, t_ejecucion_ns, t_total_ns, 
+                          periodo_ns, ts_real_ns, status);
 
         // 5. Dormir hasta el siguiente período absoluto (sin drift)
         timer.esperar();
@@ -8,7 +8,10 @@
  */
 
 #include "HiloReceptor.h"
+#include "../include/BaseTiempoComun.h"
 #include "../include/Temporizador.h"
+#include "../include/TokenParada.h"
+#include "../include/Tracer.h"
 #include <iostream>
 #include <csignal>
 #include <stdexcept>
@@ -20,9 +23,10 @@
 HiloReceptor::HiloReceptor(std::shared_ptr<Receptor> receptor, 
                            bool* running,
                            std::shared_ptr<pthread_mutex_t> mtx, 
-                           double frequency)
+                           double frequency,
+                           const DiscreteSystems::ConfigHilo& config)
     : receptor_(receptor), running_(running), mtx_(mtx), frequency_(frequency),
-    receptor_raw_(nullptr), running_raw_(nullptr), mtx_raw_(nullptr)
+    receptor_raw_(nullptr), running_raw_(nullptr), mtx_raw_(nullptr), config_(config)
 {
     int ret = pthread_create(&thread_, nullptr, &HiloReceptor::threadFunc, this);
     if (ret != 0) {
@@ -35,9 +39,10 @@ HiloReceptor::HiloReceptor(std::shared_ptr<Receptor> receptor,
  * @brief Constructor con punteros crudos (compatibilidad)
  */
 HiloReceptor::HiloReceptor(Receptor* receptor, bool* running,
-                           pthread_mutex_t* mtx, double frequency)
+                           pthread_mutex_t* mtx, double frequency,
+                           const DiscreteSystems::ConfigHilo& config)
     : receptor_(nullptr), running_(nullptr), mtx_(nullptr), frequency_(frequency),
-    receptor_raw_(receptor), running_raw_(running), mtx_raw_(mtx)
+    receptor_raw_(receptor), running_raw_(running), mtx_raw_(mtx), config_(config)
 {
     int ret = pthread_create(&thread_, nullptr, &HiloReceptor::threadFunc, this);
     if (ret != 0) {
@@ -70,11 +75,12 @@ void* HiloReceptor::threadFunc(void* arg) {
  * @brief Loop principal de ejecución del hilo a frecuencia fija
  * 
  * Ejecuta receptor->recibir() periódicamente mientras *running_ sea true.
- * Lee running bajo protección mutex para evitar condiciones de carrera.
+ * Con ConfigHilo::parada consulta el token sin lock y la espera se
+ * interrumpe al detenerlo; si no, lee running bajo protección mutex.
  * Usa Temporizador con temporización absoluta para eliminar drift.
  */
 void HiloReceptor::run() {
-    DiscreteSystems::Temporizador timer(frequency_);
+    DiscreteSystems::Temporizador timer = DiscreteSystems::crearTemporizador(frequency_, config_);
 
     // Obtener punteros a los objetos
     Receptor* rx = receptor_ ? receptor_.get() : receptor_raw_;
@@ -83,18 +89,26 @@ void HiloReceptor::run() {
     if (!rx || !mtx) {
         return;
     }
+    DS_TRACE_THREAD_NAME("hiloReceptor");
 
     while (true) {
         bool isRunning;
-        pthread_mutex_lock(mtx);
-        isRunning = running_ ? *running_ : *running_raw_;
-        pthread_mutex_unlock(mtx);
+        if (config_.parada) {
+            isRunning = !config_.parada->detenido();   // Sin lock
+        } else {
+            pthread_mutex_lock(mtx);
+            isRunning = running_ ? *running_ : *running_raw_;
+            pthread_mutex_unlock(mtx);
+        }
 
         if (!isRunning)
             break; // salir si se recibió SIGINT/SIGTERM o running es false
 
         // Recibir datos (receptor ya maneja el mutex internamente)
-        rx->recibir(); // No reportar error si no hay mensaje
+        {
+            DS_TRACE_SCOPE("ipc_recibir");
+            rx->recibir(); // No reportar error si no hay mensaje
+        }
 
         timer.esperar();
     }
@@ -0,0 +1,94 @@
+/**
+ * @file HiloRegistrador.cpp
+ * @brief Implementación del hilo de grabación del lazo
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/HiloRegistrador.h"
+#include "../include/BaseTiempoComun.h"
+#include "../include/MarcaTemporal.h"
+#include "../include/Temporizador.h"
+#include "../include/TokenParada.h"
+#include "../include/Tracer.h"
+
+#include <iostream>
+#include <stdexcept>
+
+namespace DiscreteSystems {
+
+HiloRegistrador::HiloRegistrador(std::shared_ptr<RegistradorLazo> registrador,
+                                 VariablesCompartidas* vars,
+                                 pthread_mutex_t* mtx,
+                                 double frequency,
+                                 const ConfigHilo& config)
+    : registrador_(registrador), vars_(vars), mtx_(mtx), frequency_(frequency), config_(config)
+{
+    if (!registrador_ || !vars_ || !mtx_ || frequency_ <= 0.0) {
+        throw std::invalid_argument("HiloRegistrador: argumentos inválidos");
+    }
+    int ret = pthread_create(&thread_, nullptr, &HiloRegistrador::threadFunc, this);
+    if (ret != 0) {
+        std::cerr << "[HiloRegistrador] Error: pthread_create falló con código " << ret << std::endl;
+        throw std::runtime_error("HiloRegistrador - pthread_create falló");
+    }
+}
+
+HiloRegistrador::~HiloRegistrador() {
+    int ret = pthread_join(thread_, nullptr);
+    if (ret != 0) {
+        std::cerr << "[HiloRegistrador] Error: pthread_join falló con código " << ret << std::endl;
+    }
+}
+
+void* HiloRegistrador::threadFunc(void* arg) {
+    HiloRegistrador* self = static_cast<HiloRegistrador*>(arg);
+    self->run();
+    return nullptr;
+}
+
+/**
+ * @brief Loop principal: copia bajo mutex, escribe fuera de él
+ *
+ * append() solo toca memoria mapeada: el segmento siguiente lo prepara el
+ * hilo auxiliar de RegistradorLazo. Si no pudo prepararlo (disco lleno) se
+ * deja de grabar sin detener el lazo.
+ */
+void HiloRegistrador::run() {
+    Temporizador timer = crearTemporizador(frequency_, config_);
+    DS_TRACE_THREAD_NAME("hiloRegistrador");
+
+    while (true) {
+        if (config_.parada && config_.parada->detenido()) {   // Sin lock
+            break;
+        }
+        MuestraLazo m;
+        pthread_mutex_lock(mtx_);
+        bool isRunning = config_.parada ? true : vars_->running;
+        m.ref = vars_->ref;
+        m.e = vars_->e;
+        m.u = vars_->u;
+        m.ua = vars_->ua;
+        m.yk = vars_->yk;
+        m.ykd = vars_->ykd;
+        pthread_mutex_unlock(mtx_);
+
+        if (!isRunning) {
+            break;
+        }
+        m.t_ns = MarcaTemporal::ahoraNs();
+
+        try {
+            registrador_->append(m);
+        } catch (const std::exception& ex) {
+            std::cerr << "[HiloRegistrador] " << ex.what() << ": grabación detenida" << std::endl;
+            break;
+        }
+
+        timer.esperar();
+    }
+
+    pthread_exit(nullptr);
+}
+
+} // namespace DiscreteSystems
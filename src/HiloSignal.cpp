@@ -6,7 +6,11 @@
  */
 
 #include "HiloSignal.h"
+#include "../include/BaseTiempoComun.h"
 #include "../include/Temporizador.h"
+#include "../include/TokenParada.h"
+#include "../include/Tracer.h"
+#include "../include/EntornoFP.h"
 #include <csignal>
 #include <iostream>
 #include <stdexcept>
@@ -21,12 +25,14 @@ HiloSignal::HiloSignal(std::shared_ptr<Signal> signal,
                        bool* running,
                        std::shared_ptr<pthread_mutex_t> mtx, 
                        double frequency,
-                       const std::string& log_prefix)
+                       const std::string& log_prefix,
+                       const DiscreteSystems::ConfigHilo& config)
     : signal_(signal), output_(output), running_(running), mtx_(mtx), 
       frequency_(frequency), signal_raw_(nullptr), output_raw_(nullptr),
-    running_raw_(nullptr), mtx_raw_(nullptr), logger_(log_prefix, 1000), iterations_(0)
+    running_raw_(nullptr), mtx_raw_(nullptr), logger_(log_prefix, 1000), config_(config), iterations_(0)
 {
     logger_.initializeHilo(frequency);
+    logger_.setCpuAccounting(config_.contabilidad_cpu);
     int ret = pthread_create(&thread_, nullptr, &HiloSignal::threadFunc, this);
     if (ret != 0) {
         std::cerr << "[HiloSignal] Error: pthread_create falló con código " << ret << std::endl;
@@ -39,12 +45,14 @@ HiloSignal::HiloSignal(std::shared_ptr<Signal> signal,
  */
 HiloSignal::HiloSignal(Signal* signal, double* output, bool* running,
                        pthread_mutex_t* mtx, double frequency,
-                       const std::string& log_prefix)
+                       const std::string& log_prefix,
+                       const DiscreteSystems::ConfigHilo& config)
     : signal_(nullptr), output_(nullptr), running_(nullptr), mtx_(nullptr),
       frequency_(frequency), signal_raw_(signal), output_raw_(output),
-    running_raw_(running), mtx_raw_(mtx), logger_(log_prefix, 1000), iterations_(0)
+    running_raw_(running), mtx_raw_(mtx), logger_(log_prefix, 1000), config_(config), iterations_(0)
 {
     logger_.initializeHilo(frequency);
+    logger_.setCpuAccounting(config_.contabilidad_cpu);
     int ret = pthread_create(&thread_, nullptr, &HiloSignal::threadFunc, this);
     if (ret != 0) {
         std::cerr << "[HiloSignal] Error: pthread_create falló con código " << ret << std::endl;
@@ -92,24 +100,33 @@ void* HiloSignal::threadFunc(void* arg) {
  * @invariant Acceso a *output_ y *running_ solo dentro de lock_guard
  */
 void HiloSignal::run() {
-    DiscreteSystems::Temporizador timer(frequency_);
-    const double periodo_us = 1000000.0 / frequency_;
+    DiscreteSystems::Temporizador timer = DiscreteSystems::crearTemporizador(frequency_, config_);
+    const std::int64_t periodo_ns = timer.periodoNs();
     clock_gettime(CLOCK_MONOTONIC, &t_prev_iteration_);
+    DS_TRACE_THREAD_NAME(logger_.getPrefix());
+
+    // FTZ/DAZ en este hilo: los estados que decaen no entran en rango subnormal
+    if (config_.flush_to_zero) {
+        DiscreteSystems::activarFlushToZero();
+    }
 
     while (true) {
         iterations_++;
         struct timespec t0;
         clock_gettime(CLOCK_MONOTONIC, &t0);
         
-        double ts_real_us = (t0.tv_sec - t_prev_iteration_.tv_sec) * 1000000.0 +
-                            (t0.tv_nsec - t_prev_iteration_.tv_nsec) / 1000.0;
+        std::int64_t ts_real_ns = DiscreteSystems::difNs(t0, t_prev_iteration_);
         t_prev_iteration_ = t0;
 
         bool isRunning;
         
-        pthread_mutex_lock(mtx_ ? mtx_.get() : mtx_raw_);
-        isRunning = running_ ? *running_ : *running_raw_;
-        pthread_mutex_unlock(mtx_ ? mtx_.get() : mtx_raw_);
+        if (config_.parada) {
+            isRunning = !config_.parada->detenido();   // Sin lock
+        } else {
+            pthread_mutex_lock(mtx_ ? mtx_.get() : mtx_raw_);
+            isRunning = running_ ? *running_ : *running_raw_;
+            pthread_mutex_unlock(mtx_ ? mtx_.get() : mtx_raw_);
+        }
 
         if (!isRunning)
             break;
@@ -123,33 +140,43 @@ void HiloSignal::run() {
 
         struct timespec t2;
         clock_gettime(CLOCK_MONOTONIC, &t2);
-        double t_ejecucion_us = (t2.tv_sec - t1.tv_sec) * 1000000.0 + 
-                                (t2.tv_nsec - t1.tv_nsec) / 1000.0;
+        std::int64_t t_ejecucion_ns = DiscreteSystems::difNs(t2, t1);
 
-        // Guardar salida
-        if (output_) {
+        // Guardar salida (la muestra generada es el origen de su marca)
+        if (output_ && !config_.marca_salida) {
             *output_ = y;
         } else {
-            pthread_mutex_lock(mtx_raw_);
-            *output_raw_ = y;
-            pthread_mutex_unlock(mtx_raw_);
+            pthread_mutex_t* mtx = mtx_ ? mtx_.get() : mtx_raw_;
+            pthread_mutex_lock(mtx);
+            if (output_) {
+                *output_ = y;
+            } else {
+                *output_raw_ = y;
+            }
+            if (config_.marca_salida) {
+                std::int64_t ahora_ns = MarcaTemporal::ahoraNs();
+                config_.marca_salida->marcar(ahora_ns, ahora_ns);
+            }
+            pthread_mutex_unlock(mtx);
         }
 
         struct timespec t3;
         clock_gettime(CLOCK_MONOTONIC, &t3);
-        double t_total_us = (t3.tv_sec - t0.tv_sec) * 1000000.0 + 
-                            (t3.tv_nsec - t0.tv_nsec) / 1000.0;
+        std::int64_t t_total_ns = DiscreteSystems::difNs(t3, t0);
 
         const char* status;
-        if (t_total_us > periodo_us) {
+        if (t_total_ns > periodo_ns) {
             status = "CRITICAL";
-        } else if (t_total_us > 0.9 * periodo_us) {
+        } else if (10 * t_total_ns > 9 * periodo_ns) {
             status = "WARNING";
         } else {
             status = "OK";
         }
 
-        logger_.writeLine(iterations_, 0, t_ejecucion_us, t_total_us, periodo_us, ts_real_us, status);
+        timing_.record(timer.objetivo(), t0, ts_real_ns, periodo_ns, t_total_ns, iterations_ == 1);
+        DS_TRACE_COMPLETE("next", t1, t2);
+        DS_TRACE_COMPLETE("iteracion", t0, t3);
+        logger_.writeLine(iterations_, 0, t_ejecucion_ns, t_total_ns, periodo_ns, ts_real_ns, status);
 
         timer.esperar();
     }
@@ -8,7 +8,11 @@
  */
 
 #include "HiloSwitch.h"
+#include "../include/BaseTiempoComun.h"
 #include "../include/Temporizador.h"
+#include "../include/TokenParada.h"
+#include "../include/Tracer.h"
+#include "../include/EntornoFP.h"
 #include <iostream>
 #include <csignal>
 #include <stdexcept>
@@ -22,13 +26,15 @@ HiloSwitch::HiloSwitch(std::shared_ptr<SignalGenerator::SignalSwitch> signalSwit
                        std::shared_ptr<pthread_mutex_t> mtx, 
                        std::shared_ptr<ParametrosCompartidos> params,
                        double frequency,
-                       const std::string& log_prefix)
+                       const std::string& log_prefix,
+                       const DiscreteSystems::ConfigHilo& config)
     : signalSwitch_(signalSwitch), output_(output), running_(running), 
       mtx_(mtx), params_(params), frequency_(frequency),
       signalSwitch_raw_(nullptr), output_raw_(nullptr), running_raw_(nullptr),
-    mtx_raw_(nullptr), params_raw_(nullptr), logger_(log_prefix, 1000), iterations_(0)
+    mtx_raw_(nullptr), params_raw_(nullptr), logger_(log_prefix, 1000), config_(config), iterations_(0)
 {
     logger_.initializeHilo(frequency);
+    logger_.setCpuAccounting(config_.contabilidad_cpu);
     int ret = pthread_create(&thread_, nullptr, &HiloSwitch::threadFunc, this);
     if (ret != 0) {
         std::cerr << "[HiloSwitch] Error: pthread_create falló con código " << ret << std::endl;
@@ -42,13 +48,15 @@ HiloSwitch::HiloSwitch(std::shared_ptr<SignalGenerator::SignalSwitch> signalSwit
 HiloSwitch::HiloSwitch(SignalGenerator::SignalSwitch* signalSwitch, double* output,
                        bool* running, pthread_mutex_t* mtx, ParametrosCompartidos* params,
                        double frequency,
-                       const std::string& log_prefix)
+                       const std::string& log_prefix,
+                       const DiscreteSystems::ConfigHilo& config)
     : signalSwitch_(nullptr), output_(nullptr), running_(nullptr), 
       mtx_(nullptr), params_(nullptr), frequency_(frequency),
       signalSwitch_raw_(signalSwitch), output_raw_(output), running_raw_(running),
-    mtx_raw_(mtx), params_raw_(params), logger_(log_prefix, 1000), iterations_(0)
+    mtx_raw_(mtx), params_raw_(params), logger_(log_prefix, 1000), config_(config), iterations_(0)
 {
     logger_.initializeHilo(frequency);
+    logger_.setCpuAccounting(config_.contabilidad_cpu);
     int ret = pthread_create(&thread_, nullptr, &HiloSwitch::threadFunc, this);
     if (ret != 0) {
         std::cerr << "[HiloSwitch] Error: pthread_create falló con código " << ret << std::endl;
@@ -84,9 +92,15 @@ void* HiloSwitch::threadFunc(void* arg) {
  * Usa Temporizador con temporización absoluta para eliminar drift.
  */
 void HiloSwitch::run() {
-    DiscreteSystems::Temporizador timer(frequency_);
-    const double periodo_us = 1000000.0 / frequency_;
+    DiscreteSystems::Temporizador timer = DiscreteSystems::crearTemporizador(frequency_, config_);
+    const std::int64_t periodo_ns = timer.periodoNs();
     clock_gettime(CLOCK_MONOTONIC, &t_prev_iteration_);
+    DS_TRACE_THREAD_NAME(logger_.getPrefix());
+
+    // FTZ/DAZ en este hilo: los estados que decaen no entran en rango subnormal
+    if (config_.flush_to_zero) {
+        DiscreteSystems::activarFlushToZero();
+    }
 
     // Obtener punteros a los objetos
     SignalGenerator::SignalSwitch* sig = signalSwitch_ ? signalSwitch_.get() : signalSwitch_raw_;
@@ -103,14 +117,17 @@ void HiloSwitch::run() {
         struct timespec t0;
         clock_gettime(CLOCK_MONOTONIC, &t0);
         
-        double ts_real_us = (t0.tv_sec - t_prev_iteration_.tv_sec) * 1000000.0 +
-                            (t0.tv_nsec - t_prev_iteration_.tv_nsec) / 1000.0;
+        std::int64_t ts_real_ns = DiscreteSystems::difNs(t0, t_prev_iteration_);
         t_prev_iteration_ = t0;
 
         bool isRunning;
-        pthread_mutex_lock(mtx);
-        isRunning = running_ ? *running_ : *running_raw_;
-        pthread_mutex_unlock(mtx);
+        if (config_.parada) {
+            isRunning = !config_.parada->detenido();   // Sin lock
+        } else {
+            pthread_mutex_lock(mtx);
+            isRunning = running_ ? *running_ : *running_raw_;
+            pthread_mutex_unlock(mtx);
+        }
 
         if (!isRunning)
             break; // salir si se recibió SIGINT/SIGTERM o running es false
@@ -144,36 +161,40 @@ void HiloSwitch::run() {
 
         struct timespec t2;
         clock_gettime(CLOCK_MONOTONIC, &t2);
-        double t_ejecucion_us;
 
         // Ejecutar next() del switch (delega a la señal seleccionada)
         double value = sig->next();
 
         struct timespec t3;
         clock_gettime(CLOCK_MONOTONIC, &t3);
-        t_ejecucion_us = (t3.tv_sec - t2.tv_sec) * 1000000.0 + 
-                         (t3.tv_nsec - t2.tv_nsec) / 1000.0;
+        std::int64_t t_ejecucion_ns = DiscreteSystems::difNs(t3, t2);
 
-        // Escribir resultado en variable compartida
+        // Escribir resultado en variable compartida (origen de su marca)
         pthread_mutex_lock(mtx);
         *out = value;
+        if (config_.marca_salida) {
+            std::int64_t ahora_ns = MarcaTemporal::ahoraNs();
+            config_.marca_salida->marcar(ahora_ns, ahora_ns);
+        }
         pthread_mutex_unlock(mtx);
 
         struct timespec t4;
         clock_gettime(CLOCK_MONOTONIC, &t4);
-        double t_total_us = (t4.tv_sec - t0.tv_sec) * 1000000.0 + 
-                            (t4.tv_nsec - t0.tv_nsec) / 1000.0;
+        std::int64_t t_total_ns = DiscreteSystems::difNs(t4, t0);
 
         const char* status;
-        if (t_total_us > periodo_us) {
+        if (t_total_ns > periodo_ns) {
             status = "CRITICAL";
-        } else if (t_total_us > 0.9 * periodo_us) {
+        } else if (10 * t_total_ns > 9 * periodo_ns) {
             status = "WARNING";
         } else {
             status = "OK";
         }
 
-        logger_.writeLine(iterations_, 0, t_ejecucion_us, t_total_us, periodo_us, ts_real_us, status);
+        timing_.record(timer.objetivo(), t0, ts_real_ns, periodo_ns, t_total_ns, iterations_ == 1);
+        DS_TRACE_COMPLETE("next", t2, t3);
+        DS_TRACE_COMPLETE("iteracion", t0, t4);
+        logger_.writeLine(iterations_, 0, t_ejecucion_ns, t_total_ns, periodo_ns, ts_real_ns, status);
 
         // Esperar hasta completar el período (temporización absoluta)
         timer.esperar();
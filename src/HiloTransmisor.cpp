@@ -8,7 +8,10 @@
  */
 
 #include "HiloTransmisor.h"
+#include "../include/BaseTiempoComun.h"
 #include "../include/Temporizador.h"
+#include "../include/TokenParada.h"
+#include "../include/Tracer.h"
 #include <iostream>
 #include <csignal>
 #include <stdexcept>
@@ -20,9 +23,10 @@
 HiloTransmisor::HiloTransmisor(std::shared_ptr<Transmisor> transmisor, 
                                bool* running,
                                std::shared_ptr<pthread_mutex_t> mtx, 
-                               double frequency)
+                               double frequency,
+                               const DiscreteSystems::ConfigHilo& config)
     : transmisor_(transmisor), running_(running), mtx_(mtx), frequency_(frequency),
-    transmisor_raw_(nullptr), running_raw_(nullptr), mtx_raw_(nullptr)
+    transmisor_raw_(nullptr), running_raw_(nullptr), mtx_raw_(nullptr), config_(config)
 {
     int ret = pthread_create(&thread_, nullptr, &HiloTransmisor::threadFunc, this);
     if (ret != 0) {
@@ -35,9 +39,10 @@ HiloTransmisor::HiloTransmisor(std::shared_ptr<Transmisor> transmisor,
  * @brief Constructor con punteros crudos (compatibilidad)
  */
 HiloTransmisor::HiloTransmisor(Transmisor* transmisor, bool* running,
-                               pthread_mutex_t* mtx, double frequency)
+                               pthread_mutex_t* mtx, double frequency,
+                               const DiscreteSystems::ConfigHilo& config)
     : transmisor_(nullptr), running_(nullptr), mtx_(nullptr), frequency_(frequency),
-    transmisor_raw_(transmisor), running_raw_(running), mtx_raw_(mtx)
+    transmisor_raw_(transmisor), running_raw_(running), mtx_raw_(mtx), config_(config)
 {
     int ret = pthread_create(&thread_, nullptr, &HiloTransmisor::threadFunc, this);
     if (ret != 0) {
@@ -70,30 +75,39 @@ void* HiloTransmisor::threadFunc(void* arg) {
  * @brief Loop principal de ejecución del hilo a frecuencia fija
  * 
  * Ejecuta transmisor->enviar() periódicamente mientras *running_ sea true.
- * Lee running bajo protección mutex para evitar condiciones de carrera.
+ * Con ConfigHilo::parada consulta el token sin lock y la espera se
+ * interrumpe al detenerlo; si no, lee running bajo protección mutex.
  * Usa Temporizador con temporización absoluta para eliminar drift.
  */
 void HiloTransmisor::run() {
-    DiscreteSystems::Temporizador timer(frequency_);
+    DiscreteSystems::Temporizador timer = DiscreteSystems::crearTemporizador(frequency_, config_);
 
     // Obtener punteros
     Transmisor* trans = transmisor_ ? transmisor_.get() : transmisor_raw_;
     if (!trans) {
         return;
     }
+    DS_TRACE_THREAD_NAME("hiloTransmisor");
 
     while (true) {
         bool isRunning;
-        pthread_mutex_lock(mtx_ ? mtx_.get() : mtx_raw_);
-        isRunning = running_ ? *running_ : *running_raw_;
-        pthread_mutex_unlock(mtx_ ? mtx_.get() : mtx_raw_);
+        if (config_.parada) {
+            isRunning = !config_.parada->detenido();   // Sin lock
+        } else {
+            pthread_mutex_lock(mtx_ ? mtx_.get() : mtx_raw_);
+            isRunning = running_ ? *running_ : *running_raw_;
+            pthread_mutex_unlock(mtx_ ? mtx_.get() : mtx_raw_);
+        }
 
         if (!isRunning) {
             break;
         }
 
-        if (!trans->enviar()) {
-            std::cerr << "HiloTransmisor: Error al enviar datos" << std::endl;
+        {
+            DS_TRACE_SCOPE("ipc_enviar");
+            if (!trans->enviar()) {
+                std::cerr << "HiloTransmisor: Error al enviar datos" << std::endl;
+            }
         }
 
         timer.esperar();
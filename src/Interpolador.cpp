@@ -0,0 +1,135 @@
+/**
+ * @file Interpolador.cpp
+ * @brief Implementación del interpolador CIC / FIR polifásico
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "Interpolador.h"
+#include "Diagnostico.h"
+#include "EntornoFP.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace DiscreteSystems {
+
+/**
+ * @brief Constructor con filtro por defecto (CIC de orden parametro o FIR diseñado)
+ */
+Interpolador::Interpolador(size_t factor, FiltroMultitasa tipo, double Ts,
+                           size_t parametro, size_t bufferSize)
+    : Interpolador(factor,
+                   tipo == FiltroMultitasa::FIR ? disenarPasoBajoMultitasa(factor, parametro)
+                                                : std::vector<double>{1.0},
+                   Ts, bufferSize)
+{
+    if (tipo == FiltroMultitasa::CIC) {
+        CuantificadorCIC::validar(factor, parametro);
+        tipo_ = FiltroMultitasa::CIC;
+        peines_.assign(parametro, 0);
+        integradores_.assign(parametro, 0);
+        ganancia_ = std::pow(static_cast<double>(factor), static_cast<double>(parametro - 1));
+        polifase_.clear();
+        historial_.clear();
+        K_ = 0;
+    }
+}
+
+/**
+ * @brief Constructor FIR: reordena h en subfiltros polifásicos normalizados
+ */
+Interpolador::Interpolador(size_t factor, const std::vector<double>& h, double Ts, size_t bufferSize)
+    : DiscreteSystem(Ts, bufferSize), factor_(factor), tipo_(FiltroMultitasa::FIR),
+      fase_(0), entradas_(0), K_(0), ganancia_(1.0)
+{
+    if (factor_ < 2 || h.empty()) {
+        throw std::invalid_argument("Interpolador: factor >= 2 y al menos un coeficiente");
+    }
+    // Salida de fase p: y(mN + p) = Σ_j g[p + jN] · x(m − j). Cada subfiltro
+    // se normaliza a ganancia unidad en continua (≈ N·h con un h de ganancia
+    // unidad): si no, una entrada constante sale con rizado a la tasa baja
+    K_ = (h.size() + factor_ - 1) / factor_;
+    polifase_.assign(factor_ * K_, 0.0);
+    for (size_t p = 0; p < factor_; ++p) {
+        double suma = 0.0;
+        for (size_t j = 0; j < K_; ++j) {
+            size_t i = p + j * factor_;
+            polifase_[p * K_ + j] = i < h.size() ? h[i] : 0.0;
+            suma += polifase_[p * K_ + j];
+        }
+        const double escala = std::fabs(suma) > 1e-12 ? 1.0 / suma : static_cast<double>(factor_);
+        for (size_t j = 0; j < K_; ++j) {
+            polifase_[p * K_ + j] *= escala;
+        }
+    }
+    historial_.assign(K_, 0.0);
+
+    DS_DIAG("Objeto de tipo Interpolador creado correctamente (factor = " << factor_ << ")");
+}
+
+double Interpolador::compute(double uk)
+{
+    double y = tipo_ == FiltroMultitasa::FIR ? computeFIR(uk) : computeCIC(uk);
+    if (++fase_ == factor_) {
+        fase_ = 0;
+    }
+    return y;
+}
+
+/**
+ * @brief FIR polifásico: ⌈L/N⌉ MAC por salida
+ */
+double Interpolador::computeFIR(double uk)
+{
+    double* x = historial_.data();
+    if (fase_ == 0) {
+        std::copy_backward(x, x + K_ - 1, x + K_);
+        x[0] = uk;
+        ++entradas_;
+    }
+    const double* c = &polifase_[fase_ * K_];
+    double y = 0.0;
+    for (size_t j = 0; j < K_; ++j) {
+        y += c[j] * x[j];
+    }
+    return y;
+}
+
+/**
+ * @brief CIC: peines en la fase 0, integradores en todas las llamadas
+ */
+double Interpolador::computeCIC(double uk)
+{
+    std::uint64_t v = 0;   // Relleno de ceros fuera de la fase 0
+    if (fase_ == 0) {
+        v = CuantificadorCIC::cuantificar(uk);
+        for (auto& prev : peines_) {
+            std::uint64_t d = v - prev;
+            prev = v;
+            v = d;
+        }
+        ++entradas_;
+    }
+    for (auto& integ : integradores_) {
+        integ += v;
+        v = integ;
+    }
+    return CuantificadorCIC::reconstruir(v, ganancia_);
+}
+
+void Interpolador::resetState()
+{
+    fase_ = 0;
+    entradas_ = 0;
+    std::fill(historial_.begin(), historial_.end(), 0.0);
+    std::fill(peines_.begin(), peines_.end(), 0);
+    std::fill(integradores_.begin(), integradores_.end(), 0);
+}
+
+size_t Interpolador::contarSubnormales() const
+{
+    return DiscreteSystems::contarSubnormales(historial_.data(), historial_.size());
+}
+
+} // namespace DiscreteSystems
@@ -1,10 +1,20 @@
 #include "InterruptorArranque.h"
+#include "TokenParada.h"
+#include <csignal>
+
+extern volatile sig_atomic_t g_signal_run;
 
 InterruptorArranque::InterruptorArranque() : run_(0) {
 }
 
 void InterruptorArranque::setRun(int value) {
     run_ = value;
+    if (value == 0) {
+        DiscreteSystems::TokenParada::proceso().detener();
+    } else if (g_signal_run) {
+        // Tras SIGINT/SIGTERM el token sigue detenido
+        DiscreteSystems::TokenParada::proceso().rearmar();
+    }
 }
 
 int InterruptorArranque::getRun() const {
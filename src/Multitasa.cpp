@@ -0,0 +1,64 @@
+/**
+ * @file Multitasa.cpp
+ * @brief Diseño del paso bajo multitasa y aritmética entera del CIC
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/Multitasa.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace DiscreteSystems {
+
+std::vector<double> disenarPasoBajoMultitasa(std::size_t factor, std::size_t taps_por_fase)
+{
+    if (factor < 2 || taps_por_fase == 0) {
+        throw std::invalid_argument("disenarPasoBajoMultitasa: factor >= 2 y taps_por_fase >= 1");
+    }
+    const std::size_t L = factor * taps_por_fase;
+    const double fc = 0.5 / static_cast<double>(factor);   // ciclos/muestra de la tasa alta
+    const double centro = 0.5 * static_cast<double>(L - 1);
+    std::vector<double> h(L);
+    double suma = 0.0;
+    for (std::size_t i = 0; i < L; ++i) {
+        double t = static_cast<double>(i) - centro;
+        double sinc = (t == 0.0) ? 2.0 * fc : std::sin(2.0 * M_PI * fc * t) / (M_PI * t);
+        double ventana = (L > 1) ? 0.54 - 0.46 * std::cos(2.0 * M_PI * i / static_cast<double>(L - 1)) : 1.0;
+        h[i] = sinc * ventana;
+        suma += h[i];
+    }
+    for (double& c : h) {
+        c /= suma;
+    }
+    return h;
+}
+
+void CuantificadorCIC::validar(std::size_t factor, std::size_t orden)
+{
+    if (factor < 2 || orden == 0) {
+        throw std::invalid_argument("CIC: factor >= 2 y orden >= 1");
+    }
+    // La salida (|u| < 2^kBitsRango, con ganancia factor^orden) debe caber en 63 bits
+    const double bits = static_cast<double>(orden) * std::log2(static_cast<double>(factor));
+    if (bits + kBitsFraccion + kBitsRango > 63.0) {
+        throw std::invalid_argument("CIC: factor^orden demasiado grande para 64 bits");
+    }
+}
+
+std::uint64_t CuantificadorCIC::cuantificar(double u)
+{
+    const double limite = std::ldexp(1.0, kBitsRango) - 1.0;
+    if (std::isnan(u)) u = 0.0;
+    if (u > limite) u = limite;
+    if (u < -limite) u = -limite;
+    return static_cast<std::uint64_t>(std::llround(std::ldexp(u, kBitsFraccion)));
+}
+
+double CuantificadorCIC::reconstruir(std::uint64_t v, double ganancia)
+{
+    return std::ldexp(static_cast<double>(static_cast<std::int64_t>(v)), -kBitsFraccion) / ganancia;
+}
+
+} // namespace DiscreteSystems
@@ -6,22 +6,24 @@
  */
 
 #include "PIDController.h"
+#include "Diagnostico.h"
+#include "EntornoFP.h"
+#include <algorithm>
 
 namespace DiscreteSystems {
 
 /**
  * @brief Constructor del controlador PID
  * 
- * Inicializa los parámetros de ganancia (Kp, Ki, Kd) y prepara los
- * historiadores de error y control vacíos para la primera ejecución.
+ * Inicializa los parámetros de ganancia (Kp, Ki, Kd) y parte de
+ * e(k-1) = e(k-2) = u(k-1) = 0 para la primera ejecución.
  */
 PIDController::PIDController(double Kp, double Ki, double Kd, double Ts, 
                   size_t bufferSize):
-    DiscreteSystem(Ts, bufferSize), Kp_(Kp), Ki_(Ki), Kd_(Kd)  
+    DiscreteSystem(Ts, bufferSize), e_k1_(0.0), e_k2_(0.0), u_k1_(0.0), hayControl_(false),
+    Kp_(Kp), Ki_(Ki), Kd_(Kd)  
 {
-     eHist_.clear();
-    uHist_.clear();
-    std::cout << "Objeto de tipo PIDController creado correctamente" << std::endl;
+    DS_DIAG("Objeto de tipo PIDController creado correctamente");
 }
 
 /**
@@ -38,19 +40,18 @@ PIDController::PIDController(double Kp, double Ki, double Kd, double Ts,
  */
 double PIDController::compute(double ek){
        
-    double e_k1 = (eHist_.size() >= 1) ? eHist_.back() : 0.0;          // e[k-1]
-double e_k2 = (eHist_.size() >= 2) ? eHist_[eHist_.size() - 2] : 0.0; // e[k-2]
-    double u_k_minus_1 = uHist_.empty() ? 0.0 : uHist_.back();
-
     double a0 = Kp_ + Ki_ * getSamplingTime() + Kd_ / getSamplingTime();
     double a1 = -Kp_ - 2.0 * Kd_ / getSamplingTime();
     double a2 = Kd_ / getSamplingTime();
 
-    double delta_u = a0 * ek + a1 * e_k1 + a2 * e_k2;
-    double u_k = u_k_minus_1 + delta_u;
+    double delta_u = a0 * ek + a1 * e_k1_ + a2 * e_k2_;
+    double u_k = u_k1_ + delta_u;
 
-    eHist_.push_back(ek);
-    uHist_.push_back(u_k);
+    // Solo se guarda lo que usa la siguiente iteración
+    e_k2_ = e_k1_;
+    e_k1_ = ek;
+    u_k1_ = u_k;
+    hayControl_ = true;
 
     return u_k;
 
@@ -60,13 +61,15 @@ double e_k2 = (eHist_.size() >= 2) ? eHist_[eHist_.size() - 2] : 0.0; // e[k-2]
 /**
  * @brief Reinicia el estado interno del controlador PID
  * 
- * Limpia los historiadores de error y control para preparar el
- * PID para una nueva simulación desde condiciones iniciales.
+ * Pone a cero e(k-1), e(k-2) y u(k-1) para preparar el PID para
+ * una nueva simulación desde condiciones iniciales.
  */
 void PIDController::resetState(){
-    eHist_.clear();
-    uHist_.clear();
-    std::cout << "ResetState ejecutado" << std::endl;
+    e_k1_ = 0.0;
+    e_k2_ = 0.0;
+    u_k1_ = 0.0;
+    hayControl_ = false;
+    DS_DIAG("ResetState de PIDController ejecutado");
 }
 
 /**
@@ -81,8 +84,8 @@ void PIDController::resetState(){
  */
 std::ostream& operator<<(std::ostream& os, const PIDController& pid)
 {
-    if (!pid.uHist_.empty()) {
-        os << "Última salida u[k] = " << pid.uHist_.back();
+    if (pid.hayControl_) {
+        os << "Última salida u[k] = " << pid.u_k1_;
     } else {
         os << "No hay salidas aún";
     }
@@ -153,7 +156,15 @@ double PIDController::getKd() const {
  * @return Valor u[k-1]
  */
 double PIDController::getLastControl() const {
-    return uHist_.empty() ? 0.0 : uHist_.back();
+    return u_k1_;
+}
+
+/**
+ * @brief Estados subnormales: e(k-1), e(k-2) y u(k-1), los únicos que usa compute()
+ */
+size_t PIDController::contarSubnormales() const {
+    const double estado[3] = { e_k1_, e_k2_, u_k1_ };
+    return DiscreteSystems::contarSubnormales(estado, 3);
 }
 
 
@@ -0,0 +1,373 @@
+/**
+ * @file RegistradorLazo.cpp
+ * @brief Implementación del registro columnar mapeado en memoria
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/RegistradorLazo.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <stdexcept>
+
+namespace DiscreteSystems {
+
+namespace {
+
+const char kMagic[8] = {'D', 'S', 'R', 'E', 'C', '0', '0', '1'};
+const char* const kNombres[CabeceraRegistro::kColumnas] = {
+    "t_ns", "ref", "e", "u", "ua", "yk", "ykd"
+};
+
+std::int64_t ahora(clockid_t reloj) {
+    struct timespec ts;
+    clock_gettime(reloj, &ts);
+    return static_cast<std::int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+} // namespace
+
+// ============================================================================
+// RegistradorLazo
+// ============================================================================
+
+RegistradorLazo::RegistradorLazo(const std::string& path, double periodo_nominal_s,
+                                 std::size_t muestras_chunk, std::size_t chunks_segmento)
+    : path_(path), fd_(-1), cab_(nullptr), seg_(nullptr), seg_bytes_(0), seg_chunk0_(0),
+      chunks_segmento_(chunks_segmento), n_chunk_(muestras_chunk),
+      chunk_bytes_(muestras_chunk * CabeceraRegistro::kColumnas * 8),
+      chunk_(0), pos_(0), muestras_(0), col_t_(nullptr), col_{},
+      sig_(nullptr), sig_chunk0_(0), liberar_(nullptr), pedido_(false), fin_(false)
+{
+    if (muestras_chunk == 0 || muestras_chunk % 512 != 0) {
+        throw std::invalid_argument("RegistradorLazo: muestras_chunk debe ser múltiplo de 512");
+    }
+    if (chunks_segmento == 0) {
+        throw std::invalid_argument("RegistradorLazo: chunks_segmento debe ser > 0");
+    }
+
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd_ < 0) {
+        throw std::runtime_error("RegistradorLazo: no se puede crear " + path +
+                                 ": " + std::strerror(errno));
+    }
+    if (::ftruncate(fd_, CabeceraRegistro::kTamano) != 0) {
+        int err = errno;
+        ::close(fd_);
+        throw std::runtime_error("RegistradorLazo: ftruncate falló para " + path +
+                                 ": " + std::strerror(err));
+    }
+    void* p = ::mmap(nullptr, CabeceraRegistro::kTamano, PROT_READ | PROT_WRITE,
+                     MAP_SHARED, fd_, 0);
+    if (p == MAP_FAILED) {
+        int err = errno;
+        ::close(fd_);
+        throw std::runtime_error("RegistradorLazo: mmap falló para " + path +
+                                 ": " + std::strerror(err));
+    }
+    cab_ = static_cast<CabeceraRegistro*>(p);
+
+    std::memcpy(cab_->magic, kMagic, sizeof(kMagic));
+    cab_->version = CabeceraRegistro::kVersion;
+    cab_->columnas = CabeceraRegistro::kColumnas;
+    cab_->muestras_chunk = muestras_chunk;
+    cab_->muestras = 0;
+    cab_->t0_monotonic_ns = ahora(CLOCK_MONOTONIC);
+    cab_->t0_realtime_ns = ahora(CLOCK_REALTIME);
+    cab_->periodo_nominal_s = periodo_nominal_s;
+    for (std::uint32_t c = 0; c < CabeceraRegistro::kColumnas; ++c) {
+        std::strncpy(cab_->nombres[c], kNombres[c], sizeof(cab_->nombres[c]) - 1);
+    }
+
+    try {
+        seg_ = mapearSegmento(0);
+    } catch (...) {
+        ::munmap(cab_, CabeceraRegistro::kTamano);
+        ::close(fd_);
+        throw;
+    }
+    seg_bytes_ = chunks_segmento_ * chunk_bytes_;
+    usarChunk(0);
+
+    // El segundo segmento se prepara ya: el primer cambio tampoco espera
+    sig_chunk0_ = chunks_segmento_;
+    pedido_ = true;
+    try {
+        ayudante_ = std::thread(&RegistradorLazo::ayudante, this);
+    } catch (...) {
+        ::munmap(seg_, seg_bytes_);
+        ::munmap(cab_, CabeceraRegistro::kTamano);
+        ::close(fd_);
+        throw;
+    }
+}
+
+RegistradorLazo::~RegistradorLazo() {
+    {
+        std::lock_guard<std::mutex> lock(ayuda_mtx_);
+        fin_ = true;
+    }
+    ayuda_cv_.notify_all();
+    ayudante_.join();
+
+    if (liberar_) {
+        ::munmap(liberar_, seg_bytes_);
+    }
+    if (sig_) {
+        ::munmap(sig_, seg_bytes_);
+    }
+    // Se descarta el segmento preparado sin usar: el fichero acaba en el actual
+    const off_t fin = static_cast<off_t>(CabeceraRegistro::kTamano +
+                                         (seg_chunk0_ + chunks_segmento_) * chunk_bytes_);
+    if (::ftruncate(fd_, fin) != 0) {
+        std::cerr << "[RegistradorLazo] ftruncate final falló para " << path_ << ": "
+                  << std::strerror(errno) << std::endl;
+    }
+    if (seg_) {
+        ::msync(seg_, seg_bytes_, MS_ASYNC);
+        ::munmap(seg_, seg_bytes_);
+    }
+    if (cab_) {
+        ::msync(cab_, CabeceraRegistro::kTamano, MS_SYNC);
+        ::munmap(cab_, CabeceraRegistro::kTamano);
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+void RegistradorLazo::sincronizar() {
+    if (seg_) {
+        ::msync(seg_, seg_bytes_, MS_ASYNC);
+    }
+    ::msync(cab_, CabeceraRegistro::kTamano, MS_ASYNC);
+}
+
+/**
+ * @brief Amplía el fichero y mapea chunks_segmento_ chunks desde primer_chunk
+ *
+ * MAP_POPULATE prefalla las páginas del segmento para que las escrituras de
+ * append() no paguen fallos de página mayores en mitad del lazo. Salvo el
+ * primero, lo llama el hilo auxiliar.
+ */
+void* RegistradorLazo::mapearSegmento(std::size_t primer_chunk) {
+    const std::size_t bytes = chunks_segmento_ * chunk_bytes_;
+    const off_t offset = static_cast<off_t>(CabeceraRegistro::kTamano + primer_chunk * chunk_bytes_);
+    if (::ftruncate(fd_, offset + static_cast<off_t>(bytes)) != 0) {
+        throw std::runtime_error("RegistradorLazo: no se puede ampliar " + path_ +
+                                 ": " + std::strerror(errno));
+    }
+    void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, offset);
+    if (p == MAP_FAILED) {
+        throw std::runtime_error("RegistradorLazo: mmap falló para " + path_ +
+                                 ": " + std::strerror(errno));
+    }
+    return p;
+}
+
+void RegistradorLazo::usarChunk(std::size_t chunk) {
+    chunk_ = chunk;
+    pos_ = 0;
+    char* base = static_cast<char*>(seg_) + (chunk - seg_chunk0_) * chunk_bytes_;
+    col_t_ = reinterpret_cast<std::int64_t*>(base);
+    for (int c = 0; c < 6; ++c) {
+        col_[c] = reinterpret_cast<double*>(base + (c + 1) * n_chunk_ * 8);
+    }
+}
+
+void RegistradorLazo::siguienteChunk() {
+    const std::size_t siguiente = chunk_ + 1;
+    if (siguiente - seg_chunk0_ >= chunks_segmento_) {
+        cambiarSegmento();
+        return;
+    }
+    usarChunk(siguiente);
+}
+
+/**
+ * @brief Pasa al segmento que preparó el hilo auxiliar y le encarga el siguiente
+ *
+ * En régimen normal sig_ ya está listo: el mutex no tiene contención y el
+ * único coste es el notify. El munmap del segmento anterior lo hace el
+ * hilo auxiliar.
+ */
+void RegistradorLazo::cambiarSegmento() {
+    std::unique_lock<std::mutex> lock(ayuda_mtx_);
+    ayuda_cv_.wait(lock, [this] { return sig_ != nullptr || !error_.empty(); });
+    if (!sig_) {
+        throw std::runtime_error(error_);
+    }
+    liberar_ = seg_;
+    seg_ = sig_;
+    seg_chunk0_ = sig_chunk0_;
+    sig_ = nullptr;
+    sig_chunk0_ = seg_chunk0_ + chunks_segmento_;
+    pedido_ = true;
+    lock.unlock();
+    ayuda_cv_.notify_all();
+    usarChunk(seg_chunk0_);
+}
+
+void RegistradorLazo::ayudante() {
+    std::unique_lock<std::mutex> lock(ayuda_mtx_);
+    while (true) {
+        ayuda_cv_.wait(lock, [this] { return fin_ || pedido_; });
+        if (fin_) {
+            break;
+        }
+        pedido_ = false;
+        void* viejo = liberar_;
+        liberar_ = nullptr;
+        const std::size_t primer = sig_chunk0_;
+        lock.unlock();
+
+        if (viejo) {
+            ::munmap(viejo, seg_bytes_);
+        }
+        void* p = nullptr;
+        std::string error;
+        try {
+            p = mapearSegmento(primer);
+        } catch (const std::exception& ex) {
+            error = ex.what();
+        }
+
+        lock.lock();
+        sig_ = p;
+        error_ = error;
+        ayuda_cv_.notify_all();
+    }
+}
+
+// ============================================================================
+// LectorRegistro
+// ============================================================================
+
+LectorRegistro::LectorRegistro(const std::string& path)
+    : map_(nullptr), map_size_(0), cab_(nullptr), datos_(nullptr),
+      n_chunk_(0), chunk_bytes_(0), muestras_(0)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("LectorRegistro: no se puede abrir " + path +
+                                 ": " + std::strerror(errno));
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < CabeceraRegistro::kTamano) {
+        ::close(fd);
+        throw std::runtime_error("LectorRegistro: fichero demasiado corto: " + path);
+    }
+    map_size_ = static_cast<std::size_t>(st.st_size);
+    map_ = ::mmap(nullptr, map_size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);   // El mapa mantiene su propia referencia al fichero
+    if (map_ == MAP_FAILED) {
+        map_ = nullptr;
+        throw std::runtime_error("LectorRegistro: mmap falló para " + path +
+                                 ": " + std::strerror(errno));
+    }
+
+    cab_ = static_cast<const CabeceraRegistro*>(map_);
+    if (std::memcmp(cab_->magic, kMagic, sizeof(kMagic)) != 0 ||
+        cab_->version != CabeceraRegistro::kVersion ||
+        cab_->columnas != CabeceraRegistro::kColumnas ||
+        cab_->muestras_chunk == 0) {
+        ::munmap(map_, map_size_);
+        map_ = nullptr;
+        throw std::runtime_error("LectorRegistro: cabecera inválida en " + path);
+    }
+
+    n_chunk_ = static_cast<std::size_t>(cab_->muestras_chunk);
+    chunk_bytes_ = n_chunk_ * CabeceraRegistro::kColumnas * 8;
+    datos_ = static_cast<const char*>(map_) + CabeceraRegistro::kTamano;
+
+    // Filas completas presentes en el fichero (un escritor vivo puede ir por delante)
+    const std::uint64_t en_fichero =
+        static_cast<std::uint64_t>((map_size_ - CabeceraRegistro::kTamano) / chunk_bytes_) * n_chunk_;
+    muestras_ = std::min<std::uint64_t>(__atomic_load_n(&cab_->muestras, __ATOMIC_ACQUIRE), en_fichero);
+}
+
+LectorRegistro::~LectorRegistro() {
+    if (map_) {
+        ::munmap(map_, map_size_);
+    }
+}
+
+MuestraLazo LectorRegistro::muestra(std::uint64_t i) const {
+    MuestraLazo m;
+    m.t_ns = tiempo(i);
+    m.ref = valor(ColumnaLazo::Ref, i);
+    m.e = valor(ColumnaLazo::E, i);
+    m.u = valor(ColumnaLazo::U, i);
+    m.ua = valor(ColumnaLazo::Ua, i);
+    m.yk = valor(ColumnaLazo::Yk, i);
+    m.ykd = valor(ColumnaLazo::Ykd, i);
+    return m;
+}
+
+const double* LectorRegistro::tramo(ColumnaLazo c, std::uint64_t i, std::size_t& n) const {
+    if (i >= muestras_) {
+        n = 0;
+        return nullptr;
+    }
+    const std::size_t offset = static_cast<std::size_t>(i % n_chunk_);
+    n = static_cast<std::size_t>(std::min<std::uint64_t>(n_chunk_ - offset, muestras_ - i));
+    return columna(c, i) + offset;
+}
+
+std::size_t LectorRegistro::leer(ColumnaLazo c, std::uint64_t inicio, std::size_t n, double* out) const {
+    std::size_t copiados = 0;
+    while (copiados < n) {
+        std::size_t disponibles = 0;
+        const double* p = tramo(c, inicio + copiados, disponibles);
+        if (!p) {
+            break;
+        }
+        const std::size_t k = std::min(disponibles, n - copiados);
+        std::memcpy(out + copiados, p, k * sizeof(double));
+        copiados += k;
+    }
+    return copiados;
+}
+
+std::size_t LectorRegistro::leerTiempos(std::uint64_t inicio, std::size_t n, std::int64_t* out) const {
+    std::size_t copiados = 0;
+    while (copiados < n && inicio + copiados < muestras_) {
+        const std::uint64_t i = inicio + copiados;
+        const std::size_t offset = static_cast<std::size_t>(i % n_chunk_);
+        const std::size_t k = static_cast<std::size_t>(std::min<std::uint64_t>(
+            {n_chunk_ - offset, muestras_ - i, n - copiados}));
+        std::memcpy(out + copiados, reinterpret_cast<const std::int64_t*>(chunk(i)) + offset,
+                    k * sizeof(std::int64_t));
+        copiados += k;
+    }
+    return copiados;
+}
+
+void LectorRegistro::aconsejarSecuencial() const {
+    ::madvise(map_, map_size_, MADV_SEQUENTIAL);
+}
+
+std::uint64_t LectorRegistro::buscarTiempo(std::int64_t t) const {
+    std::uint64_t lo = 0;
+    std::uint64_t hi = muestras_;
+    while (lo < hi) {
+        const std::uint64_t mid = lo + (hi - lo) / 2;
+        if (tiempo(mid) < t) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+} // namespace DiscreteSystems
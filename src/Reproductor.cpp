@@ -0,0 +1,102 @@
+/**
+ * @file Reproductor.cpp
+ * @brief Implementación de la reproducción de registros por bloques
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/Reproductor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+namespace DiscreteSystems {
+
+Reproductor::Reproductor(const LectorRegistro& lector) : lector_(lector) {}
+
+Reproductor& Reproductor::etapa(DiscreteSystem& sys) {
+    etapas_.push_back(&sys);
+    return *this;
+}
+
+ResultadoReproduccion Reproductor::ejecutar(ColumnaLazo entrada, ColumnaLazo salida,
+                                            const OpcionesReproduccion& op) {
+    return reproducir(entrada, nullptr, salida, op);
+}
+
+ResultadoReproduccion Reproductor::ejecutar(ColumnaLazo entrada1, ColumnaLazo entrada2,
+                                            ColumnaLazo salida, const OpcionesReproduccion& op) {
+    return reproducir(entrada1, &entrada2, salida, op);
+}
+
+ResultadoReproduccion Reproductor::reproducir(ColumnaLazo entrada1, const ColumnaLazo* entrada2,
+                                              ColumnaLazo salida, const OpcionesReproduccion& op) {
+    if (etapas_.empty()) {
+        throw std::invalid_argument("Reproductor: la cadena no tiene bloques");
+    }
+    if (op.bloque == 0) {
+        throw std::invalid_argument("Reproductor: el tamaño de bloque debe ser > 0");
+    }
+
+    ResultadoReproduccion r;
+    const std::uint64_t total = lector_.muestras();
+    const std::uint64_t inicio = std::min(op.inicio, total);
+    const std::uint64_t fin = inicio + std::min(op.muestras, total - inicio);
+
+    // Dos bloques de trabajo: cada etapa escribe en el que no lee
+    std::vector<double> a(op.bloque), b(op.bloque);
+    std::vector<double> in2(entrada2 ? op.bloque : 0);
+    double suma_cuadrados = 0.0;
+
+    lector_.aconsejarSecuencial();
+    auto t0 = std::chrono::steady_clock::now();
+
+    std::uint64_t fila = inicio;
+    while (fila < fin) {
+        // Entrada sin copia: como mucho hasta el final del chunk actual
+        std::size_t n = 0;
+        const double* u = lector_.tramo(entrada1, fila, n);
+        n = static_cast<std::size_t>(std::min<std::uint64_t>({n, op.bloque, fin - fila}));
+
+        const double* actual = u;
+        double* destino = a.data();
+        for (std::size_t s = 0; s < etapas_.size(); ++s) {
+            if (s == 0 && entrada2) {
+                lector_.leer(*entrada2, fila, n, in2.data());
+                etapas_[s]->process(actual, in2.data(), destino, n);
+            } else {
+                etapas_[s]->process(actual, destino, n);
+            }
+            actual = destino;
+            destino = (destino == a.data()) ? b.data() : a.data();
+        }
+
+        // Comparación contra la salida grabada (también sin copia)
+        std::size_t m = 0;
+        const double* esperado = lector_.tramo(salida, fila, m);
+        for (std::size_t i = 0; i < n; ++i) {
+            const double err = std::fabs(actual[i] - esperado[i]);
+            suma_cuadrados += err * err;
+            if (err > r.error_max || std::isnan(err)) {
+                r.error_max = err;
+                r.fila_error_max = fila + i;
+            }
+            if (!(err <= op.tol_abs + op.tol_rel * std::fabs(esperado[i]))) {
+                ++r.fuera_tolerancia;
+                if (r.discrepancias.size() < op.max_discrepancias) {
+                    r.discrepancias.push_back({fila + i, lector_.tiempo(fila + i), esperado[i], actual[i]});
+                }
+            }
+        }
+        fila += n;
+    }
+
+    r.segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    r.muestras = fin - inicio;
+    r.error_rms = r.muestras ? std::sqrt(suma_cuadrados / r.muestras) : 0.0;
+    return r;
+}
+
+} // namespace DiscreteSystems
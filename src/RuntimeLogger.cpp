@@ -7,13 +7,23 @@
  */
 
 #include "../include/RuntimeLogger.h"
+#include "../include/Temporizador.h"
 #include <iostream>
+#include <algorithm>
 
 namespace DiscreteSystems {
 
+namespace {
+
+/// ns enteros → us solo para mostrarlos
+double us(std::int64_t ns) { return static_cast<double>(ns) / 1000.0; }
+
+} // namespace
+
 RuntimeLogger::RuntimeLogger(const std::string& prefix, int max_lines, 
                              const std::string& log_dir)
-    : max_lines_(max_lines), flush_interval_(100), lines_since_flush_(0)
+    : prefix_(prefix), max_lines_(max_lines), flush_interval_(100), lines_since_flush_(0),
+      columnas_timing_(false), cpu_accounting_(false), cpu_base_valida_(false), cpu_prev_{}, ru_prev_{}
 {
     // Crear directorio de logs si no existe
     mkdir(log_dir.c_str(), 0755);
@@ -105,6 +115,17 @@ std::string RuntimeLogger::generateHeader() const {
     
     header_stream << "Last Updated: " << timestamp << "\n";
     header_stream << "Buffer Size: " << log_buffer_.size() << "/" << max_lines_ << " lines\n";
+
+    // Resumen de la contabilidad de CPU del hilo
+    if (cpu_totales_.muestras > 0) {
+        const CpuTotales& c = cpu_totales_;
+        header_stream << std::fixed << std::setprecision(2)
+                      << "CPU: total " << c.cpu_ns / 1e6 << " ms, media "
+                      << c.cpu_ns / 1e3 / static_cast<double>(c.muestras) << " us, max "
+                      << c.cpu_max_ns / 1e3 << " us | nvcsw " << c.nvcsw << " | nivcsw " << c.nivcsw
+                      << " (" << c.lineas_expulsado << " líneas expulsadas) | minflt " << c.minflt
+                      << " | majflt " << c.majflt << "\n";
+    }
     header_stream << std::string(80, '=') << "\n";
     
     // Columnas
@@ -113,6 +134,10 @@ std::string RuntimeLogger::generateHeader() const {
             int width = (i < column_widths_.size()) ? column_widths_[i] : 14;
             header_stream << std::left << std::setw(width) << columns_[i];
         }
+        if (columnas_timing_ && cpu_accounting_) {
+            header_stream << std::setw(12) << "cpu_us" << std::setw(8) << "nvcsw" << std::setw(8) << "nivcsw"
+                          << std::setw(8) << "minflt" << std::setw(8) << "majflt";
+        }
         header_stream << "\n";
         header_stream << std::string(80, '-') << "\n";
     }
@@ -134,8 +159,9 @@ void RuntimeLogger::initializeHiloPID(double frequency) {
     // Configurar columnas con anchos específicos
     std::vector<std::string> cols = {"Iteration", "t_espera_us", "t_ejec_us", "t_total_us", "periodo_us", 
                                      "Ts_Real_us", "drift_us", "%error_Ts", "%uso", "Status"};
-    std::vector<int> widths = {10, 14, 14, 14, 14, 14, 14, 12, 10, 12};
+    std::vector<int> widths = {12, 14, 14, 14, 14, 14, 14, 12, 10, 24};
     setColumns(cols, widths);
+    columnas_timing_ = true;   // Las de CPU se añaden en la cabecera si está activa
 }
 
 /**
@@ -152,34 +178,74 @@ void RuntimeLogger::initializeHilo(double frequency) {
     // Configurar columnas con anchos específicos
     std::vector<std::string> cols = {"Iteration", "t_espera_us", "t_ejec_us", "t_total_us", "periodo_us", 
                                      "Ts_Real_us", "drift_us", "%error_Ts", "%uso", "Status"};
-    std::vector<int> widths = {10, 14, 14, 14, 14, 14, 14, 12, 10, 12};
+    std::vector<int> widths = {12, 14, 14, 14, 14, 14, 14, 12, 10, 24};
     setColumns(cols, widths);
+    columnas_timing_ = true;   // Las de CPU se añaden en la cabecera si está activa
 }
 
 /**
  * @brief Escribe una línea de timing con formateo automático (versión sobrecargada)
  */
-void RuntimeLogger::writeLine(int iteration, double t_espera_us, double t_ejec_us,
-                              double t_total_us, double periodo_us, double ts_real_us,
+void RuntimeLogger::writeLine(std::uint64_t iteration, std::int64_t t_espera_ns, std::int64_t t_ejec_ns,
+                              std::int64_t t_total_ns, std::int64_t periodo_ns, std::int64_t ts_real_ns,
                               const char* status) {
-    double porcentaje_uso = (t_total_us / periodo_us) * 100.0;
-    double drift_us = ts_real_us - periodo_us;
-    double error_ts = (drift_us / periodo_us) * 100.0;
+    const std::int64_t drift_ns = ts_real_ns - periodo_ns;
+    const double porcentaje_uso = 100.0 * static_cast<double>(t_total_ns) / static_cast<double>(periodo_ns);
+    const double error_ts = 100.0 * static_cast<double>(drift_ns) / static_cast<double>(periodo_ns);
     
     // Construir línea formateada con los anchos específicos de HiloPID
     std::ostringstream line;
-    line << std::left << std::setw(10) << iteration
-         << std::setw(14) << std::fixed << std::setprecision(2) << t_espera_us
-         << std::setw(14) << std::fixed << std::setprecision(2) << t_ejec_us
-         << std::setw(14) << std::fixed << std::setprecision(2) << t_total_us
-         << std::setw(14) << std::fixed << std::setprecision(2) << periodo_us
-         << std::setw(14) << std::fixed << std::setprecision(2) << ts_real_us
-         << std::setw(14) << std::fixed << std::setprecision(2) << drift_us
+    // 12 columnas: la iteración pasa de 10 dígitos tras ~115 días a 1 kHz
+    line << std::left << std::setw(12) << iteration
+         << std::setw(14) << std::fixed << std::setprecision(2) << us(t_espera_ns)
+         << std::setw(14) << std::fixed << std::setprecision(2) << us(t_ejec_ns)
+         << std::setw(14) << std::fixed << std::setprecision(2) << us(t_total_ns)
+         << std::setw(14) << std::fixed << std::setprecision(2) << us(periodo_ns)
+         << std::setw(14) << std::fixed << std::setprecision(2) << us(ts_real_ns)
+         << std::setw(14) << std::fixed << std::setprecision(2) << us(drift_ns)
          << std::setw(12) << std::fixed << std::setprecision(2) << error_ts
          << std::setw(10) << std::fixed << std::setprecision(2) << porcentaje_uso
-         << std::setw(12) << status << "\n";
+         << std::setw(24) << status;
+
+    // Contabilidad de CPU desde la línea anterior (muestreo en el propio hilo)
+    struct timespec cpu;
+    struct rusage ru;
+    bool cpu_ok = cpu_accounting_ && cpu_base_valida_ && sampleCpu(cpu, ru);
+    if (cpu_ok) {
+        std::int64_t cpu_ns = difNs(cpu, cpu_prev_);
+        long nvcsw = ru.ru_nvcsw - ru_prev_.ru_nvcsw;
+        long nivcsw = ru.ru_nivcsw - ru_prev_.ru_nivcsw;
+        long minflt = ru.ru_minflt - ru_prev_.ru_minflt;
+        long majflt = ru.ru_majflt - ru_prev_.ru_majflt;
+
+        line << std::setw(12) << std::fixed << std::setprecision(2) << us(cpu_ns)
+             << std::setw(8) << nvcsw << std::setw(8) << nivcsw
+             << std::setw(8) << minflt << std::setw(8) << majflt;
+
+        cpu_totales_.muestras++;
+        cpu_totales_.cpu_ns += cpu_ns;
+        cpu_totales_.cpu_max_ns = std::max(cpu_totales_.cpu_max_ns, cpu_ns);
+        cpu_totales_.nvcsw += static_cast<std::uint64_t>(nvcsw);
+        cpu_totales_.nivcsw += static_cast<std::uint64_t>(nivcsw);
+        cpu_totales_.minflt += static_cast<std::uint64_t>(minflt);
+        cpu_totales_.majflt += static_cast<std::uint64_t>(majflt);
+        if (nivcsw > 0) {
+            cpu_totales_.lineas_expulsado++;
+        }
+    }
+    line << "\n";
     
     writeLine(line.str());
+
+    // Referencia para la próxima línea tomada después del log (y del flush)
+    if (cpu_accounting_) {
+        cpu_base_valida_ = sampleCpu(cpu_prev_, ru_prev_);
+    }
+}
+
+bool RuntimeLogger::sampleCpu(struct timespec& cpu, struct rusage& ru) const {
+    return clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu) == 0 &&
+           getrusage(RUSAGE_THREAD, &ru) == 0;
 }
 
 } // namespace DiscreteSystems
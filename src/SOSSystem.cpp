@@ -0,0 +1,92 @@
+/**
+ * @file SOSSystem.cpp
+ * @brief Implementación de la cascada de secciones de segundo orden
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "SOSSystem.h"
+#include "Diagnostico.h"
+#include "EntornoFP.h"
+#include <stdexcept>
+#include <algorithm>
+
+namespace DiscreteSystems {
+
+/**
+ * @brief Constructor de la cascada de biquads
+ * 
+ * Copia las secciones e inicializa los dos estados de cada sección a cero.
+ */
+SOSSystem::SOSSystem(const std::vector<SecondOrderSection>& sections,
+                     double Ts,
+                     size_t bufferSize)
+    : DiscreteSystem(Ts, bufferSize), sections_(sections),
+      state_(2 * sections.size(), 0.0)
+{
+    if (sections_.empty())
+        throw std::invalid_argument("SOSSystem: se requiere al menos una sección");
+
+    DS_DIAG("Objeto de tipo SOSSystem creado correctamente (secciones = "
+            << sections_.size() << ")");
+}
+
+/**
+ * @brief Evalúa la cascada en forma directa II transpuesta
+ */
+double SOSSystem::compute(double uk)
+{
+    double x = uk;
+    double* s = state_.data();
+
+    for (const auto& sec : sections_) {
+        double y = sec.b0 * x + s[0];
+        s[0] = sec.b1 * x - sec.a1 * y + s[1];
+        s[1] = sec.b2 * x - sec.a2 * y;
+        x = y;
+        s += 2;
+    }
+
+    return x;
+}
+
+/**
+ * @brief Evalúa la cascada sobre un bloque (misma aritmética que compute())
+ */
+void SOSSystem::computeBlock(const double* u, double* y, size_t n)
+{
+    const SecondOrderSection* secs = sections_.data();
+    const size_t ns = sections_.size();
+
+    for (size_t k = 0; k < n; ++k) {
+        double x = u[k];
+        double* s = state_.data();
+        for (size_t i = 0; i < ns; ++i) {
+            const SecondOrderSection& sec = secs[i];
+            double yk = sec.b0 * x + s[0];
+            s[0] = sec.b1 * x - sec.a1 * yk + s[1];
+            s[1] = sec.b2 * x - sec.a2 * yk;
+            x = yk;
+            s += 2;
+        }
+        y[k] = x;
+    }
+}
+
+/**
+ * @brief Reinicia los estados de todas las secciones a cero
+ */
+void SOSSystem::resetState()
+{
+    std::fill(state_.begin(), state_.end(), 0.0);
+}
+
+/**
+ * @brief Estados subnormales de las secciones
+ */
+size_t SOSSystem::contarSubnormales() const
+{
+    return DiscreteSystems::contarSubnormales(state_.data(), state_.size());
+}
+
+} // namespace DiscreteSystems
@@ -0,0 +1,412 @@
+/**
+ * @file SignalGenerator.cpp
+ * @brief Implementación de las señales discretas (escalón, PWM, seno, mezcla)
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/SignalGenerator.h"
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace SignalGenerator {
+
+// ============================================================
+// Signal (base)
+// ============================================================
+
+Signal::Signal(double Ts, double offset, std::size_t buffer_size)
+    : Ts_(Ts), offset_(offset), t_(0.0), buffer_size_(buffer_size),
+      ring_head_(0), ring_count_(0), recording_(true)
+{
+    if (Ts <= 0.0) {
+        throw std::invalid_argument("Signal: Ts debe ser > 0");
+    }
+    if (buffer_size == 0) {
+        throw std::invalid_argument("Signal: buffer_size debe ser >= 1");
+    }
+    time_ring_.assign(buffer_size_, 0.0);
+    value_ring_.assign(buffer_size_, 0.0);
+}
+
+double Signal::compute() const {
+    return computeAt(t_);
+}
+
+double Signal::compute(std::size_t k) const {
+    return computeAt(static_cast<double>(k) * Ts_);
+}
+
+double Signal::next() {
+    double value = compute();
+    addToBuffer(t_, value);
+    t_ += Ts_;
+    return value;
+}
+
+void Signal::generate(double* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = next();
+    }
+}
+
+void Signal::addBlockToBuffer(double t0, const double* values, std::size_t n) {
+    if (!recording_) return;
+    std::size_t first = n > buffer_size_ ? n - buffer_size_ : 0;
+    for (std::size_t i = first; i < n; ++i) {
+        time_ring_[ring_head_] = t0 + static_cast<double>(i) * Ts_;
+        value_ring_[ring_head_] = values[i];
+        if (++ring_head_ == buffer_size_) ring_head_ = 0;
+    }
+    ring_count_ += n - first;
+    if (ring_count_ > buffer_size_) ring_count_ = buffer_size_;
+}
+
+void Signal::reset() {
+    t_ = 0.0;
+    ring_head_ = 0;
+    ring_count_ = 0;
+}
+
+double& Signal::T() { return Ts_; }
+const double& Signal::T() const { return Ts_; }
+
+double& Signal::offset() { return offset_; }
+const double& Signal::offset() const { return offset_; }
+
+double& Signal::t() { return t_; }
+const double& Signal::t() const { return t_; }
+
+const std::size_t& Signal::bufferSize() const { return buffer_size_; }
+
+void Signal::setBufferSize(std::size_t buffer_size) {
+    if (buffer_size == 0) {
+        throw std::invalid_argument("Signal: buffer_size debe ser >= 1");
+    }
+    buffer_size_ = buffer_size;
+    time_ring_.assign(buffer_size_, 0.0);
+    value_ring_.assign(buffer_size_, 0.0);
+    ring_head_ = 0;
+    ring_count_ = 0;
+}
+
+std::size_t Signal::snapshot(double* times, double* values, std::size_t max_samples) const {
+    std::size_t n = ring_count_ < max_samples ? ring_count_ : max_samples;
+    if (n == 0) return 0;
+
+    // Índice de la muestra más antigua a copiar y longitud de los dos tramos
+    std::size_t start = (ring_head_ + buffer_size_ - n) % buffer_size_;
+    std::size_t first = (start + n <= buffer_size_) ? n : buffer_size_ - start;
+    std::size_t second = n - first;
+
+    if (times) {
+        std::memcpy(times, time_ring_.data() + start, first * sizeof(double));
+        std::memcpy(times + first, time_ring_.data(), second * sizeof(double));
+    }
+    if (values) {
+        std::memcpy(values, value_ring_.data() + start, first * sizeof(double));
+        std::memcpy(values + first, value_ring_.data(), second * sizeof(double));
+    }
+    return n;
+}
+
+std::vector<double> Signal::timeBuffer() const {
+    std::vector<double> out(ring_count_);
+    snapshot(out.data(), nullptr, out.size());
+    return out;
+}
+
+std::vector<double> Signal::valueBuffer() const {
+    std::vector<double> out(ring_count_);
+    snapshot(nullptr, out.data(), out.size());
+    return out;
+}
+
+std::ostream& operator<<(std::ostream& os, const Signal& s) {
+    std::vector<double> times = s.timeBuffer();
+    std::vector<double> values = s.valueBuffer();
+    os << "time,value\n";
+    for (std::size_t i = 0; i < times.size(); ++i) {
+        os << times[i] << "," << values[i] << "\n";
+    }
+    return os;
+}
+
+// ============================================================
+// StepSignal
+// ============================================================
+
+StepSignal::StepSignal(double Ts, double amplitude, double step_time,
+                       double offset, std::size_t buffer_size)
+    : Signal(Ts, offset, buffer_size), amplitude_(amplitude), step_time_(step_time) {}
+
+double StepSignal::computeAt(double time) const {
+    return (time >= step_time_ ? amplitude_ : 0.0) + offset_;
+}
+
+void StepSignal::generate(double* __restrict out, std::size_t n) {
+    const double t0 = t_;
+    const double Ts = Ts_;
+    const double high = amplitude_ + offset_;
+    const double low = offset_;
+    const double step_time = step_time_;
+    for (std::size_t i = 0; i < n; ++i) {
+        double time = t0 + static_cast<double>(i) * Ts;
+        out[i] = time >= step_time ? high : low;
+    }
+    addBlockToBuffer(t0, out, n);
+    t_ = t0 + static_cast<double>(n) * Ts;
+}
+
+double& StepSignal::amplitude() { return amplitude_; }
+const double& StepSignal::amplitude() const { return amplitude_; }
+
+double& StepSignal::stepTime() { return step_time_; }
+const double& StepSignal::stepTime() const { return step_time_; }
+
+// ============================================================
+// PwmSignal
+// ============================================================
+
+PwmSignal::PwmSignal(double Ts, double amplitude, double duty, double period,
+                     double offset, std::size_t buffer_size)
+    : Signal(Ts, offset, buffer_size), amplitude_(amplitude), duty_(duty), period_(period)
+{
+    if (duty < 0.0 || duty > 1.0) {
+        throw std::invalid_argument("PwmSignal: duty debe estar en [0, 1]");
+    }
+    if (period <= 0.0) {
+        throw std::invalid_argument("PwmSignal: period debe ser > 0");
+    }
+}
+
+double PwmSignal::computeAt(double time) const {
+    double phase = std::fmod(time, period_);
+    if (phase < 0.0) phase += period_;
+    return (phase < duty_ * period_ ? amplitude_ : 0.0) + offset_;
+}
+
+void PwmSignal::generate(double* __restrict out, std::size_t n) {
+    const double t0 = t_;
+    const double Ts = Ts_;
+    const double period = period_;
+    const double inv_period = 1.0 / period_;
+    const double on_time = duty_ * period_;
+    const double high = amplitude_ + offset_;
+    const double low = offset_;
+    for (std::size_t i = 0; i < n; ++i) {
+        double time = t0 + static_cast<double>(i) * Ts;
+        double phase = time - period * std::floor(time * inv_period);
+        out[i] = phase < on_time ? high : low;
+    }
+    addBlockToBuffer(t0, out, n);
+    t_ = t0 + static_cast<double>(n) * Ts;
+}
+
+double& PwmSignal::amplitude() { return amplitude_; }
+const double& PwmSignal::amplitude() const { return amplitude_; }
+
+double& PwmSignal::duty() { return duty_; }
+const double& PwmSignal::duty() const { return duty_; }
+
+double& PwmSignal::period() { return period_; }
+const double& PwmSignal::period() const { return period_; }
+
+// ============================================================
+// SineSignal
+// ============================================================
+
+SineSignal::SineSignal(double Ts, double amplitude, double freq,
+                       double phase, double offset,
+                       std::size_t buffer_size, SineMode mode)
+    : Signal(Ts, offset, buffer_size), amplitude_(amplitude), freq_(freq), phase_(phase),
+      mode_(mode), cos_(1.0), sin_(0.0), rot_cos_(1.0), rot_sin_(0.0),
+      cycles_(0.0), since_anchor_(0)
+{
+    anchorOscillator();
+}
+
+double SineSignal::computeAt(double time) const {
+    return amplitude_ * std::sin(2.0 * M_PI * freq_ * time + phase_) + offset_;
+}
+
+/**
+ * @brief Ancla el oscilador en la fase exacta de t_ y recalcula la rotación.
+ */
+void SineSignal::anchorOscillator() {
+    double c = freq_ * t_;
+    cycles_ = c - std::floor(c);
+    since_anchor_ = 0;
+
+    double w = 2.0 * M_PI * freq_ * Ts_;
+    rot_cos_ = std::cos(w);
+    rot_sin_ = std::sin(w);
+
+    double theta = 2.0 * M_PI * cycles_ + phase_;
+    cos_ = std::cos(theta);
+    sin_ = std::sin(theta);
+}
+
+double SineSignal::next() {
+    if (mode_ == SineMode::Analytic) {
+        return Signal::next();
+    }
+
+    double value = oscillatorStep();
+    addToBuffer(t_, value);
+    t_ += Ts_;
+    return value;
+}
+
+/**
+ * @brief Devuelve la muestra actual del oscilador y avanza su estado (no t_).
+ */
+inline double SineSignal::oscillatorStep() {
+    double value = amplitude_ * sin_ + offset_;
+
+    if (++since_anchor_ == kOscillatorAnchor) {
+        // Re-anclaje exacto: la fase se acumula en ciclos y se reduce a [0, 1),
+        // de modo que el error no depende del tiempo total de ejecución
+        cycles_ += static_cast<double>(kOscillatorAnchor) * freq_ * Ts_;
+        cycles_ -= std::floor(cycles_);
+        since_anchor_ = 0;
+
+        double theta = 2.0 * M_PI * cycles_ + phase_;
+        cos_ = std::cos(theta);
+        sin_ = std::sin(theta);
+    } else {
+        // Rotación (cos, sin) += w
+        double c = cos_ * rot_cos_ - sin_ * rot_sin_;
+        double s = sin_ * rot_cos_ + cos_ * rot_sin_;
+        cos_ = c;
+        sin_ = s;
+    }
+
+    return value;
+}
+
+void SineSignal::generate(double* __restrict out, std::size_t n) {
+    if (mode_ == SineMode::Analytic) {
+        // Misma base de tiempo que next(): t_ += Ts muestra a muestra. Con
+        // t0 + i*Ts las muestras diferirían de next() en ~1e-9 (redondeo de t_);
+        // la suma extra no pesa frente a std::sin
+        const double Ts = Ts_;
+        const double w = 2.0 * M_PI * freq_;
+        const double phase = phase_;
+        const double amplitude = amplitude_;
+        const double offset = offset_;
+        double time = t_;
+        for (std::size_t i = 0; i < n; ++i) {
+            out[i] = amplitude * std::sin(w * time + phase) + offset;
+            addToBuffer(time, out[i]);
+            time += Ts;
+        }
+        t_ = time;
+        return;
+    }
+
+    const double t0 = t_;
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = oscillatorStep();
+    }
+    addBlockToBuffer(t0, out, n);
+    t_ = t0 + static_cast<double>(n) * Ts_;
+}
+
+void SineSignal::reset() {
+    Signal::reset();
+    anchorOscillator();
+}
+
+void SineSignal::setMode(SineMode mode) {
+    mode_ = mode;
+    anchorOscillator();
+}
+
+double& SineSignal::amplitude() { return amplitude_; }
+const double& SineSignal::amplitude() const { return amplitude_; }
+
+double& SineSignal::frequency() { return freq_; }
+const double& SineSignal::frequency() const { return freq_; }
+
+double& SineSignal::phase() { return phase_; }
+const double& SineSignal::phase() const { return phase_; }
+
+// ============================================================
+// SignalMixer
+// ============================================================
+
+SignalMixer::SignalMixer(double Ts,
+                         std::vector<std::shared_ptr<Signal>> signals,
+                         std::vector<double> weights,
+                         double offset,
+                         std::size_t buffer_size)
+    : Signal(Ts, offset, buffer_size), signals_(std::move(signals)), weights_(std::move(weights))
+{
+    for (const auto& s : signals_) {
+        if (!s) {
+            throw std::invalid_argument("SignalMixer: las señales no pueden ser nullptr");
+        }
+    }
+    if (weights_.empty()) {
+        weights_.assign(signals_.size(), 1.0);
+    }
+    if (weights_.size() != signals_.size()) {
+        throw std::invalid_argument("SignalMixer: weights debe tener el mismo tamaño que signals");
+    }
+    scratch_.assign(kMixerBlock, 0.0);
+}
+
+double SignalMixer::computeAt(double time) const {
+    double acc = offset_;
+    for (std::size_t i = 0; i < signals_.size(); ++i) {
+        // computeAt es protegido en Signal: se evalúa por índice de muestra
+        const Signal& s = *signals_[i];
+        auto k = static_cast<std::size_t>(std::llround(time / s.T()));
+        acc += weights_[i] * s.compute(k);
+    }
+    return acc;
+}
+
+std::vector<std::shared_ptr<Signal>>& SignalMixer::signals() { return signals_; }
+const std::vector<std::shared_ptr<Signal>>& SignalMixer::signals() const { return signals_; }
+
+std::vector<double>& SignalMixer::weights() { return weights_; }
+const std::vector<double>& SignalMixer::weights() const { return weights_; }
+
+double SignalMixer::next() {
+    double acc = offset_;
+    for (std::size_t i = 0; i < signals_.size(); ++i) {
+        acc += weights_[i] * signals_[i]->next();
+    }
+    addToBuffer(t_, acc);
+    t_ += Ts_;
+    return acc;
+}
+
+void SignalMixer::generate(double* out, std::size_t n) {
+    const double t0 = t_;
+    double* __restrict scratch = scratch_.data();
+
+    for (std::size_t start = 0; start < n; start += kMixerBlock) {
+        std::size_t len = (n - start < kMixerBlock) ? n - start : kMixerBlock;
+        double* __restrict block = out + start;
+
+        for (std::size_t i = 0; i < len; ++i) {
+            block[i] = offset_;
+        }
+        for (std::size_t j = 0; j < signals_.size(); ++j) {
+            signals_[j]->generate(scratch, len);
+            const double w = weights_[j];
+            for (std::size_t i = 0; i < len; ++i) {
+                block[i] += w * scratch[i];
+            }
+        }
+    }
+
+    addBlockToBuffer(t0, out, n);
+    t_ = t0 + static_cast<double>(n) * Ts_;
+}
+
+} // namespace SignalGenerator
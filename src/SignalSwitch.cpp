@@ -6,8 +6,8 @@
  */
 
 #include "../include/SignalSwitch.h"
+#include "../include/Diagnostico.h"
 #include <stdexcept>
-#include <iostream>
 
 namespace SignalGenerator {
 
@@ -30,7 +30,7 @@ SignalSwitch::SignalSwitch(std::shared_ptr<StepSignal> stepSignal,
         throw std::invalid_argument("SignalSwitch: El selector debe estar en rango [0,2]");
     }
 
-    std::cout << "SignalSwitch creado con selector=" << selector_ << std::endl;
+    DS_DIAG("SignalSwitch creado con selector=" << selector_);
 }
 
 void SignalSwitch::setSelector(int selector) {
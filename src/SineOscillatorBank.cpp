@@ -0,0 +1,108 @@
+/**
+ * @file SineOscillatorBank.cpp
+ * @brief Implementación del banco de osciladores senoidales recursivos
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/SineOscillatorBank.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace SignalGenerator {
+
+SineOscillatorBank::SineOscillatorBank(double Ts)
+    : Ts_(Ts), k_(0), since_anchor_(0)
+{
+    if (Ts <= 0.0) {
+        throw std::invalid_argument("SineOscillatorBank: Ts debe ser > 0");
+    }
+}
+
+std::size_t SineOscillatorBank::addChannel(double amplitude, double freq,
+                                           double phase, double offset) {
+    amp_.push_back(amplitude);
+    offset_.push_back(offset);
+    freq_.push_back(freq);
+    phase_.push_back(phase);
+
+    double w = 2.0 * M_PI * freq * Ts_;
+    rot_cos_.push_back(std::cos(w));
+    rot_sin_.push_back(std::sin(w));
+
+    // Fase exacta en la muestra actual del banco
+    double c = freq * Ts_ * static_cast<double>(k_);
+    cycles_.push_back(c - std::floor(c));
+    double theta = 2.0 * M_PI * cycles_.back() + phase;
+    cos_.push_back(std::cos(theta));
+    sin_.push_back(std::sin(theta));
+
+    // El nuevo canal debe re-anclarse en la misma frontera que el resto:
+    // se retrocede su fase de anclaje las muestras ya avanzadas
+    double back = freq * Ts_ * static_cast<double>(since_anchor_);
+    cycles_.back() -= back;
+    cycles_.back() -= std::floor(cycles_.back());
+
+    return amp_.size() - 1;
+}
+
+/**
+ * @brief Re-ancla todos los canales con su fase exacta
+ */
+void SineOscillatorBank::anchor() {
+    const std::size_t n = amp_.size();
+    for (std::size_t c = 0; c < n; ++c) {
+        cycles_[c] += static_cast<double>(kAnchor) * freq_[c] * Ts_;
+        cycles_[c] -= std::floor(cycles_[c]);
+        double theta = 2.0 * M_PI * cycles_[c] + phase_[c];
+        cos_[c] = std::cos(theta);
+        sin_[c] = std::sin(theta);
+    }
+    since_anchor_ = 0;
+}
+
+void SineOscillatorBank::step(double* out) {
+    const std::size_t n = amp_.size();
+    double* __restrict c = cos_.data();
+    double* __restrict s = sin_.data();
+    const double* __restrict rc = rot_cos_.data();
+    const double* __restrict rs = rot_sin_.data();
+    const double* __restrict a = amp_.data();
+    const double* __restrict o = offset_.data();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = a[i] * s[i] + o[i];
+    }
+
+    ++k_;
+    if (++since_anchor_ == kAnchor) {
+        anchor();
+        return;
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        double ci = c[i] * rc[i] - s[i] * rs[i];
+        double si = s[i] * rc[i] + c[i] * rs[i];
+        c[i] = ci;
+        s[i] = si;
+    }
+}
+
+void SineOscillatorBank::generate(double* out, std::size_t n) {
+    const std::size_t ch = amp_.size();
+    for (std::size_t k = 0; k < n; ++k) {
+        step(out + k * ch);
+    }
+}
+
+void SineOscillatorBank::reset() {
+    k_ = 0;
+    since_anchor_ = 0;
+    for (std::size_t c = 0; c < amp_.size(); ++c) {
+        cycles_[c] = 0.0;
+        cos_[c] = std::cos(phase_[c]);
+        sin_[c] = std::sin(phase_[c]);
+    }
+}
+
+} // namespace SignalGenerator
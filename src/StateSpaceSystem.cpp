@@ -6,6 +6,8 @@
  */
 
 #include "StateSpaceSystem.h"
+#include "Diagnostico.h"
+#include "EntornoFP.h"
 #include <stdexcept>
 #include <iomanip>
 
@@ -55,8 +57,9 @@ StateSpaceSystem::StateSpaceSystem(
 
     // Inicializamos el estado x(k)
     x_.assign(n_, 0.0);
+    xNext_.assign(n_, 0.0);
 
-    std::cout << "StateSpaceSystem creado correctamente (n = " << n_ << ")" << std::endl;
+    DS_DIAG("StateSpaceSystem creado correctamente (n = " << n_ << ")");
 }
 
 
@@ -94,6 +97,40 @@ double StateSpaceSystem::compute(double uk)
 }
 
 
+/**
+ * @brief Simula un bloque con la misma aritmética que compute()
+ *
+ * x(k+1) se calcula en xNext_ y se intercambia con x_, sin reservar
+ * memoria por muestra. Los resultados coinciden bit a bit con compute().
+ */
+void StateSpaceSystem::computeBlock(const double* u, double* y, size_t n)
+{
+    const double* B = B_.data();
+    const double* C = C_.data();
+
+    for (size_t k = 0; k < n; ++k) {
+        const double uk = u[k];
+        const double* x = x_.data();
+        double* xn = xNext_.data();
+
+        double yk = 0.0;
+        for (size_t i = 0; i < n_; i++)
+            yk += C[i] * x[i];
+        yk += D_ * uk;
+
+        for (size_t i = 0; i < n_; i++) {
+            const double* Ai = A_[i].data();
+            double acc = 0.0;
+            for (size_t j = 0; j < n_; j++)
+                acc += Ai[j] * x[j];
+            xn[i] = acc + B[i] * uk;
+        }
+
+        x_.swap(xNext_);
+        y[k] = yk;
+    }
+}
+
 /**
  * @brief Reinicia el estado interno del sistema
  * 
@@ -143,4 +180,12 @@ std::ostream& operator<<(std::ostream& os, const StateSpaceSystem& sys)
     return os;
 }
 
+/**
+ * @brief Componentes subnormales del vector de estado
+ */
+size_t StateSpaceSystem::contarSubnormales() const
+{
+    return DiscreteSystems::contarSubnormales(x_.data(), x_.size());
+}
+
 } // namespace DiscreteSystems
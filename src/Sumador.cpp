@@ -39,6 +39,16 @@ double Sumador::compute(double) {
         "Sumador necesita 2 entradas: use compute(ref, y)");
 }
 
+/**
+ * @brief Calcula e(k) = ref(k) − y(k) para un bloque completo
+ */
+void Sumador::computeBlock(const double* ref, const double* y, double* e, size_t n) {
+    for (size_t i = 0; i < n; ++i)
+        e[i] = ref[i] - y[i];
+    if (n > 0)
+        e_out_ = e[n - 1];
+}
+
 /**
  * @brief Reinicia el estado interno del sumador
  * 
@@ -0,0 +1,203 @@
+/**
+ * @file TableSignal.cpp
+ * @brief Implementación de la reproducción de tablas de referencia
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/TableSignal.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace SignalGenerator {
+
+namespace {
+constexpr char kTableMagic[8] = {'D', 'S', 'T', 'A', 'B', 'L', 'E', '1'};
+}
+
+TableSignal::TableSignal(double Ts, const std::string& path,
+                         TableInterp interp, TableEnd end,
+                         double offset, std::size_t buffer_size)
+    : Signal(Ts, offset, buffer_size), data_(nullptr), count_(0),
+      Ts_table_(0.0), inv_Ts_table_(0.0), interp_(interp), end_(end),
+      map_(nullptr), map_size_(0)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("TableSignal: no se puede abrir " + path +
+                                 ": " + std::strerror(errno));
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(TableFileHeader))) {
+        ::close(fd);
+        throw std::runtime_error("TableSignal: fichero demasiado corto: " + path);
+    }
+
+    map_size_ = static_cast<std::size_t>(st.st_size);
+    map_ = ::mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);   // El mapa mantiene su propia referencia al fichero
+    if (map_ == MAP_FAILED) {
+        map_ = nullptr;
+        throw std::runtime_error("TableSignal: mmap falló para " + path +
+                                 ": " + std::strerror(errno));
+    }
+
+    const auto* header = static_cast<const TableFileHeader*>(map_);
+    std::size_t available = (map_size_ - sizeof(TableFileHeader)) / sizeof(double);
+    if (std::memcmp(header->magic, kTableMagic, sizeof(kTableMagic)) != 0 ||
+        header->count == 0 || header->count > available || !(header->Ts_table > 0.0)) {
+        ::munmap(map_, map_size_);
+        map_ = nullptr;
+        throw std::runtime_error("TableSignal: cabecera inválida en " + path);
+    }
+
+    data_ = reinterpret_cast<const double*>(static_cast<const char*>(map_) + sizeof(TableFileHeader));
+    count_ = static_cast<std::size_t>(header->count);
+    Ts_table_ = header->Ts_table;
+    inv_Ts_table_ = 1.0 / Ts_table_;
+
+    // Lectura anticipada y liberación de páginas ya reproducidas
+    ::madvise(map_, map_size_, MADV_SEQUENTIAL);
+}
+
+TableSignal::TableSignal(double Ts, const double* data, std::size_t count, double Ts_table,
+                         TableInterp interp, TableEnd end,
+                         double offset, std::size_t buffer_size)
+    : Signal(Ts, offset, buffer_size), data_(data), count_(count),
+      Ts_table_(Ts_table), inv_Ts_table_(0.0), interp_(interp), end_(end),
+      map_(nullptr), map_size_(0)
+{
+    if (data == nullptr || count == 0) {
+        throw std::invalid_argument("TableSignal: la tabla no puede estar vacía");
+    }
+    if (Ts_table <= 0.0) {
+        throw std::invalid_argument("TableSignal: Ts_table debe ser > 0");
+    }
+    inv_Ts_table_ = 1.0 / Ts_table_;
+}
+
+TableSignal::~TableSignal() {
+    if (map_) {
+        ::munmap(map_, map_size_);
+    }
+}
+
+void TableSignal::writeFile(const std::string& path, double Ts_table,
+                            const double* data, std::size_t count) {
+    if (data == nullptr || count == 0 || Ts_table <= 0.0) {
+        throw std::invalid_argument("TableSignal::writeFile: tabla vacía o Ts_table <= 0");
+    }
+    TableFileHeader header{};
+    std::memcpy(header.magic, kTableMagic, sizeof(kTableMagic));
+    header.count = count;
+    header.Ts_table = Ts_table;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(data),
+               static_cast<std::streamsize>(count * sizeof(double)));
+    if (!file) {
+        throw std::runtime_error("TableSignal::writeFile: no se puede escribir " + path);
+    }
+}
+
+/**
+ * @brief Muestra i de la tabla aplicando el modo de final (Hold/Loop).
+ */
+inline double TableSignal::at(std::ptrdiff_t i) const {
+    const auto n = static_cast<std::ptrdiff_t>(count_);
+    if (end_ == TableEnd::Loop) {
+        i %= n;
+        if (i < 0) i += n;
+    } else if (i < 0) {
+        i = 0;
+    } else if (i >= n) {
+        i = n - 1;
+    }
+    return data_[i];
+}
+
+/**
+ * @brief Valor interpolado en una posición fraccionaria de la tabla (en muestras).
+ */
+inline double TableSignal::sampleAt(double position) const {
+    const double n = static_cast<double>(count_);
+    if (end_ == TableEnd::Loop) {
+        position -= n * std::floor(position / n);
+    } else if (position <= 0.0) {
+        return data_[0];
+    } else if (position >= n - 1.0) {
+        return data_[count_ - 1];
+    }
+
+    double base = std::floor(position);
+    double frac = position - base;
+    auto i = static_cast<std::ptrdiff_t>(base);
+
+    if (interp_ == TableInterp::Linear) {
+        double y0 = at(i);
+        double y1 = at(i + 1);
+        return y0 + frac * (y1 - y0);
+    }
+
+    // Catmull-Rom: pasa por y1 (frac = 0) e y2 (frac = 1)
+    double y0 = at(i - 1);
+    double y1 = at(i);
+    double y2 = at(i + 1);
+    double y3 = at(i + 2);
+    double c1 = 0.5 * (y2 - y0);
+    double c2 = y0 - 2.5 * y1 + 2.0 * y2 - 0.5 * y3;
+    double c3 = 0.5 * (y3 - y0) + 1.5 * (y1 - y2);
+    return ((c3 * frac + c2) * frac + c1) * frac + y1;
+}
+
+double TableSignal::computeAt(double time) const {
+    return sampleAt(time * inv_Ts_table_) + offset_;
+}
+
+void TableSignal::generate(double* __restrict out, std::size_t n) {
+    const double t0 = t_;
+    for (std::size_t i = 0; i < n; ++i) {
+        double time = t0 + static_cast<double>(i) * Ts_;
+        out[i] = sampleAt(time * inv_Ts_table_) + offset_;
+    }
+    addBlockToBuffer(t0, out, n);
+    t_ = t0 + static_cast<double>(n) * Ts_;
+}
+
+void TableSignal::prefetch(double seconds) const {
+    if (!map_ || seconds <= 0.0) return;
+
+    const double n = static_cast<double>(count_);
+    double first = t_ * inv_Ts_table_;
+    if (end_ == TableEnd::Loop) {
+        first -= n * std::floor(first / n);
+    }
+    double last = first + seconds * inv_Ts_table_ + 2.0;
+    first = std::max(0.0, std::min(first - 1.0, n));
+    if (end_ == TableEnd::Loop && last > n) {
+        // El tramo da la vuelta: se precarga la tabla completa
+        ::madvise(map_, map_size_, MADV_WILLNEED);
+        return;
+    }
+    last = std::min(last, n);
+
+    const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    std::size_t begin = sizeof(TableFileHeader) + static_cast<std::size_t>(first) * sizeof(double);
+    std::size_t stop = sizeof(TableFileHeader) + static_cast<std::size_t>(std::ceil(last)) * sizeof(double);
+    begin -= begin % page;
+    if (stop > map_size_) stop = map_size_;
+    if (stop > begin) {
+        ::madvise(static_cast<char*>(map_) + begin, stop - begin, MADV_WILLNEED);
+    }
+}
+
+} // namespace SignalGenerator
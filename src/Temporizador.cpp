@@ -6,13 +6,16 @@
  */
 
 #include "../include/Temporizador.h"
+#include "../include/TokenParada.h"
+
+#include <cerrno>
 
 namespace DiscreteSystems {
 
 /**
  * @brief Constructor principal desde frecuencia en Hz
  */
-Temporizador::Temporizador(double frequency) {
+Temporizador::Temporizador(double frequency) : parada_(nullptr) {
     // Calcular período en nanosegundos
     period_ns_ = static_cast<long>((1.0 / frequency) * 1e9);
     
@@ -20,6 +23,12 @@ Temporizador::Temporizador(double frequency) {
     clock_gettime(CLOCK_MONOTONIC, &next_);
 }
 
+/**
+ * @brief Constructor con instante de partida absoluto
+ */
+Temporizador::Temporizador(double frequency, const struct timespec& inicio)
+    : next_(inicio), period_ns_(static_cast<long>((1.0 / frequency) * 1e9)), parada_(nullptr) {}
+
 /**
  * @brief Constructor estático desde período en segundos
  */
@@ -41,6 +50,16 @@ int Temporizador::esperar() {
     }
     
     // Dormir hasta el instante absoluto calculado
+    return esperarObjetivo();
+}
+
+/**
+ * @brief Espera hasta el instante objetivo actual
+ */
+int Temporizador::esperarObjetivo() {
+    if (parada_) {
+        return parada_->esperarHasta(next_) ? ECANCELED : 0;
+    }
     return clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_, NULL);
 }
 
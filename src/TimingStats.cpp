@@ -0,0 +1,150 @@
+/**
+ * @file TimingStats.cpp
+ * @brief Implementación de las estadísticas e histograma de tiempos
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/TimingStats.h"
+#include "../include/Temporizador.h"
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+namespace DiscreteSystems {
+
+TimingStats::TimingStats() {
+    reset();
+}
+
+void TimingStats::reset() {
+    count_.store(0, std::memory_order_relaxed);
+    min_.store(std::numeric_limits<std::int64_t>::max(), std::memory_order_relaxed);
+    max_.store(std::numeric_limits<std::int64_t>::min(), std::memory_order_relaxed);
+    sum_.store(0.0, std::memory_order_relaxed);
+    sumsq_.store(0.0, std::memory_order_relaxed);
+    for (auto& b : bins_) {
+        b.store(0, std::memory_order_relaxed);
+    }
+}
+
+int TimingStats::binIndex(std::uint64_t v) {
+    if (v < static_cast<std::uint64_t>(kSub)) {
+        return static_cast<int>(v);
+    }
+    int msb = 63 - __builtin_clzll(v);
+    if (msb > kMaxBit) {
+        return kBins - 1;
+    }
+    int shift = msb - kSubBits;
+    int sub = static_cast<int>((v >> shift) & (kSub - 1));
+    return kSub + shift * kSub + sub;
+}
+
+std::uint64_t TimingStats::binLower(int i) {
+    if (i < kSub) {
+        return static_cast<std::uint64_t>(i);
+    }
+    int shift = (i - kSub) / kSub;
+    int sub = (i - kSub) % kSub;
+    return static_cast<std::uint64_t>(kSub + sub) << shift;
+}
+
+void TimingStats::record(std::int64_t ns) {
+    // Un único escritor: load + store relajados (sin RMW atómico)
+    count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (ns < min_.load(std::memory_order_relaxed)) min_.store(ns, std::memory_order_relaxed);
+    if (ns > max_.load(std::memory_order_relaxed)) max_.store(ns, std::memory_order_relaxed);
+
+    double v = static_cast<double>(ns);
+    sum_.store(sum_.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+    sumsq_.store(sumsq_.load(std::memory_order_relaxed) + v * v, std::memory_order_relaxed);
+
+    std::uint64_t mag = ns < 0 ? static_cast<std::uint64_t>(-ns) : static_cast<std::uint64_t>(ns);
+    auto& bin = bins_[binIndex(mag)];
+    bin.store(bin.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+std::int64_t TimingStats::min() const {
+    return count() ? min_.load(std::memory_order_relaxed) : 0;
+}
+
+std::int64_t TimingStats::max() const {
+    return count() ? max_.load(std::memory_order_relaxed) : 0;
+}
+
+double TimingStats::mean() const {
+    std::uint64_t n = count();
+    return n ? sum_.load(std::memory_order_relaxed) / static_cast<double>(n) : 0.0;
+}
+
+double TimingStats::stddev() const {
+    std::uint64_t n = count();
+    if (n == 0) return 0.0;
+    double m = mean();
+    double var = sumsq_.load(std::memory_order_relaxed) / static_cast<double>(n) - m * m;
+    return var > 0.0 ? std::sqrt(var) : 0.0;
+}
+
+double TimingStats::percentile(double p) const {
+    std::uint64_t total = 0;
+    for (const auto& b : bins_) total += b.load(std::memory_order_relaxed);
+    if (total == 0) return 0.0;
+
+    auto target = static_cast<std::uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total)));
+    if (target == 0) target = 1;
+
+    std::uint64_t acc = 0;
+    for (int i = 0; i < kBins; ++i) {
+        acc += bins_[i].load(std::memory_order_relaxed);
+        if (acc >= target) {
+            double lo = static_cast<double>(binLower(i));
+            double hi = (i + 1 < kBins) ? static_cast<double>(binLower(i + 1)) : lo;
+            return 0.5 * (lo + hi);
+        }
+    }
+    return static_cast<double>(binLower(kBins - 1));
+}
+
+std::string TimingStats::toJson() const {
+    std::ostringstream os;
+    os << "{\"count\": " << count() << ", \"min\": " << min() << ", \"max\": " << max()
+       << ", \"mean\": " << mean() << ", \"stddev\": " << stddev()
+       << ", \"p50\": " << percentile(50) << ", \"p90\": " << percentile(90)
+       << ", \"p99\": " << percentile(99) << ", \"p999\": " << percentile(99.9) << "}";
+    return os.str();
+}
+
+void HiloTiming::record(const struct timespec& objetivo, const struct timespec& t0,
+                        std::int64_t ts_real_ns, std::int64_t periodo_ns, std::int64_t t_total_ns, bool primera) {
+    wake_latency.record(difNs(t0, objetivo));
+    if (!primera) {
+        drift.record(ts_real_ns - periodo_ns);
+    }
+    total.record(t_total_ns);
+}
+
+void HiloTiming::recordEdad(std::int64_t t_escritura_ns, std::int64_t t_origen_ns, std::int64_t ahora_ns) {
+    input_age.record(ahora_ns - t_escritura_ns);
+    source_age.record(ahora_ns - t_origen_ns);
+}
+
+void HiloTiming::reset() {
+    wake_latency.reset();
+    drift.reset();
+    total.reset();
+    input_age.reset();
+    source_age.reset();
+}
+
+std::string HiloTiming::toJson() const {
+    std::ostringstream os;
+    os << "{\"wake_latency_ns\": " << wake_latency.toJson()
+       << ", \"drift_ns\": " << drift.toJson()
+       << ", \"t_total_ns\": " << total.toJson()
+       << ", \"input_age_ns\": " << input_age.toJson()
+       << ", \"source_age_ns\": " << source_age.toJson() << "}";
+    return os.str();
+}
+
+} // namespace DiscreteSystems
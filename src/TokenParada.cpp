@@ -0,0 +1,68 @@
+/**
+ * @file TokenParada.cpp
+ * @brief Implementación del token de parada sobre futex
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/TokenParada.h"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <climits>
+#include <ctime>
+
+namespace DiscreteSystems {
+
+namespace {
+
+long futex(const std::atomic<std::uint32_t>* palabra, int op, std::uint32_t valor,
+           const struct timespec* t, std::uint32_t bitset) {
+    return syscall(SYS_futex, reinterpret_cast<const std::uint32_t*>(palabra), op, valor, t,
+                   nullptr, bitset);
+}
+
+} // namespace
+
+void TokenParada::detener() {
+    estado_.store(1, std::memory_order_release);
+    futex(&estado_, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, 0);
+}
+
+bool TokenParada::esperarHasta(const struct timespec& t) const {
+    // FUTEX_WAIT_BITSET interpreta el timeout como absoluto en CLOCK_MONOTONIC.
+    // EAGAIN (ya detenido), EINTR y despertares espurios vuelven a comprobar.
+    // Cualquier otro error (ENOSYS, EFAULT...) no se reintenta: se duerme hasta
+    // t con clock_nanosleep para no girar y el periodo sigue cumpliéndose.
+    while (!detenido()) {
+        long r = futex(&estado_, FUTEX_WAIT_BITSET_PRIVATE, 0, &t, FUTEX_BITSET_MATCH_ANY);
+        if (r == -1 && errno != EINTR && errno != EAGAIN) {
+            if (errno != ETIMEDOUT) {
+                while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, nullptr) == EINTR) {
+                }
+            }
+            return detenido();
+        }
+    }
+    return true;
+}
+
+void TokenParada::esperar() const {
+    const struct timespec sondeo = {0, 1000000};   // 1 ms si futex no está disponible
+    while (!detenido()) {
+        long r = futex(&estado_, FUTEX_WAIT_PRIVATE, 0, nullptr, 0);
+        if (r == -1 && errno != EINTR && errno != EAGAIN) {
+            nanosleep(&sondeo, nullptr);
+        }
+    }
+}
+
+TokenParada& TokenParada::proceso() {
+    static TokenParada token;
+    return token;
+}
+
+} // namespace DiscreteSystems
@@ -0,0 +1,176 @@
+/**
+ * @file Tracer.cpp
+ * @brief Implementación del trazador de eventos por hilo (Chrome Trace JSON)
+ * @author Jordi + GitHub Copilot
+ * @date 2026-10-16
+ */
+
+#include "../include/Tracer.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace DiscreteSystems {
+
+namespace {
+
+/**
+ * @brief Buffer de un hilo: un escritor (el hilo), lectores concurrentes
+ *        a través de count (release/acquire)
+ */
+struct BufferHilo {
+    explicit BufferHilo(std::size_t capacidad)
+        : eventos(new TraceEvent[capacidad]), capacidad(capacidad), count(0), descartados(0),
+          tid(static_cast<int>(syscall(SYS_gettid))) {}
+
+    std::unique_ptr<TraceEvent[]> eventos;
+    std::size_t capacidad;
+    std::atomic<std::size_t> count;
+    std::atomic<std::uint64_t> descartados;
+    int tid;
+    std::string nombre;   ///< Protegido por el mutex del registro
+};
+
+struct Registro {
+    std::mutex mtx;
+    std::vector<std::unique_ptr<BufferHilo>> buffers;   // Nunca se liberan: se exportan tras el join
+    std::size_t capacidad = 65536;
+};
+
+Registro& registro() {
+    static Registro r;
+    return r;
+}
+
+thread_local BufferHilo* tls_buffer = nullptr;
+thread_local std::string tls_nombre;
+
+BufferHilo* bufferLocal() {
+    if (!tls_buffer) {
+        Registro& r = registro();
+        std::lock_guard<std::mutex> lock(r.mtx);
+        r.buffers.push_back(std::make_unique<BufferHilo>(r.capacidad));
+        tls_buffer = r.buffers.back().get();
+        tls_buffer->nombre = tls_nombre;
+    }
+    return tls_buffer;
+}
+
+void escribirCadenaJson(std::ostream& os, const std::string& s) {
+    os << '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\') os << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20) os << ' ';
+        else os << c;
+    }
+    os << '"';
+}
+
+} // namespace
+
+void Tracer::setCapacidad(std::size_t eventos_por_hilo) {
+    Registro& r = registro();
+    std::lock_guard<std::mutex> lock(r.mtx);
+    r.capacidad = eventos_por_hilo > 0 ? eventos_por_hilo : 1;
+}
+
+void Tracer::nombrarHilo(const std::string& nombre) {
+    tls_nombre = nombre;
+    if (tls_buffer) {
+        std::lock_guard<std::mutex> lock(registro().mtx);
+        tls_buffer->nombre = nombre;
+    }
+}
+
+void Tracer::push(const char* name, std::int64_t ts_ns, std::int64_t dur_ns) {
+    BufferHilo* b = bufferLocal();
+    std::size_t n = b->count.load(std::memory_order_relaxed);
+    if (n >= b->capacidad) {
+        b->descartados.store(b->descartados.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return;
+    }
+    b->eventos[n] = TraceEvent{name, ts_ns, dur_ns};
+    b->count.store(n + 1, std::memory_order_release);
+}
+
+void Tracer::completo(const char* name, std::int64_t ini_ns, std::int64_t fin_ns) {
+    push(name, ini_ns, fin_ns >= ini_ns ? fin_ns - ini_ns : 0);
+}
+
+void Tracer::instantaneo(const char* name) {
+    push(name, ahoraNs(), -1);
+}
+
+bool Tracer::exportarJson(const std::string& path) {
+    std::ofstream os(path);
+    if (!os.is_open()) {
+        return false;
+    }
+
+    Registro& r = registro();
+    std::lock_guard<std::mutex> lock(r.mtx);
+    const int pid = static_cast<int>(getpid());
+
+    os << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n";
+    bool primero = true;
+    auto separador = [&]() {
+        if (!primero) os << ",\n";
+        primero = false;
+    };
+
+    os << std::fixed << std::setprecision(3);
+    for (const auto& b : r.buffers) {
+        if (!b->nombre.empty()) {
+            separador();
+            os << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << pid
+               << ", \"tid\": " << b->tid << ", \"args\": {\"name\": ";
+            escribirCadenaJson(os, b->nombre);
+            os << "}}";
+        }
+
+        std::size_t n = b->count.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < n; ++i) {
+            const TraceEvent& ev = b->eventos[i];
+            separador();
+            // Chrome Trace usa microsegundos
+            os << "{\"name\": ";
+            escribirCadenaJson(os, ev.name);
+            os << ", \"pid\": " << pid << ", \"tid\": " << b->tid
+               << ", \"ts\": " << static_cast<double>(ev.ts_ns) / 1000.0;
+            if (ev.dur_ns >= 0) {
+                os << ", \"ph\": \"X\", \"dur\": " << static_cast<double>(ev.dur_ns) / 1000.0 << "}";
+            } else {
+                os << ", \"ph\": \"i\", \"s\": \"t\"}";
+            }
+        }
+    }
+    os << "\n]}\n";
+    return static_cast<bool>(os);
+}
+
+void Tracer::limpiar() {
+    Registro& r = registro();
+    std::lock_guard<std::mutex> lock(r.mtx);
+    for (auto& b : r.buffers) {
+        b->count.store(0, std::memory_order_relaxed);
+        b->descartados.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t Tracer::eventosDescartados() {
+    Registro& r = registro();
+    std::lock_guard<std::mutex> lock(r.mtx);
+    std::uint64_t total = 0;
+    for (const auto& b : r.buffers) {
+        total += b->descartados.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+} // namespace DiscreteSystems
@@ -7,6 +7,9 @@
  */
 
 #include "TransferFunctionSystem.h"
+#include "Diagnostico.h"
+#include <algorithm>
+#include "EntornoFP.h"
 
 namespace DiscreteSystems {
 
@@ -31,7 +34,7 @@ TransferFunctionSystem::TransferFunctionSystem(const std::vector<double>& b,
     uHist_ = std::vector<double>(b_.size(), 0.0);       // tamaño m+1
     yHist_ = std::vector<double>(a_.size() - 1, 0.0);   // tamaño n
 
-    std::cout << "Objeto de tipo TransferFunctionSystem creado correctamente" << std::endl;
+    DS_DIAG("Objeto de tipo TransferFunctionSystem creado correctamente");
 }
 
 /**
@@ -71,6 +74,42 @@ double TransferFunctionSystem::compute(double uk){
     return yk;
 }
 
+/**
+ * @brief Procesa un bloque con la misma aritmética que compute()
+ *
+ * Los resultados coinciden bit a bit con n llamadas a compute(); solo se
+ * eliminan la llamada virtual por muestra y las recargas de size()/data().
+ */
+void TransferFunctionSystem::computeBlock(const double* u, double* y, size_t n){
+
+    const size_t nb = b_.size();
+    const size_t na = a_.size();
+    const double* b = b_.data();
+    const double* a = a_.data();
+    double* uh = uHist_.data();
+    double* yh = yHist_.data();
+
+    for (size_t k = 0; k < n; ++k) {
+        for (size_t i = nb - 1; i > 0; --i)
+            uh[i] = uh[i - 1];
+        uh[0] = u[k];
+
+        double yk = 0.0;
+        for (size_t i = 0; i < nb; ++i)
+            yk += b[i] * uh[i];
+        for (size_t i = 1; i < na; ++i)
+            yk -= a[i] * yh[i - 1];
+        yk /= a[0];
+
+        for (size_t i = na - 1; i > 1; --i)
+            yh[i - 1] = yh[i - 2];
+        if (na > 1)
+            yh[0] = yk;
+
+        y[k] = yk;
+    }
+}
+
 /**
  * @brief Reinicia el estado interno del sistema
  * 
@@ -78,7 +117,17 @@ double TransferFunctionSystem::compute(double uk){
  * para una nueva simulación desde condiciones iniciales.
  */
 void TransferFunctionSystem::resetState(){
-    std::cout << "ResetState ejecutado" << std::endl;
+    std::fill(uHist_.begin(), uHist_.end(), 0.0);
+    std::fill(yHist_.begin(), yHist_.end(), 0.0);
+    DS_DIAG("ResetState ejecutado");
+}
+
+/**
+ * @brief Estados subnormales en los historiales de entrada y salida
+ */
+size_t TransferFunctionSystem::contarSubnormales() const {
+    return DiscreteSystems::contarSubnormales(uHist_.data(), uHist_.size()) +
+           DiscreteSystems::contarSubnormales(yHist_.data(), yHist_.size());
 }
 
 } // namespace DiscreteSystems
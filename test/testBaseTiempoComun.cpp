@@ -0,0 +1,130 @@
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "BaseTiempoComun.h"
+#include "DAConverter.h"
+#include "HiloPeriodico.h"
+#include "TokenParada.h"
+
+using namespace DiscreteSystems;
+
+namespace {
+
+/// IOAtomico que anota la iteración en que la entrada deja de ser 0
+struct IOEtapa {
+    const std::atomic<double>* entrada;
+    std::atomic<double>* salida;
+    const std::atomic<bool>* running;
+    std::atomic<std::uint64_t>* primera;
+    std::uint64_t n = 0;
+
+    bool leer(double& u) {
+        ++n;
+        u = entrada->load(std::memory_order_acquire);
+        if (u != 0.0 && primera->load(std::memory_order_relaxed) == 0) {
+            primera->store(n, std::memory_order_relaxed);
+        }
+        return running->load(std::memory_order_relaxed);
+    }
+
+    void escribir(double y) { salida->store(y, std::memory_order_release); }
+};
+
+} // namespace
+
+int main() {
+    std::cout << "TEST BASE DE TIEMPO COMÚN (barrera de arranque y desfases)" << std::endl;
+    bool ok = true;
+
+    // Barrera: todos los participantes obtienen el mismo t0, posterior a la liberación
+    {
+        BaseTiempoComun base(3);
+        std::vector<struct timespec> t0(3);
+        std::vector<std::thread> hilos;
+        for (int i = 0; i < 3; ++i) {
+            hilos.emplace_back([&, i] { t0[i] = base.esperarInicio(); });
+            usleep(2000);
+            ok = ok && (base.iniciada() == (i == 2));
+        }
+        for (auto& h : hilos) h.join();
+        for (int i = 1; i < 3; ++i) {
+            ok = ok && t0[i].tv_sec == t0[0].tv_sec && t0[i].tv_nsec == t0[0].tv_nsec;
+        }
+        std::cout << "Barrera de 3: t0 común " << (ok ? "sí" : "no") << std::endl;
+
+        BaseTiempoComun incompleta(5);
+        std::thread solo([&] { incompleta.esperarInicio(); });
+        usleep(2000);
+        incompleta.arrancar();
+        solo.join();
+        ok = ok && incompleta.iniciada();
+    }
+
+    // Barrera incompleta: detener el token libera a quien espera en ella, de
+    // modo que el destructor de un hilo no se bloquea si el resto no llega
+    {
+        TokenParada token;
+        std::atomic<double> x{1.0}, y{0.0};
+        std::atomic<bool> run{true};   // Sigue a true: el hilo sale por el token
+        std::atomic<std::uint64_t> p{0};
+        BaseTiempoComun base(2);
+        ConfigHilo cc;
+        cc.base_tiempo = &base;
+        cc.parada = &token;
+        bool atrapado;
+        {
+            HiloPeriodico<DAConverter, IOEtapa> h(std::make_shared<DAConverter>(0.01),
+                                                  IOEtapa{&x, &y, &run, &p}, 100.0, cc);
+            usleep(20000);
+            atrapado = !base.iniciada() && p == 0;
+            token.detener();   // Como tras un constructor posterior que lanza
+        }
+        std::cout << "Barrera incompleta liberada por el token: " << (atrapado ? "sí" : "no") << std::endl;
+        ok = ok && atrapado && !base.iniciada() && p == 0;
+    }
+
+    // Cadena de 3 etapas a 100 Hz con desfases en el orden del flujo: un
+    // escalón en la entrada atraviesa las tres en la misma iteración
+    {
+        const double f = 100.0;
+        std::atomic<double> x{0.0}, a{0.0}, b{0.0}, c{0.0};
+        std::atomic<bool> run{true};
+        std::atomic<std::uint64_t> p1{0}, p2{0}, p3{0};
+        BaseTiempoComun base(3);
+        auto cfg = [&](double fraccion) {
+            ConfigHilo cc;
+            cc.base_tiempo = &base;
+            cc.fase_s = fraccion / f;
+            return cc;
+        };
+        {
+            // Se crean en orden inverso: el orden de arranque no influye
+            HiloPeriodico<DAConverter, IOEtapa> h3(std::make_shared<DAConverter>(1.0 / f),
+                                                   IOEtapa{&b, &c, &run, &p3}, f, cfg(2.0 / 3.0));
+            HiloPeriodico<DAConverter, IOEtapa> h2(std::make_shared<DAConverter>(1.0 / f),
+                                                   IOEtapa{&a, &b, &run, &p2}, f, cfg(1.0 / 3.0));
+            HiloPeriodico<DAConverter, IOEtapa> h1(std::make_shared<DAConverter>(1.0 / f),
+                                                   IOEtapa{&x, &a, &run, &p1}, f, cfg(0.0));
+            usleep(55000);
+            x.store(1.0, std::memory_order_release);
+            usleep(40000);
+            run = false;
+        }
+        std::cout << "Iteración en que llega el escalón: " << p1 << ", " << p2 << ", " << p3 << std::endl;
+        ok = ok && p1 > 0 && p1 == p2 && p2 == p3 && c.load() == 1.0;
+    }
+
+    // Desfases recomendados: planta → A/D → ref → sumador → PID → D/A
+    const double T = 0.001;
+    ok = ok && faseLazo(EtapaLazo::Planta, T) == 0.0 &&
+         faseLazo(EtapaLazo::AD, T) < faseLazo(EtapaLazo::Sumador, T) &&
+         faseLazo(EtapaLazo::Sumador, T) < faseLazo(EtapaLazo::PID, T) &&
+         faseLazo(EtapaLazo::PID, T) < faseLazo(EtapaLazo::DA, T) && faseLazo(EtapaLazo::DA, T) < T;
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
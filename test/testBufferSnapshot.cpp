@@ -0,0 +1,66 @@
+#include <iostream>
+#include <sstream>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "TransferFunctionSystem.h"
+
+using namespace DiscreteSystems;
+
+int main() {
+    std::cout << "TEST SNAPSHOT DEL BUFFER CIRCULAR (seqlock)" << std::endl;
+    bool ok = true;
+
+    // 1) Orden temporal antes y después de dar la vuelta
+    TransferFunctionSystem tf({1.0}, {1.0, 0.0}, 0.001, 8);   // y = u
+    for (int i = 0; i < 5; ++i) tf.next(i);
+    BufferSnapshot s = tf.snapshot();
+    ok = ok && tf.validate(s) && s.size() == 5 && s.n_second == 0 && s[0].k == 0 && s[4].k == 4;
+
+    for (int i = 5; i < 19; ++i) tf.next(i);
+    s = tf.snapshot();
+    bool orden = tf.validate(s) && s.size() == 8 && s.n_first + s.n_second == 8;
+    for (size_t i = 0; i < s.size(); ++i) {
+        orden = orden && s[i].k == static_cast<int>(11 + i) && s[i].out == 11.0 + i;
+    }
+    std::cout << "Tramos tras dar la vuelta: " << s.n_first << " + " << s.n_second
+              << (orden ? " en orden" : " DESORDENADOS") << std::endl;
+    ok = ok && orden;
+
+    // Una escritura posterior invalida la vista
+    tf.next(0.0);
+    ok = ok && !tf.validate(s);
+
+    // 2) Exportación
+    std::ostringstream tsv, mat;
+    tf.bufferDump(tsv, ExportFormat::TSV);
+    tf.bufferDump(mat, ExportFormat::MATLAB);
+    std::cout << "TSV:\n" << tsv.str();
+    ok = ok && tsv.str().rfind("k\tin\tout\n12\t12\t12\n", 0) == 0;
+    ok = ok && mat.str().rfind("% k in out", 0) == 0 && mat.str().find("\n12 12 12\n") != std::string::npos;
+
+    // 3) Lector concurrente: toda copia validada es una secuencia consecutiva de k
+    TransferFunctionSystem rt({0.5}, {1.0, -0.5}, 0.001, 64);
+    std::atomic<bool> fin{false};
+    std::thread escritor([&] {
+        for (int i = 0; i < 2000000; ++i) rt.next(1.0);
+        fin = true;
+    });
+    std::size_t copias = 0, incoherentes = 0;
+    while (!fin) {
+        std::vector<Sample> copia = rt.snapshotCopy();
+        for (size_t i = 1; i < copia.size(); ++i) {
+            if (copia[i].k != copia[i - 1].k + 1) {
+                ++incoherentes;
+                break;
+            }
+        }
+        ++copias;
+    }
+    escritor.join();
+    std::cout << "Copias concurrentes = " << copias << ", incoherentes = " << incoherentes << std::endl;
+    ok = ok && copias > 0 && incoherentes == 0;
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
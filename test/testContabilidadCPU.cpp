@@ -0,0 +1,75 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include "RuntimeLogger.h"
+
+using namespace DiscreteSystems;
+
+namespace {
+
+/// Escribe 5 líneas de timing (la primera solo fija la referencia de CPU) y devuelve el log
+std::string registrar(bool cpu, RuntimeLogger::CpuTotales& totales) {
+    std::string ruta;
+    {
+        RuntimeLogger log(cpu ? "testCpuOn" : "testCpuOff", 10, "/tmp");
+        log.initializeHilo(1000.0);
+        log.setCpuAccounting(cpu);
+        for (int i = 1; i <= 5; ++i) {
+            volatile double x = 0.0;
+            for (int j = 0; j < 200000; ++j) x = x + j;   // algo de CPU entre líneas
+            usleep(1000);                                  // y un sueño (nvcsw)
+            log.writeLine(i, 0, 250000, 250000, 1000000, 1000000, "OK");
+        }
+        totales = log.cpuTotales();
+        ruta = log.getLogPath();
+    }
+    std::ifstream f(ruta);
+    std::stringstream contenido;
+    contenido << f.rdbuf();
+    std::remove(ruta.c_str());
+    return contenido.str();
+}
+
+/// Número de campos de la última línea de datos
+int campos(const std::string& log) {
+    std::string linea = log.substr(log.rfind("\n5 ") + 1);
+    std::istringstream is(linea);
+    std::string c;
+    int n = 0;
+    while (is >> c) ++n;
+    return n;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "TEST CONTABILIDAD DE CPU EN RUNTIMELOGGER" << std::endl;
+    bool ok = true;
+
+    // 1) Por defecto: formato anterior (10 columnas) y sin resumen de CPU
+    RuntimeLogger::CpuTotales off;
+    std::string logOff = registrar(false, off);
+    std::cout << "Desactivada: " << campos(logOff) << " campos por línea" << std::endl;
+    ok = ok && campos(logOff) == 10 && logOff.find("cpu_us") == std::string::npos &&
+         logOff.find("CPU: total") == std::string::npos && off.muestras == 0;
+
+    // 2) Activada: 5 columnas más, cabecera con sus nombres y resumen
+    RuntimeLogger::CpuTotales on;
+    std::string logOn = registrar(true, on);
+    std::size_t resumen = logOn.find("CPU: total");
+    std::cout << "Activada: " << campos(logOn) << " campos por línea, "
+              << on.muestras << " líneas contabilizadas, " << on.cpu_ns / 1e3 << " us de CPU, nvcsw "
+              << on.nvcsw << std::endl;
+    if (resumen != std::string::npos) {
+        std::cout << "  " << logOn.substr(resumen, logOn.find('\n', resumen) - resumen) << std::endl;
+    }
+    ok = ok && campos(logOn) == 15 && logOn.find("cpu_us") != std::string::npos &&
+         logOn.find("majflt") != std::string::npos && resumen != std::string::npos &&
+         on.muestras == 4 && on.cpu_ns > 0 && on.cpu_max_ns <= on.cpu_ns && on.nvcsw >= 4;
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
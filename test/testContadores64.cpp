@@ -0,0 +1,71 @@
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include "DiscreteSystem.h"
+#include "RuntimeLogger.h"
+#include "Temporizador.h"
+#include "TimingStats.h"
+
+using namespace DiscreteSystems;
+
+// Contadores de pasos de 64 bits: a 1 kHz un int se desborda a los ~24,8 días
+static_assert(std::is_same<decltype(Sample::k), std::int64_t>::value, "Sample::k de 64 bits");
+static_assert(std::is_same<decltype(std::declval<DiscreteSystem&>().getK()), std::int64_t>::value,
+              "DiscreteSystem::getK() de 64 bits");
+
+int main() {
+    std::cout << "TEST CONTADORES DE 64 BITS Y TIEMPOS EN NS ENTEROS" << std::endl;
+    bool ok = true;
+
+    // 1) difNs exacto tras meses de CLOCK_MONOTONIC y a través del cambio de segundo
+    {
+        const std::int64_t s90d = 90LL * 86400;
+        struct timespec antes = { static_cast<time_t>(s90d), 999999500 };
+        struct timespec despues = { static_cast<time_t>(s90d + 1), 500 };
+        std::int64_t d = difNs(despues, antes);
+        std::int64_t abs = aNs(despues);
+        std::cout << "difNs a 90 días: " << d << " ns, aNs = " << abs << std::endl;
+        ok = ok && d == 1000 && difNs(antes, despues) == -1000 &&
+             abs == (s90d + 1) * 1000000000LL + 500;
+    }
+
+    // 2) HiloTiming registra drift y total en ns sin pasar por double
+    {
+        HiloTiming t;
+        struct timespec objetivo = { 7776000, 0 };
+        struct timespec t0 = { 7776000, 12345 };
+        t.record(objetivo, t0, 999999, 1000000, 250, true);     // primera: sin drift
+        t.record(objetivo, t0, 1000003, 1000000, 251, false);
+        ok = ok && t.wake_latency.max() == 12345 && t.drift.count() == 1 &&
+             t.drift.min() == 3 && t.total.min() == 250 && t.total.max() == 251;
+    }
+
+    // 3) El logger formatea iteraciones > 2^31 y convierte ns → us solo al escribir
+    {
+        std::string ruta;
+        {
+            RuntimeLogger log("testContadores64", 10, "/tmp");
+            log.writeLine(5000000000ULL, 0, 250, 250, 1000000, 999500, "OK");
+            ruta = log.getLogPath();
+        }
+        std::ifstream f(ruta);
+        std::stringstream contenido;
+        contenido << f.rdbuf();
+        std::string linea = contenido.str().substr(contenido.str().rfind("5000000000"));
+        std::cout << "Línea: " << linea;
+        std::istringstream campos(linea);
+        std::string iter, espera, ejec, total, periodo, ts_real, drift;
+        campos >> iter >> espera >> ejec >> total >> periodo >> ts_real >> drift;
+        ok = ok && iter == "5000000000" && espera == "0.00" && ejec == "0.25" &&
+             periodo == "1000.00" && ts_real == "999.50" && drift == "-0.50";
+        std::remove(ruta.c_str());
+    }
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
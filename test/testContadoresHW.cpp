@@ -0,0 +1,46 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include "ContadoresHW.h"
+#include "TransferFunctionSystem.h"
+
+using namespace DiscreteSystems;
+
+int main() {
+    std::cout << "TEST CONTADORES HARDWARE (perf_event_open)" << std::endl;
+
+    TransferFunctionSystem tf({0.1, 0.2}, {1.0, -0.7}, 0.001);
+
+    MedidorHW hw;
+    bool disponible = hw.iniciar(typeid(tf));
+    bool ok = true;
+
+    // Sin contadores la instrumentación es transparente: next() funciona igual
+    double acc = 0.0;
+    for (int k = 0; k < 10000; ++k) {
+        hw.antes();
+        acc += tf.next(1.0);
+        hw.despues();
+    }
+    ok = ok && acc > 0.0;
+
+    if (!disponible) {
+        std::cout << "Contadores no disponibles: medidor inactivo, sin errores" << std::endl;
+        ok = ok && !hw.activo() && hw.estadisticas() == nullptr && RegistroHW::resumen().empty();
+    } else {
+        auto resumen = RegistroHW::resumen();
+        ok = ok && resumen.size() == 1 && resumen[0].tipo == "TransferFunctionSystem";
+        if (!resumen.empty()) {
+            const auto& r = resumen[0];
+            std::cout << std::fixed << std::setprecision(2)
+                      << r.tipo << ": llamadas = " << r.llamadas
+                      << ", ciclos/llamada = " << r.ciclosPorLlamada()
+                      << ", IPC = " << r.ipc() << ", GHz = " << r.ghz() << std::endl;
+            ok = ok && r.llamadas == 10000 && r.ciclos > 0 && r.instrucciones > 0;
+        }
+        std::cout << "JSON: " << RegistroHW::toJson() << std::endl;
+    }
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
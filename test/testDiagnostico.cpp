@@ -0,0 +1,48 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Diagnostico.h"
+#include "TransferFunctionSystem.h"
+#include "PIDController.h"
+#include "StateSpaceSystem.h"
+#include "ADConverter.h"
+#include "DAConverter.h"
+
+using namespace DiscreteSystems;
+
+int main() {
+    std::cout << "TEST DIAGNOSTICO (constructores y reset silenciosos)" << std::endl;
+    bool ok = true;
+
+    // 1) Por defecto: ni construir ni reiniciar escribe en std::cout
+    std::ostringstream capturado;
+    std::streambuf* original = std::cout.rdbuf(capturado.rdbuf());
+    {
+        for (int i = 0; i < 1000; ++i) {
+            TransferFunctionSystem tf({0.1}, {1.0, -0.9}, 0.001);
+            PIDController pid(1.0, 0.5, 0.0, 0.001);
+            tf.reset();
+            pid.reset();
+        }
+        StateSpaceSystem ss({{0.9}}, {1.0}, {1.0}, 0.0, 0.001);
+        ADConverter ad(0.001);
+        DAConverter da(0.001);
+    }
+    std::cout.rdbuf(original);
+    std::cout << "Sin sumidero: " << capturado.str().size() << " bytes en std::cout" << std::endl;
+    ok = ok && capturado.str().empty() && !Diagnostico::habilitado();
+
+    // 2) Sumidero propio: recibe los mensajes de construcción y reset
+    std::vector<std::string> mensajes;
+    Diagnostico::setSumidero([&](const std::string& m) { mensajes.push_back(m); });
+    TransferFunctionSystem tf({0.1}, {1.0, -0.9}, 0.001);
+    tf.reset();
+    Diagnostico::setSumidero(nullptr);
+    for (const auto& m : mensajes) std::cout << "  " << m << std::endl;
+    ok = ok && mensajes.size() == 4 && mensajes[1] == "Objeto de tipo TransferFunctionSystem creado correctamente";
+    ok = ok && !Diagnostico::habilitado();
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "EventosRT.h"
+#include "HiloPID.h"
+#include "ParametrosCompartidos.h"
+#include "PIDController.h"
+#include "VariablesCompartidas.h"
+
+using namespace DiscreteSystems;
+
+int main() {
+    std::cout << "TEST EVENTOS RT (cola sin locks, agregación y descarte)" << std::endl;
+    bool ok = true;
+
+    // Cola acotada: llena, descarta sin bloquear y conserva el orden FIFO
+    {
+        ColaEventosRT cola(8);
+        EventoRT ev;
+        int aceptados = 0;
+        for (int i = 0; i < 10; ++i) {
+            ev.iter = i;
+            aceptados += cola.push(ev) ? 1 : 0;
+        }
+        bool orden = true;
+        for (int i = 0; i < 8; ++i) {
+            orden = orden && cola.pop(ev) && ev.iter == static_cast<std::uint64_t>(i);
+        }
+        ok = ok && aceptados == 8 && cola.descartados() == 2 && orden && !cola.pop(ev);
+    }
+
+    // 4 productores concurrentes y un consumidor: no se pierde ni se reordena nada
+    {
+        ColaEventosRT cola(256);
+        const int kProductores = 4, kEventos = 50000;
+        std::atomic<int> terminados(0);
+        std::vector<std::thread> productores;
+        for (int p = 0; p < kProductores; ++p) {
+            productores.emplace_back([&, p] {
+                EventoRT ev;
+                ev.origen[0] = static_cast<char>('A' + p);
+                for (int i = 1; i <= kEventos; ++i) {
+                    ev.iter = i;
+                    while (!cola.push(ev)) {
+                        std::this_thread::yield();
+                    }
+                }
+                terminados++;
+            });
+        }
+        std::uint64_t ultimo[kProductores] = {0, 0, 0, 0};
+        long recibidos = 0;
+        bool orden = true;
+        auto consumir = [&] {
+            EventoRT ev;
+            while (cola.pop(ev)) {
+                int p = ev.origen[0] - 'A';
+                orden = orden && ev.iter == ultimo[p] + 1;
+                ultimo[p] = ev.iter;
+                ++recibidos;
+            }
+        };
+        while (terminados.load() < kProductores) {
+            consumir();
+        }
+        for (auto& t : productores) t.join();
+        consumir();
+        std::cout << "Concurrente: " << recibidos << " eventos, orden por productor "
+                  << (orden ? "correcto" : "INCORRECTO") << ", descartes " << cola.descartados() << std::endl;
+        ok = ok && orden && recibidos == static_cast<long>(kProductores) * kEventos;
+    }
+
+    // Agregación: la primera aparición sale en seguida, el resto en un resumen
+    {
+        std::vector<std::string> lineas;
+        EventosRT::setSumidero([&lineas](const std::string& l) { lineas.push_back(l); });
+        for (int i = 1; i <= 42; ++i) {
+            EventosRT::reportar("hiloPrueba", CodigoEventoRT::PlazoPerdido, i, 1000.0 + i, 1000.0);
+        }
+        EventosRT::reportar("hiloPrueba", CodigoEventoRT::ErrorMutex, 7, 22, 0.0);
+        EventosRT::vaciar();
+        for (const auto& l : lineas) std::cout << "  " << l << std::endl;
+        ok = ok && lineas.size() == 3 &&
+             lineas[0].find("CRITICAL iter 1: plazo perdido") != std::string::npos &&
+             lineas[1].find("código 22") != std::string::npos &&
+             lineas[2].find("41 × plazo perdido") != std::string::npos &&
+             lineas[2].find("1042") != std::string::npos;
+
+        // En la ventana siguiente la misma clave ya no se repite línea a línea
+        lineas.clear();
+        for (int i = 43; i <= 45; ++i) {
+            EventosRT::reportar("hiloPrueba", CodigoEventoRT::PlazoPerdido, i, 1001.0, 1000.0);
+        }
+        EventosRT::vaciar();
+        ok = ok && lineas.size() == 1 && lineas[0].find("3 × plazo perdido") != std::string::npos;
+        EventosRT::setSumidero(nullptr);
+    }
+
+    // HiloPID con el mutex de parámetros ocupado: el evento lleva la espera
+    // medida del timedlock, no el límite repetido ("X > X us")
+    {
+        std::vector<std::string> lineas;
+        EventosRT::setSumidero([&lineas](const std::string& l) { lineas.push_back(l); });
+        VariablesCompartidas vars;
+        ParametrosCompartidos params;
+        vars.running = true;
+        PIDController pid(1.0, 0.5, 0.1, 0.01);
+        pthread_mutex_lock(&params.mtx);
+        {
+            HiloPID hilo(&pid, &vars, &params, 100.0, "pidTimeout");   // Límite: 2000 us
+            usleep(50000);
+            pthread_mutex_unlock(&params.mtx);
+            pthread_mutex_lock(&vars.mtx);
+            vars.running = false;
+            pthread_mutex_unlock(&vars.mtx);
+        }
+        EventosRT::vaciar();
+        EventosRT::setSumidero(nullptr);
+        double medida = 0.0;
+        for (const auto& l : lineas) {
+            std::size_t p = l.find("timeout leyendo parámetros (");
+            if (p != std::string::npos) {
+                std::cout << "  " << l << std::endl;
+                medida = std::strtod(l.c_str() + l.find('(', p) + 1, nullptr);
+            }
+        }
+        ok = ok && medida >= 2000.0 && medida < 10000.0;
+    }
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
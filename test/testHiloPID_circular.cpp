@@ -60,7 +60,7 @@ int main() {
         pthread_mutex_unlock(&vars->mtx);
         
         if (i % 3 == 0) {
-            int k = hiloPID.getIterations();  // Obtener iteración real del hilo
+            std::uint64_t k = hiloPID.getIterations();  // Obtener iteración real del hilo
             std::cout << "t=" << (i * 0.1) << "s | ";
             std::cout << "k=" << k << " iterations\n";
         }
@@ -0,0 +1,62 @@
+#include <iostream>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <unistd.h>
+#include "HiloPeriodico.h"
+#include "TransferFunctionSystem.h"
+#include "PIDController.h"
+#include "Sumador.h"
+
+using namespace DiscreteSystems;
+
+int main() {
+    std::cout << "TEST HILO PERIODICO (plantilla, sin despacho virtual)" << std::endl;
+    bool ok = true;
+
+    // 1) nextDirecto<T>() produce lo mismo que next() y avanza el buffer igual
+    TransferFunctionSystem a({0.1, 0.2}, {1.0, -0.7}, 0.001, 16);
+    TransferFunctionSystem b({0.1, 0.2}, {1.0, -0.7}, 0.001, 16);
+    Sumador s1(0.001), s2(0.001);
+    bool iguales = true;
+    for (int k = 0; k < 100; ++k) {
+        double u = std::sin(0.1 * k);
+        iguales = iguales && a.next(u) == b.nextDirecto<TransferFunctionSystem>(u);
+        iguales = iguales && s1.next(u, 0.5) == s2.nextDirecto<Sumador>(u, 0.5);
+    }
+    iguales = iguales && a.getK() == b.getK() && a.getCount() == b.getCount() &&
+              a.snapshotCopy().back().out == b.snapshotCopy().back().out;
+    std::cout << "nextDirecto == next: " << (iguales ? "sí" : "NO") << std::endl;
+    ok = ok && iguales;
+
+    // 2) Política IOMutex: planta de ganancia estática 1 con entrada constante
+    pthread_mutex_t mtx = PTHREAD_MUTEX_INITIALIZER;
+    bool running = true;
+    double u = 2.0, y = 0.0;
+    auto planta = std::make_shared<TransferFunctionSystem>(std::vector<double>{0.3}, std::vector<double>{1.0, -0.7}, 0.001);
+
+    // 3) Política IOAtomico: PID proporcional
+    std::atomic<double> e{0.5}, upid{0.0};
+    std::atomic<bool> run{true};
+    auto pid = std::make_shared<PIDController>(4.0, 0.0, 0.0, 0.001);
+    {
+        HiloPeriodico<TransferFunctionSystem> hp(planta, IOMutex{&u, &y, &running, &mtx}, 1000.0);
+        HiloPeriodico<PIDController, IOAtomico> hpid(pid, IOAtomico{&e, &upid, &run}, 1000.0);
+        usleep(200000);
+        pthread_mutex_lock(&mtx);
+        running = false;
+        pthread_mutex_unlock(&mtx);
+        run = false;
+        usleep(5000);
+
+        std::cout << "IOMutex: " << hp.getIterations() << " iteraciones, y = " << y
+                  << ", t_total p50 = " << hp.timing().total.percentile(50) << " ns" << std::endl;
+        std::cout << "IOAtomico: " << hpid.getIterations() << " iteraciones, u = " << upid.load() << std::endl;
+        ok = ok && hp.getIterations() > 100 && std::fabs(y - 2.0) < 1e-9;
+        ok = ok && hpid.getIterations() > 100 && std::fabs(upid.load() - 2.0) < 1e-12;
+        ok = ok && planta->getK() == static_cast<std::int64_t>(hp.getIterations());
+    }
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
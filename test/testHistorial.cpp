@@ -0,0 +1,154 @@
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "ColaMuestras.h"
+#include "PIDController.h"
+#include "TransferFunctionSystem.h"
+
+using namespace DiscreteSystems;
+
+int main() {
+    std::cout << "TEST POLÍTICA DE HISTORIAL (ninguno, anillo, externo)" << std::endl;
+    bool ok = true;
+
+    // 1) Sin historial: misma salida, k avanza y no queda nada guardado
+    {
+        TransferFunctionSystem con({0.1}, {1.0, -0.9}, 0.001, 100);
+        TransferFunctionSystem sin({0.1}, {1.0, -0.9}, 0.001, 0);
+        std::vector<double> u(64, 1.0), y(64);
+        bool iguales = true;
+        for (int i = 0; i < 50; ++i) iguales = iguales && con.next(i) == sin.next(i);
+        con.process(u.data(), y.data(), u.size());
+        sin.process(u.data(), y.data(), u.size());
+        iguales = iguales && con.next(0.0) == sin.next(0.0);
+        std::cout << "Ninguno: " << sin.getCount() << " muestras guardadas, k = " << sin.getK()
+                  << (iguales ? ", salidas idénticas" : ", SALIDAS DISTINTAS") << std::endl;
+        ok = ok && iguales && sin.getHistorial() == PoliticaHistorial::Ninguno
+                && sin.getCount() == 0 && sin.snapshot().size() == 0 && sin.getK() == 115;
+    }
+
+    // 2) Anillo de tamaño no potencia de 2: las últimas 5, en orden
+    {
+        TransferFunctionSystem tf({1.0}, {1.0, 0.0}, 0.001, 5);   // y = u
+        bool orden = true;
+        for (int n = 0; n < 23; ++n) {
+            tf.next(n);
+            std::vector<Sample> v = tf.snapshotCopy();
+            size_t esperadas = n + 1 < 5 ? n + 1 : 5;
+            orden = orden && v.size() == esperadas && tf.getCount() == esperadas;
+            for (size_t i = 0; i < v.size(); ++i) {
+                orden = orden && v[i].k == static_cast<int>(n + 1 - esperadas + i) && v[i].out == v[i].k;
+            }
+        }
+        std::cout << "Anillo de 5: " << (orden ? "últimas 5 en orden" : "DESORDENADO") << std::endl;
+        ok = ok && orden;
+    }
+
+    // 3) reset(): k = 0, historial vacío y salida como la de un bloque nuevo
+    {
+        TransferFunctionSystem tf({0.1, 0.05}, {1.0, -0.9}, 0.001, 8);
+        TransferFunctionSystem nuevo({0.1, 0.05}, {1.0, -0.9}, 0.001, 8);
+        for (int i = 0; i < 20; ++i) tf.next(1.0);
+        tf.reset();
+        bool vacio = tf.getK() == 0 && tf.getCount() == 0 && tf.snapshot().size() == 0;
+        bool iguales = true;
+        for (int i = 0; i < 20; ++i) iguales = iguales && tf.next(std::sin(0.3 * i)) == nuevo.next(std::sin(0.3 * i));
+        std::vector<Sample> v = tf.snapshotCopy();
+        bool recientes = v.size() == 8 && v.front().k == 12 && v.back().k == 19;
+        std::cout << "reset(): " << (vacio ? "k y historial a cero" : "ESTADO RESIDUAL")
+                  << (iguales ? ", salida como recién creado" : ", SALIDA DISTINTA") << std::endl;
+        ok = ok && vacio && iguales && recientes;
+    }
+
+    // 4) Externo: el registrador recibe todas las muestras, también por process()
+    {
+        ColaMuestras cola(256);
+        TransferFunctionSystem tf({1.0}, {1.0, 0.0}, 0.001, 8);
+        tf.setHistorial(PoliticaHistorial::Externo, &cola);
+        std::vector<double> u(100), y(100);
+        for (int i = 0; i < 100; ++i) u[i] = i + 10.0;
+        for (int i = 0; i < 10; ++i) tf.next(i);
+        tf.process(u.data(), y.data(), u.size());
+
+        Sample s;
+        int n = 0;
+        bool completas = tf.getCount() == 0;
+        while (cola.pop(s)) {
+            completas = completas && s.k == n && s.in == n && s.out == n;
+            ++n;
+        }
+        std::cout << "Externo: " << n << " muestras recibidas, " << cola.descartadas()
+                  << " descartadas" << std::endl;
+        ok = ok && completas && n == 110 && cola.descartadas() == 0;
+
+        // Cola llena: se descarta y se cuenta, el bloque sigue
+        for (int i = 0; i < 300; ++i) tf.next(0.0);
+        n = 0;
+        while (cola.pop(s)) ++n;
+        ok = ok && n == 256 && cola.descartadas() == 44;
+
+        // Productor y consumidor concurrentes: lo recibido llega en orden y
+        // recibidas + descartadas = producidas
+        tf.reset();
+        const int total = 200000;
+        const std::uint64_t descartadasAntes = cola.descartadas();
+        std::atomic<bool> fin{false};
+        int recibidas = 0;
+        bool enOrden = true;
+        std::thread consumidor([&] {
+            Sample m;
+            std::int64_t anterior = -1;
+            bool ultima = false;
+            while (!ultima) {
+                ultima = fin.load(std::memory_order_acquire);
+                while (cola.pop(m)) {
+                    enOrden = enOrden && m.k > anterior && m.in == m.k;
+                    anterior = m.k;
+                    ++recibidas;
+                }
+            }
+        });
+        for (int i = 0; i < total; ++i) tf.next(i);
+        fin.store(true, std::memory_order_release);
+        consumidor.join();
+        std::uint64_t perdidas = cola.descartadas() - descartadasAntes;
+        std::cout << "Concurrente: " << recibidas << " recibidas + " << perdidas
+                  << " descartadas" << std::endl;
+        ok = ok && enOrden && recibidas + perdidas == static_cast<std::uint64_t>(total);
+    }
+
+    // 5) El PID con estado escalar da la ecuación en diferencias de siempre
+    {
+        const double Kp = 5.0, Ki = 3.0, Kd = 0.7, Ts = 0.01;
+        PIDController pid(Kp, Ki, Kd, Ts, 0);
+        double a0 = Kp + Ki * Ts + Kd / Ts, a1 = -Kp - 2.0 * Kd / Ts, a2 = Kd / Ts;
+        double e1 = 0.0, e2 = 0.0, u1 = 0.0, err = 0.0;
+        for (int k = 0; k < 1000; ++k) {
+            double e = std::sin(0.01 * k);
+            double u = u1 + (a0 * e + a1 * e1 + a2 * e2);
+            err = std::max(err, std::fabs(pid.next(e) - u));
+            e2 = e1; e1 = e; u1 = u;
+        }
+        std::cout << "PID: error máx " << err << ", u(k-1) = " << pid.getLastControl() << std::endl;
+        ok = ok && err == 0.0 && pid.getLastControl() == u1;
+        pid.reset();
+        ok = ok && pid.getLastControl() == 0.0;
+    }
+
+    // 6) Combinaciones inválidas
+    auto lanza = [](auto f) {
+        try { f(); } catch (const std::invalid_argument&) { return true; }
+        return false;
+    };
+    ok = ok && lanza([] { TransferFunctionSystem t({1.0}, {1.0, 0.0}, 0.001, 0);
+                          t.setHistorial(PoliticaHistorial::Anillo); });
+    ok = ok && lanza([] { TransferFunctionSystem t({1.0}, {1.0, 0.0}, 0.001, 4);
+                          t.setHistorial(PoliticaHistorial::Externo); });
+    ok = ok && lanza([] { ColaMuestras c(100); });
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "Decimador.h"
+#include "Interpolador.h"
+
+using namespace DiscreteSystems;
+
+namespace {
+
+const double kTs = 0.001;   // Tasa alta: 1 kHz
+const size_t kN = 10;       // Tasa baja: 100 Hz
+
+/// Amplitud de la salida decimada para un seno de f Hz (tras el transitorio)
+double amplitudDecimada(Decimador& dec, double f) {
+    double amp = 0.0;
+    for (int n = 0; n < 4000; ++n) {
+        double y = dec.next(std::sin(2.0 * M_PI * f * n * kTs));
+        if (n >= 1000 && dec.salidaNueva()) {
+            amp = std::max(amp, std::fabs(y));
+        }
+    }
+    return amp;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "TEST MULTITASA (decimador e interpolador CIC / FIR polifásico)" << std::endl;
+    bool ok = true;
+
+    // 1) El FIR polifásico da lo mismo que la convolución directa cada N entradas
+    {
+        std::vector<double> h = disenarPasoBajoMultitasa(kN, 4);
+        Decimador dec(kN, h, kTs);
+        std::vector<double> x;
+        double err = 0.0;
+        size_t salidas = 0;
+        for (size_t n = 0; n < 500; ++n) {
+            x.push_back(std::sin(0.37 * n) + 0.5 * std::cos(1.9 * n));
+            double y = dec.next(x.back());
+            if ((n + 1) % kN == 0) {
+                double ref = 0.0;
+                for (size_t i = 0; i < h.size() && i <= n; ++i) ref += h[i] * x[n - i];
+                err = std::max(err, std::fabs(y - ref));
+                ok = ok && dec.salidaNueva();
+                ++salidas;
+            } else {
+                ok = ok && !dec.salidaNueva();
+            }
+        }
+        std::cout << "FIR polifásico vs convolución: error máx " << err << ", "
+                  << dec.getSalidas() << " salidas" << std::endl;
+        ok = ok && err < 1e-12 && dec.getSalidas() == salidas && dec.getK() == 500;
+    }
+
+    // 2) Ganancia unidad en continua, rechazo de aliasing y banda de paso
+    {
+        Decimador fir(kN, FiltroMultitasa::FIR, kTs, 4);
+        Decimador cic(kN, FiltroMultitasa::CIC, kTs, 3);
+        double dc_fir = 0.0, dc_cic = 0.0;
+        for (int n = 0; n < 200; ++n) {
+            dc_fir = fir.next(2.5);
+            dc_cic = cic.next(2.5);
+        }
+        ok = ok && std::fabs(dc_fir - 2.5) < 1e-9 && std::fabs(dc_cic - 2.5) < 1e-6;
+
+        // 190 Hz se pliega sobre 10 Hz al muestrear a 100 Hz sin filtrar
+        fir.reset();
+        cic.reset();
+        double alias_fir = amplitudDecimada(fir, 190.0);
+        double alias_cic = amplitudDecimada(cic, 190.0);
+        fir.reset();
+        double paso_fir = amplitudDecimada(fir, 5.0);
+        std::cout << "Tono de 190 Hz tras decimar: FIR " << alias_fir << ", CIC " << alias_cic
+                  << " (sin filtro: 1); tono de 5 Hz: FIR " << paso_fir << std::endl;
+        ok = ok && alias_fir < 0.02 && alias_cic < 0.01 && paso_fir > 0.9;
+    }
+
+    // 3) Interpolador: continua con ganancia unidad y escalón sin saltos de 1 muestra
+    for (FiltroMultitasa tipo : {FiltroMultitasa::FIR, FiltroMultitasa::CIC}) {
+        Interpolador interp(kN, tipo, kTs);
+        double salto = 0.0, y_prev = 0.0, y = 0.0;
+        for (int n = 0; n < 300; ++n) {
+            y = interp.next(n < 100 ? 0.0 : 1.5);
+            salto = std::max(salto, std::fabs(y - y_prev));
+            y_prev = y;
+        }
+        const char* nombre = tipo == FiltroMultitasa::FIR ? "FIR" : "CIC";
+        std::cout << "Interpolador " << nombre << ": y final " << y << ", salto máx "
+                  << salto << " (ZOH: 1.5), " << interp.getEntradas() << " entradas" << std::endl;
+        ok = ok && std::fabs(y - 1.5) < 1e-6 && salto < 0.5 && interp.getEntradas() == 30;
+    }
+
+    // 4) Parámetros inválidos
+    auto lanza = [](auto f) {
+        try { f(); } catch (const std::invalid_argument&) { return true; }
+        return false;
+    };
+    ok = ok && lanza([] { Decimador d(1, FiltroMultitasa::FIR, kTs); });
+    ok = ok && lanza([] { Decimador d(1000, FiltroMultitasa::CIC, kTs, 8); });
+    ok = ok && lanza([] { Interpolador i(kN, std::vector<double>{}, kTs); });
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
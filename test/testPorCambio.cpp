@@ -0,0 +1,135 @@
+#include <atomic>
+#include <iostream>
+#include <memory>
+#include <unistd.h>
+#include "ADConverter.h"
+#include "DAConverter.h"
+#include "Hilo.h"
+#include "Hilo2in.h"
+#include "HiloPeriodico.h"
+#include "Sumador.h"
+#include "TokenParada.h"
+#include "TransferFunctionSystem.h"
+#include "VariablesLazoAlineadas.h"
+
+using namespace DiscreteSystems;
+
+namespace {
+
+/// Escribe u (y su marca) 20 veces cada 10 ms, como un PID a 100 Hz
+void escribirA100Hz(double* u, MarcaTemporal* marca, pthread_mutex_t* mtx) {
+    for (int i = 1; i <= 20; ++i) {
+        pthread_mutex_lock(mtx);
+        *u = i;
+        std::int64_t ahora = MarcaTemporal::ahoraNs();
+        marca->marcar(ahora, ahora);
+        pthread_mutex_unlock(mtx);
+        usleep(10000);
+    }
+}
+
+} // namespace
+
+int main() {
+    std::cout << "TEST EJECUCION POR CAMBIO (bloques sin memoria)" << std::endl;
+    bool ok = true;
+
+    TransferFunctionSystem tf({0.5}, {1.0, -0.5}, 0.001);
+    ok = ok && DAConverter(0.001).sinMemoria() && Sumador(0.001).sinMemoria() &&
+         !ADConverter(0.001).sinMemoria() && !tf.sinMemoria();
+
+    // DA a 1 kHz con u a 100 Hz: solo se evalúa cuando u se reescribe
+    for (int modo = 0; modo < 3; ++modo) {
+        TokenParada token;
+        pthread_mutex_t mtx = PTHREAD_MUTEX_INITIALIZER;
+        bool running = true;
+        double u = 0.0, y = 0.0;
+        MarcaTemporal marca_u, marca_y;
+        ConfigHilo cfg;
+        cfg.parada = &token;
+        cfg.marca_entrada = &marca_u;
+        cfg.marca_salida = &marca_y;
+        cfg.por_cambio = modo != 1;
+
+        std::shared_ptr<DiscreteSystem> bloque;
+        if (modo == 2) {
+            bloque = std::make_shared<ADConverter>(0.001);   // con estado: nunca se omite
+        } else {
+            bloque = std::make_shared<DAConverter>(0.001);
+        }
+        std::uint64_t omitidas;
+        {
+            Hilo hilo(bloque.get(), &u, &y, &running, &mtx, 1000.0, "testPorCambio", cfg);
+            escribirA100Hz(&u, &marca_u, &mtx);
+            token.detener();
+            usleep(5000);
+            omitidas = hilo.getOmitidas();
+        }
+        std::int64_t k = bloque->getK();
+        std::cout << (modo == 2 ? "AD" : "DA") << (cfg.por_cambio ? " por cambio" : " siempre")
+                  << ": " << k << " evaluaciones, " << omitidas << " omitidas, y = " << y
+                  << ", seq salida " << marca_y.seq << std::endl;
+        if (modo == 0) {
+            ok = ok && k <= 21 && omitidas > 100 && y == 20.0 && marca_y.seq == 20;
+        } else {
+            ok = ok && omitidas == 0 && k > 100;
+        }
+    }
+
+    // Sumador en Hilo2in: se omite si no cambia ninguna de las dos entradas
+    {
+        TokenParada token;
+        pthread_mutex_t mtx = PTHREAD_MUTEX_INITIALIZER;
+        bool running = true;
+        double ref = 0.0, ykd = 0.25, e = 0.0;
+        MarcaTemporal marca_ref, marca_ykd, marca_e;
+        marca_ykd.marcar(1, 1);
+        ConfigHilo cfg;
+        cfg.parada = &token;
+        cfg.marca_entrada = &marca_ref;
+        cfg.marca_entrada2 = &marca_ykd;
+        cfg.marca_salida = &marca_e;
+        cfg.por_cambio = true;
+        Sumador sum(0.001);
+        std::uint64_t omitidas;
+        {
+            Hilo2in hilo(&sum, &ref, &ykd, &e, &running, &mtx, 1000.0, "testPorCambio2", cfg);
+            escribirA100Hz(&ref, &marca_ref, &mtx);
+            token.detener();
+            usleep(5000);
+            omitidas = hilo.getOmitidas();
+        }
+        std::cout << "Sumador por cambio: " << sum.getK() << " evaluaciones, " << omitidas
+                  << " omitidas, e = " << e << std::endl;
+        ok = ok && sum.getK() <= 21 && omitidas > 100 && e == 19.75;
+    }
+
+    // HiloPeriodico con IOCanal: la generación sale del propio canal
+    {
+        TokenParada token;
+        VariablesLazoAlineadas va;
+        ConfigHilo cfg;
+        cfg.parada = &token;
+        cfg.por_cambio = true;
+        auto da = std::make_shared<DAConverter>(0.001);
+        std::uint64_t iteraciones, omitidas;
+        {
+            HiloPeriodico<DAConverter, IOCanal<CanalLazo>> hilo(da, {&va.u, &va.ua, &va.running}, 1000.0, cfg);
+            for (int i = 1; i <= 20; ++i) {
+                va.u.publicar(i, MarcaTemporal::ahoraNs(), MarcaTemporal::ahoraNs());
+                usleep(10000);
+            }
+            token.detener();
+            usleep(5000);
+            iteraciones = hilo.getIterations();
+            omitidas = hilo.getOmitidas();
+        }
+        std::cout << "HiloPeriodico por cambio: " << iteraciones << " iteraciones, " << omitidas
+                  << " omitidas, ua = " << va.ua.leer() << std::endl;
+        ok = ok && da->getK() <= 21 && omitidas > 100 && va.ua.leer() == 20.0 &&
+             static_cast<std::uint64_t>(da->getK()) + omitidas == iteraciones;
+    }
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
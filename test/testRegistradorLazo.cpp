@@ -0,0 +1,88 @@
+#include <iostream>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+#include <sys/stat.h>
+#include "RegistradorLazo.h"
+
+using namespace DiscreteSystems;
+
+int main() {
+    std::cout << "TEST REGISTRADOR DEL LAZO (columnar, mmap)" << std::endl;
+
+    const std::string path = "/tmp/testRegistradorLazo.dsrec";
+    const std::uint64_t n = 10000;   // Cruza varios chunks (512) y segmentos (2 chunks)
+    const std::int64_t t0 = 1000000;
+    bool ok = true;
+
+    {
+        RegistradorLazo rec(path, 0.001, 512, 2);
+        for (std::uint64_t i = 0; i < n; ++i) {
+            MuestraLazo m;
+            m.t_ns = t0 + static_cast<std::int64_t>(i) * 1000000;
+            m.ref = 1.0;
+            m.e = 0.5 * i;
+            m.u = -1.0 * i;
+            m.ua = 2.0 * i;
+            m.yk = 3.0 * i;
+            m.ykd = 4.0 * i;
+            rec.append(m);
+        }
+        ok = ok && rec.muestras() == n;
+    }
+
+    // El segmento que el hilo auxiliar dejó preparado se descarta al cerrar:
+    // 10000 filas ocupan 20 chunks (10 segmentos completos)
+    struct stat st;
+    const off_t esperado = CabeceraRegistro::kTamano + 20 * 512 * CabeceraRegistro::kColumnas * 8;
+    ok = ok && ::stat(path.c_str(), &st) == 0 && st.st_size == esperado;
+    std::cout << "Tamaño del fichero = " << st.st_size << " (esperado " << esperado << ")" << std::endl;
+
+    LectorRegistro lr(path);
+    std::cout << "Muestras = " << lr.muestras() << ", por chunk = " << lr.muestrasChunk()
+              << ", columnas = " << lr.cabecera().columnas << std::endl;
+    ok = ok && lr.muestras() == n && lr.muestrasChunk() == 512;
+
+    // Acceso por fila
+    bool filas = true;
+    for (std::uint64_t i = 0; i < n; ++i) {
+        MuestraLazo m = lr.muestra(i);
+        filas = filas && m.t_ns == t0 + static_cast<std::int64_t>(i) * 1000000 &&
+                m.ref == 1.0 && m.e == 0.5 * i && m.u == -1.0 * i &&
+                m.ua == 2.0 * i && m.yk == 3.0 * i && m.ykd == 4.0 * i;
+    }
+    std::cout << "Filas: " << (filas ? "coinciden" : "NO coinciden") << std::endl;
+    ok = ok && filas;
+
+    // Copia de columna cruzando chunks y recortada al final
+    std::vector<double> yk(2000);
+    std::size_t copiados = lr.leer(ColumnaLazo::Yk, 500, yk.size(), yk.data());
+    bool columna = copiados == yk.size();
+    for (std::size_t j = 0; j < copiados; ++j) {
+        columna = columna && yk[j] == 3.0 * (500 + j);
+    }
+    std::size_t finales = lr.leer(ColumnaLazo::Yk, n - 10, yk.size(), yk.data());
+    std::cout << "Columna yk [500, 2500): " << (columna ? "OK" : "FALLO")
+              << ", recorte final = " << finales << std::endl;
+    ok = ok && columna && finales == 10;
+
+    // Búsqueda por tiempo
+    std::uint64_t i_exacto = lr.buscarTiempo(t0 + 4321 * 1000000LL);
+    std::uint64_t i_medio = lr.buscarTiempo(t0 + 4321 * 1000000LL + 1);
+    std::uint64_t i_fuera = lr.buscarTiempo(t0 + static_cast<std::int64_t>(n) * 1000000);
+    std::cout << "buscarTiempo: " << i_exacto << ", " << i_medio << ", " << i_fuera << std::endl;
+    ok = ok && i_exacto == 4321 && i_medio == 4322 && i_fuera == n;
+
+    // Cabecera inválida
+    bool lanza = false;
+    try {
+        LectorRegistro malo("/proc/self/cmdline");
+    } catch (const std::runtime_error&) {
+        lanza = true;
+    }
+    ok = ok && lanza;
+
+    std::remove(path.c_str());
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+#include <iostream>
+#include <cmath>
+#include <cstdio>
+#include "RegistradorLazo.h"
+#include "Reproductor.h"
+#include "PIDController.h"
+#include "TransferFunctionSystem.h"
+#include "Sumador.h"
+
+using namespace DiscreteSystems;
+
+int main() {
+    std::cout << "TEST REPRODUCCION DE REGISTROS" << std::endl;
+
+    const std::string path = "/tmp/testReproductor.dsrec";
+    const double Ts = 0.001;
+    const int n = 20000;   // Varios chunks de 512
+    bool ok = true;
+
+    // Lazo grabado muestra a muestra con next(), como en los hilos
+    {
+        RegistradorLazo rec(path, Ts, 512, 4);
+        PIDController pid(2.0, 5.0, 0.01, Ts);
+        TransferFunctionSystem planta({0.00995}, {1.0, -0.99}, Ts);
+        Sumador sumador(Ts);
+        double yk = 0.0;
+        for (int k = 0; k < n; ++k) {
+            MuestraLazo m;
+            m.t_ns = static_cast<std::int64_t>(k) * 1000000;
+            m.ref = (k / 2000) % 2 ? 1.0 : 0.0;
+            m.ykd = yk;
+            m.e = sumador.next(m.ref, m.ykd);
+            m.u = pid.next(m.e);
+            m.ua = m.u;
+            m.yk = yk = planta.next(m.ua);
+            rec.append(m);
+        }
+    }
+
+    LectorRegistro lr(path);
+
+    // 1) e -> PID reproduce u exactamente
+    PIDController pid(2.0, 5.0, 0.01, Ts);
+    Reproductor rep(lr);
+    rep.etapa(pid);
+    ResultadoReproduccion r = rep.ejecutar(ColumnaLazo::E, ColumnaLazo::U);
+    std::cout << "PID: " << r.muestras << " muestras, fuera = " << r.fuera_tolerancia
+              << ", error máx = " << r.error_max << ", " << r.muestrasPorSegundo() / 1e6 << " Msamples/s" << std::endl;
+    ok = ok && r.ok() && r.muestras == static_cast<std::uint64_t>(n);
+
+    // 2) Cadena de dos etapas: u -> (ganancia 1) -> planta, comparada con yk
+    TransferFunctionSystem unidad({1.0}, {1.0, 0.0}, Ts);
+    TransferFunctionSystem planta({0.00995}, {1.0, -0.99}, Ts);
+    Reproductor rp(lr);
+    rp.etapa(unidad).etapa(planta);
+    OpcionesReproduccion op;
+    op.bloque = 300;   // No alineado con los chunks
+    r = rp.ejecutar(ColumnaLazo::U, ColumnaLazo::Yk, op);
+    std::cout << "Planta: fuera = " << r.fuera_tolerancia << ", rms = " << r.error_rms << std::endl;
+    ok = ok && r.ok();
+
+    // 3) Primera etapa de dos entradas: ref, ykd -> Sumador -> e
+    Sumador sumador(Ts);
+    Reproductor rs(lr);
+    rs.etapa(sumador);
+    r = rs.ejecutar(ColumnaLazo::Ref, ColumnaLazo::Ykd, ColumnaLazo::E);
+    ok = ok && r.ok();
+
+    // 4) Un PID distinto se detecta, con las primeras discrepancias localizadas
+    PIDController otro(2.5, 5.0, 0.01, Ts);
+    Reproductor ro(lr);
+    ro.etapa(otro);
+    op = OpcionesReproduccion();
+    op.tol_abs = 1e-6;
+    op.max_discrepancias = 4;
+    r = ro.ejecutar(ColumnaLazo::E, ColumnaLazo::U, op);
+    std::cout << "PID con Kp distinto: fuera = " << r.fuera_tolerancia
+              << ", primera fila = " << (r.discrepancias.empty() ? 0 : r.discrepancias[0].fila) << std::endl;
+    ok = ok && !r.ok() && r.discrepancias.size() == 4 && r.discrepancias[0].fila == 2000 &&
+         r.discrepancias[0].t_ns == 2000LL * 1000000;
+
+    std::remove(path.c_str());
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
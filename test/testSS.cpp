@@ -58,6 +58,7 @@ int main() {
 
     // Mostrar buffer circular completo
     std::cout << std::endl<<"Buffer circular (últimas " << sys.getCount() << " muestras)"<<std::endl;
+    sys.bufferDump(std::cout, ExportFormat::TSV);
 
     //ejecutar en consola ../bin/testSS > ../test/output.txt (sobreescribe output.txt)
     //ejecutar en consola ../bin/testSS >> ../test/output.txt (añade salida a output.txt)
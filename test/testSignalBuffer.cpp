@@ -0,0 +1,85 @@
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+#include "SignalGenerator.h"
+
+using namespace SignalGenerator;
+
+// Comprueba que times[i] == (primera + i) * Ts para las n muestras dadas
+static bool cronologico(const double* times, std::size_t n, std::size_t primera, double Ts) {
+    for (std::size_t i = 0; i < n; ++i) {
+        if (times[i] != static_cast<double>(primera + i) * Ts) return false;
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "TEST ANILLO DE MUESTRAS DE SIGNAL" << std::endl;
+    bool ok = true;
+    const double Ts = 0.25;   // exacto en binario: los tiempos acumulados son k*Ts sin error
+
+    // 1) Antes de llenar: bufferCount crece y el orden es cronológico
+    StepSignal s(Ts, 1.0, 0.0, 0.0, 8);
+    for (int k = 0; k < 5; ++k) s.next();
+    std::vector<double> t = s.timeBuffer();
+    bool parcial = s.bufferCount() == 5 && t.size() == 5 && cronologico(t.data(), 5, 0, Ts);
+    std::cout << "Parcial: " << s.bufferCount() << " muestras " << (parcial ? "OK" : "FALLO") << std::endl;
+    ok = ok && parcial;
+
+    // 2) Vuelta completa: 21 muestras en capacidad 8 -> quedan las k = 13..20
+    for (int k = 5; k < 21; ++k) s.next();
+    t = s.timeBuffer();
+    std::vector<double> v = s.valueBuffer();
+    bool vuelta = s.bufferCount() == 8 && t.size() == 8 && v.size() == 8 &&
+                  cronologico(t.data(), 8, 13, Ts) && v.front() == 1.0 && v.back() == 1.0;
+    std::cout << "Vuelta: t = " << t.front() << " .. " << t.back() << " " << (vuelta ? "OK" : "FALLO") << std::endl;
+    ok = ok && vuelta;
+
+    // 3) snapshot(): las max_samples más recientes en orden, cruzando el final del anillo
+    double tt[3], vv[3], todo[16];
+    std::size_t n3 = s.snapshot(tt, vv, 3);
+    std::size_t n16 = s.snapshot(todo, nullptr, 16);
+    bool snap = n3 == 3 && cronologico(tt, 3, 18, Ts) && vv[0] == 1.0 &&
+                n16 == 8 && cronologico(todo, 8, 13, Ts) &&
+                s.snapshot(nullptr, nullptr, 0) == 0;
+    std::cout << "snapshot: " << (snap ? "OK" : "FALLO") << std::endl;
+    ok = ok && snap;
+
+    // 4) setRecording(false): next() sigue avanzando el tiempo pero no toca el anillo
+    s.setRecording(false);
+    for (int k = 21; k < 30; ++k) s.next();
+    double bloque[4];
+    s.generate(bloque, 4);
+    t = s.timeBuffer();
+    bool sinRegistro = !s.recording() && s.bufferCount() == 8 && cronologico(t.data(), 8, 13, Ts) &&
+                       s.t() == 34 * Ts;
+    s.setRecording(true);
+    s.next();   // k = 34
+    t = s.timeBuffer();
+    sinRegistro = sinRegistro && cronologico(t.data(), 7, 14, Ts) && t.back() == 34 * Ts;
+    std::cout << "setRecording(false): " << (sinRegistro ? "OK" : "FALLO") << std::endl;
+    ok = ok && sinRegistro;
+
+    // 5) setBufferSize(): vacía el anillo y aplica la nueva capacidad; 0 se rechaza
+    s.setBufferSize(3);
+    bool redim = s.bufferSize() == 3 && s.bufferCount() == 0 && s.timeBuffer().empty();
+    for (int k = 35; k < 40; ++k) s.next();
+    t = s.timeBuffer();
+    redim = redim && s.bufferCount() == 3 && cronologico(t.data(), 3, 37, Ts);
+    double cinco[5];
+    s.generate(cinco, 5);   // bloque mayor que el anillo: quedan las k = 42..44
+    t = s.timeBuffer();
+    redim = redim && s.bufferCount() == 3 && cronologico(t.data(), 3, 42, Ts);
+    bool lanzado = false;
+    try {
+        s.setBufferSize(0);
+    } catch (const std::invalid_argument&) {
+        lanzado = true;
+    }
+    redim = redim && lanzado && s.bufferSize() == 3;
+    std::cout << "setBufferSize: " << (redim ? "OK" : "FALLO") << std::endl;
+    ok = ok && redim;
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
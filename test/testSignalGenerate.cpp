@@ -0,0 +1,83 @@
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "SignalGenerator.h"
+
+using namespace SignalGenerator;
+
+// Compara generate() por bloques irregulares con next() muestra a muestra
+static double compare(Signal& byBlock, Signal& bySample, std::size_t N, std::size_t block) {
+    std::vector<double> out(N);
+    for (std::size_t start = 0; start < N; start += block) {
+        std::size_t len = std::min(block, N - start);
+        byBlock.generate(out.data() + start, len);
+    }
+    double maxErr = 0.0;
+    for (std::size_t k = 0; k < N; ++k) {
+        maxErr = std::max(maxErr, std::abs(out[k] - bySample.next()));
+    }
+
+    // El anillo debe contener las mismas últimas muestras
+    std::vector<double> a = byBlock.valueBuffer();
+    std::vector<double> b = bySample.valueBuffer();
+    if (a.size() != b.size()) return INFINITY;
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        maxErr = std::max(maxErr, std::abs(a[i] - b[i]));
+    }
+    return maxErr;
+}
+
+int main() {
+    std::cout << "TEST GENERACIÓN POR BLOQUES (Signal::generate)" << std::endl;
+
+    const double Ts = 0.001;
+    const std::size_t N = 100000;
+    const std::size_t block = 37;   // No divide a kMixerBlock ni al tamaño del anillo
+    bool ok = true;
+    std::cout << std::setprecision(3);
+
+    {
+        StepSignal a(Ts, 2.0, 0.2505, 0.5, 100), b(Ts, 2.0, 0.2505, 0.5, 100);
+        double err = compare(a, b, N, block);
+        std::cout << "StepSignal:  error máximo = " << err << std::endl;
+        ok = ok && err == 0.0;
+    }
+    {
+        PwmSignal a(Ts, 1.0, 0.3, 0.01234567, 0.0, 100), b(Ts, 1.0, 0.3, 0.01234567, 0.0, 100);
+        double err = compare(a, b, N, block);
+        std::cout << "PwmSignal:   error máximo = " << err << std::endl;
+        ok = ok && err == 0.0;
+    }
+    {
+        SineSignal a(Ts, 1.5, 3.7, 0.2, 0.1, 100), b(Ts, 1.5, 3.7, 0.2, 0.1, 100);
+        double err = compare(a, b, N, block);
+        std::cout << "SineSignal (Analytic):   error máximo = " << err << std::endl;
+        ok = ok && err == 0.0;   // Misma base de tiempo (t_ += Ts) en next() y generate()
+    }
+    {
+        SineSignal a(Ts, 1.5, 3.7, 0.2, 0.1, 100, SineMode::Oscillator);
+        SineSignal b(Ts, 1.5, 3.7, 0.2, 0.1, 100, SineMode::Oscillator);
+        double err = compare(a, b, N, block);
+        std::cout << "SineSignal (Oscillator): error máximo = " << err << std::endl;
+        ok = ok && err == 0.0;
+    }
+    {
+        auto makeMixer = [Ts]() {
+            std::vector<std::shared_ptr<Signal>> sigs = {
+                std::make_shared<StepSignal>(Ts, 1.0, 0.5),
+                std::make_shared<SineSignal>(Ts, 0.5, 2.0, 0.0, 0.0, 1024, SineMode::Oscillator),
+                std::make_shared<PwmSignal>(Ts, 0.2, 0.5, 0.01234567)
+            };
+            return SignalMixer(Ts, sigs, {1.0, 2.0, -1.0}, 0.25, 100);
+        };
+        SignalMixer a = makeMixer(), b = makeMixer();
+        double err = compare(a, b, N, 1000);   // Bloques mayores que kMixerBlock
+        std::cout << "SignalMixer: error máximo = " << err << std::endl;
+        ok = ok && err < 1e-12;
+    }
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,54 @@
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <vector>
+#include "SignalGenerator.h"
+#include "SineOscillatorBank.h"
+
+using namespace SignalGenerator;
+
+// Referencia exacta a partir del índice entero de muestra
+static double exactSine(double A, double f, double phase, double Ts, long long k) {
+    long double c = static_cast<long double>(f) * Ts * k;
+    c -= std::floor(c);
+    return A * std::sin(2.0 * M_PI * static_cast<double>(c) + phase);
+}
+
+int main() {
+    std::cout << "TEST SENO POR OSCILADOR RECURSIVO" << std::endl;
+
+    const double Ts = 0.001;          // 1 kHz
+    const double f = 1.37;            // Hz (no conmensurable con Ts)
+    const double phase = 0.3;
+    const long long N = 10000000;     // ~2.8 h de ejecución a 1 kHz
+
+    SineSignal sine(Ts, 1.0, f, phase, 0.0, 16, SineMode::Oscillator);
+    double maxErr = 0.0;
+    for (long long k = 0; k < N; ++k) {
+        double y = sine.next();
+        maxErr = std::max(maxErr, std::abs(y - exactSine(1.0, f, phase, Ts, k)));
+    }
+    std::cout << std::setprecision(3);
+    std::cout << "SineSignal (Oscillator): error máximo en " << N << " muestras = " << maxErr << std::endl;
+
+    // Banco de 8 canales
+    SineOscillatorBank bank(Ts);
+    std::vector<double> freqs = {0.1, 0.5, 1.0, 2.5, 7.3, 11.0, 50.0, 123.4};
+    for (size_t c = 0; c < freqs.size(); ++c) {
+        bank.addChannel(1.0 + c, freqs[c], 0.1 * c);
+    }
+    std::vector<double> out(bank.channels());
+    double maxErrBank = 0.0;
+    for (long long k = 0; k < N / 10; ++k) {
+        bank.step(out.data());
+        for (size_t c = 0; c < freqs.size(); ++c) {
+            double ref = exactSine(1.0 + c, freqs[c], 0.1 * c, Ts, k);
+            maxErrBank = std::max(maxErrBank, std::abs(out[c] - ref));
+        }
+    }
+    std::cout << "SineOscillatorBank (8 canales): error máximo = " << maxErrBank << std::endl;
+
+    bool ok = maxErr < 1e-9 && maxErrBank < 1e-9;
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <unistd.h>
+#include "EntornoFP.h"
+#include "Hilo.h"
+#include "TransferFunctionSystem.h"
+
+using namespace DiscreteSystems;
+
+namespace {
+
+// Respuesta al impulso de un polo en 0.5: el estado recorre todo el rango
+// subnormal entre k ~ 1022 y k ~ 1075
+std::uint64_t recorrerDecaimiento(double& ns_por_muestra) {
+    TransferFunctionSystem tf({1.0}, {1.0, -0.5}, 0.001);
+    ContadorSubnormales c;
+    auto t0 = std::chrono::steady_clock::now();
+    tf.next(1.0);
+    for (int k = 1; k < 1200; ++k) {
+        tf.next(0.0);
+        c.registrar(tf.contarSubnormales());
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    ns_por_muestra = std::chrono::duration<double, std::nano>(t1 - t0).count() / 1200;
+    return c.iteraciones_afectadas.load();
+}
+
+} // namespace
+
+int main() {
+    std::cout << "TEST SUBNORMALES (FTZ/DAZ por hilo)" << std::endl;
+    bool ok = true;
+
+    // 1) Sin FTZ el estado pasa por valores subnormales
+    double ns_sin = 0.0, ns_con = 0.0;
+    std::uint64_t sin_ftz = recorrerDecaimiento(ns_sin);
+    ok = ok && !flushToZeroActivo() && sin_ftz > 40;
+
+    // 2) Con FTZ en otro hilo no aparecen; el hilo principal no cambia
+    std::uint64_t con_ftz = 0;
+    bool soportado = false;
+    std::thread t([&] {
+        soportado = activarFlushToZero() && flushToZeroActivo();
+        con_ftz = recorrerDecaimiento(ns_con);
+    });
+    t.join();
+    std::cout << "Iteraciones con estado subnormal: sin FTZ = " << sin_ftz << " (" << ns_sin
+              << " ns/muestra), con FTZ = " << con_ftz << " (" << ns_con << " ns/muestra)" << std::endl;
+    if (soportado) {
+        ok = ok && con_ftz == 0;
+    }
+    ok = ok && !flushToZeroActivo();
+
+    // 3) Hilo: FTZ activo por defecto y recuento opcional por hilo
+    auto mtx = std::make_shared<pthread_mutex_t>();
+    pthread_mutex_init(mtx.get(), nullptr);
+    bool running = true;
+    auto in = std::make_shared<double>(1.0);
+    auto out1 = std::make_shared<double>(0.0);
+    auto out2 = std::make_shared<double>(0.0);
+    auto tf1 = std::make_shared<TransferFunctionSystem>(std::vector<double>{1.0}, std::vector<double>{1.0, -0.5}, 0.001);
+    auto tf2 = std::make_shared<TransferFunctionSystem>(std::vector<double>{1.0}, std::vector<double>{1.0, -0.5}, 0.001);
+    {
+        ConfigHilo sin, con;
+        sin.flush_to_zero = false;
+        sin.contar_subnormales = true;
+        con.contar_subnormales = true;
+        Hilo h1(tf1, in, out1, &running, mtx, 1000.0, "testSubnormalesSinFTZ", sin);
+        Hilo h2(tf2, in, out2, &running, mtx, 1000.0, "testSubnormalesConFTZ", con);
+        usleep(20000);
+        pthread_mutex_lock(mtx.get());
+        *in = 0.0;
+        pthread_mutex_unlock(mtx.get());
+        usleep(1300000);   // > 1075 periodos de decaimiento
+        pthread_mutex_lock(mtx.get());
+        running = false;
+        pthread_mutex_unlock(mtx.get());
+
+        std::cout << "Hilo sin FTZ: " << h1.subnormales().iteraciones_afectadas.load() << " de "
+                  << h1.subnormales().iteraciones.load() << " iteraciones; con FTZ: "
+                  << h2.subnormales().iteraciones_afectadas.load() << " de "
+                  << h2.subnormales().iteraciones.load() << std::endl;
+        ok = ok && h1.subnormales().iteraciones_afectadas.load() > 0;
+        if (soportado) {
+            ok = ok && h2.subnormales().iteraciones_afectadas.load() == 0;
+        }
+    }
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -3,6 +3,7 @@
 #include <mutex>
 #include <memory>
 #include <cstdio>
+#include <cstdlib>
 #include <ctime>
 #include <csignal>
 #include <sstream>
@@ -22,8 +23,11 @@
 #include "Sumador.h"
 #include "DAConverter.h"
 #include "HiloSignal.h"
+#include "Tracer.h"
 #include "SignalSwitch.h"
 #include "HiloSwitch.h"
+#include "BaseTiempoComun.h"
+#include "TokenParada.h"
 #include "Transmisor.h"
 #include "HiloTransmisor.h"
 #include "Receptor.h"
@@ -31,6 +35,7 @@
 #include "InterruptorArranque.h"
 #include "HiloIntArranque.h"
 #include "Discretizer.h"
+#include "HiloRegistrador.h"
 
 using namespace DiscreteSystems;
 
@@ -43,6 +48,7 @@ void signalHandler(int signum) {
     std::cerr << "\n[Signal Handler] Capturado señal " << signum << " (Ctrl+C)" << std::endl;
     std::cerr << "[Signal Handler] Deteniendo hilos de forma limpia..." << std::endl;
     
+    TokenParada::proceso().detener();   // Los hilos del lazo salen sin esperar a su periodo
     if (g_running_ptr) {
         *g_running_ptr = false;
     }
@@ -56,6 +62,12 @@ void signalHandler(int signum) {
 int main() {
     // --- Crear directorio de logs en raíz del proyecto ---
     mkdir("../logs", 0755);
+
+    // --- Traza de ejecución opcional: DS_TRACE_FILE=traza.json ./testSystem ---
+    const char* trace_path = std::getenv("DS_TRACE_FILE");
+    if (trace_path) {
+        Tracer::habilitar(true);
+    }
     
     // --- Redirigir stderr a archivo con timestamp ---
     time_t now = time(nullptr);
@@ -85,7 +97,7 @@ int main() {
     pthread_mutex_init(mtx.get(), nullptr);
     
     // --- Crear running flag compartido ---
-    auto running = std::make_shared<bool>(false);  // se activará con interruptor->setRun(1)
+    auto running = std::make_shared<bool>(false);  // HiloIntArranque lo activa (interruptor->setRun(1))
     
     // --- Registrar signal handler para Ctrl+C ---
     g_running_ptr = running.get();
@@ -142,8 +154,24 @@ int main() {
     // Crear shared_ptr que apunta a vars->ref
     std::shared_ptr<double> ref(&vars->ref, [](double*){});
     
+    // Base de tiempo común para los 6 hilos del lazo: arrancan juntos y cada
+    // uno en su fase (planta → A/D → ref → sumador → PID → D/A), de modo que
+    // un cambio de ref recorre la cadena dentro del mismo periodo. La parada
+    // llega por el token del proceso (Ctrl+C o setRun(0)), sin leer running
+    // bajo el mutex en cada iteración
+    BaseTiempoComun baseLazo(6);
+    auto fase = [&baseLazo, Ts_component](ConfigHilo& cfg, EtapaLazo etapa) {
+        cfg.base_tiempo = &baseLazo;
+        cfg.fase_s = faseLazo(etapa, Ts_component);
+        cfg.parada = &TokenParada::proceso();
+        cfg.contabilidad_cpu = true;   // cpu_us/nivcsw en los logs: cómputo frente a expulsiones
+    };
+
     // Crear HiloSwitch para ejecutar el switch periódicamente (escribe en vars->ref)
-    HiloSwitch hiloRef(signalSwitch, ref, running.get(), mtx, params, freq_component, "hiloRef");
+    ConfigHilo cfgRef;
+    cfgRef.marca_salida = &vars->marca_ref;
+    fase(cfgRef, EtapaLazo::Referencia);
+    HiloSwitch hiloRef(signalSwitch, ref, running.get(), mtx, params, freq_component, "hiloRef", cfgRef);
   
   
     //-------------------------------------------------------------
@@ -159,7 +187,9 @@ int main() {
     auto tf_disc = discretizeTF(num_s, den_s, Ts_component, DiscretizationMethod::Tustin);
 
     double frequency_plant = freq_component;  // Hz
-    size_t bufferSize = 10;
+    // Nadie lee el historial de los bloques del lazo (si hace falta lo graba el
+    // RegistradorLazo): sin anillo, next() no escribe nada fuera del bloque
+    size_t bufferSize = 0;
 
     // Crear sistema discreto con coeficientes discretizados y Ts_component
     auto planta = std::make_shared<TransferFunctionSystem>(tf_disc.b, tf_disc.a, Ts_component, bufferSize);
@@ -172,17 +202,25 @@ int main() {
     // --------------- Crear hilo de la planta --------------------
     //-------------------------------------------------------------
     // Planta lee vars->ua, escribe vars->yk
-    Hilo hiloPlanta(planta, ua, yk, running.get(), mtx, frequency_plant, "hiloPlanta");
+    ConfigHilo cfgPlanta;
+    cfgPlanta.marca_entrada = &vars->marca_ua;
+    cfgPlanta.marca_salida = &vars->marca_yk;
+    fase(cfgPlanta, EtapaLazo::Planta);
+    Hilo hiloPlanta(planta, ua, yk, running.get(), mtx, frequency_plant, "hiloPlanta", cfgPlanta);
 
     //-------------------------------------------------------------
     // ---------------- Crear ADConverter --------------------------
     //-------------------------------------------------------------
     double Ts_converter = Ts_component;  // período de muestreo
 
-    auto ADconverter = std::make_shared<ADConverter>(Ts_converter);
+    auto ADconverter = std::make_shared<ADConverter>(Ts_converter, bufferSize);
     std::shared_ptr<double> ykd(&vars->ykd, [](double*){});
     // ADConverter lee vars->yk, escribe vars->ykd
-    Hilo hiloAD(ADconverter, yk, ykd, running.get(), mtx, freq_component, "hiloAD");
+    ConfigHilo cfgAD;
+    cfgAD.marca_entrada = &vars->marca_yk;
+    cfgAD.marca_salida = &vars->marca_ykd;
+    fase(cfgAD, EtapaLazo::AD);
+    Hilo hiloAD(ADconverter, yk, ykd, running.get(), mtx, freq_component, "hiloAD", cfgAD);
 
     //-------------------------------------------------------------
     // ---------------- Crear PID ----------------------------------
@@ -196,27 +234,49 @@ int main() {
     params->setpoint = 1.0;  // igual a la amplitud del escalón
     pthread_mutex_unlock(mtx.get());
 
-    auto pid = std::make_shared<PIDController>(params->kp, params->ki, params->kd, Ts_controller);
+    auto pid = std::make_shared<PIDController>(params->kp, params->ki, params->kd, Ts_controller, bufferSize);
     
     // HiloPID lee vars->e, escribe vars->u, actualiza parámetros dinámicamente
-    HiloPID hiloPID(pid.get(), vars.get(), params.get(), freq_controller, "hiloPID");
+    ConfigHilo cfgPID;
+    fase(cfgPID, EtapaLazo::PID);
+    HiloPID hiloPID(pid.get(), vars.get(), params.get(), freq_controller, "hiloPID", cfgPID);
 
     //-------------------------------------------------------------
     // ---------------- Crear DAConverter --------------------------
     //-------------------------------------------------------------
-    auto DAconverter = std::make_shared<DAConverter>(Ts_converter);
+    auto DAconverter = std::make_shared<DAConverter>(Ts_converter, bufferSize);
     std::shared_ptr<double> u(&vars->u, [](double*){});
     // DAConverter lee vars->u, escribe vars->ua
-    Hilo hiloDA(DAconverter, u, ua, running.get(), mtx, freq_component, "hiloDA"); 
+    ConfigHilo cfgDA;
+    cfgDA.marca_entrada = &vars->marca_u;
+    cfgDA.marca_salida = &vars->marca_ua;
+    fase(cfgDA, EtapaLazo::DA);
+    Hilo hiloDA(DAconverter, u, ua, running.get(), mtx, freq_component, "hiloDA", cfgDA);
   
     //-------------------------------------------------------------
     // ---------------- Crear Sumador ------------------------------
     //-------------------------------------------------------------
     double Ts_sumador = Ts_component;
-    auto sumador = std::make_shared<Sumador>(Ts_sumador);
+    auto sumador = std::make_shared<Sumador>(Ts_sumador, bufferSize);
     std::shared_ptr<double> e(&vars->e, [](double*){});
     // Sumador lee vars->ref y vars->ykd, escribe vars->e (error = ref - ykd)
-    Hilo2in hiloSumador(sumador, ref, ykd, e, running.get(), mtx, freq_component, "Sumador");
+    ConfigHilo cfgSumador;
+    cfgSumador.marca_entrada = &vars->marca_ref;
+    cfgSumador.marca_entrada2 = &vars->marca_ykd;
+    cfgSumador.marca_salida = &vars->marca_e;
+    fase(cfgSumador, EtapaLazo::Sumador);
+    Hilo2in hiloSumador(sumador, ref, ykd, e, running.get(), mtx, freq_component, "Sumador", cfgSumador);
+
+    // --- Registro opcional de todo el lazo: DS_REC_FILE=lazo.dsrec ./testSystem ---
+    const char* rec_path = std::getenv("DS_REC_FILE");
+    std::unique_ptr<HiloRegistrador> hiloRegistrador;
+    ConfigHilo cfgAux;                          // Registro e IPC: solo el token de parada
+    cfgAux.parada = &TokenParada::proceso();
+    if (rec_path) {
+        auto registrador = std::make_shared<RegistradorLazo>(rec_path, 1.0 / freq_component);
+        hiloRegistrador = std::make_unique<HiloRegistrador>(registrador, vars.get(), mtx.get(), freq_component, cfgAux);
+        std::cout << "Registrando el lazo en " << rec_path << " a " << freq_component << " Hz" << std::endl;
+    }
 
     //-------------------------------------------------------------
     // -------- Crear transmisor para enviar datos via IPC --------
@@ -224,13 +284,14 @@ int main() {
     auto transmisor = std::make_shared<Transmisor>(vars.get());
     if (!transmisor->inicializar()) {
         std::cerr << "Error: No se pudo inicializar el Transmisor" << std::endl;
+        TokenParada::proceso().detener();   // Los hilos ya creados salen antes del join
         *running = false;
         return 1;
     }
     std::cout << "Transmisor inicializado correctamente" << std::endl;
 
     // --- Crear hilo de transmisión a frecuencia de comunicación (2 Hz = 500ms) ---
-    HiloTransmisor hiloTransmisor(transmisor, running.get(), mtx, freq_communication);
+    HiloTransmisor hiloTransmisor(transmisor, running.get(), mtx, freq_communication, cfgAux);
     std::cout << "Hilo de transmisión iniciado a " << freq_communication << " Hz (500ms)" << std::endl;
 
     //-------------------------------------------------------------
@@ -239,13 +300,14 @@ int main() {
     auto receptor = std::make_shared<Receptor>(params.get());
     if (!receptor->inicializar()) {
         std::cerr << "Error: No se pudo inicializar el Receptor" << std::endl;
+        TokenParada::proceso().detener();   // Los hilos ya creados salen antes del join
         *running = false;
         return 1;
     }
     std::cout << "Receptor inicializado correctamente" << std::endl;
 
     // --- Crear hilo de recepción a frecuencia de comunicación (2 Hz = 500ms) ---
-    HiloReceptor hiloReceptor(receptor, running.get(), mtx, freq_communication);
+    HiloReceptor hiloReceptor(receptor, running.get(), mtx, freq_communication, cfgAux);
     std::cout << "Hilo de recepción iniciado a " << freq_communication << " Hz (500ms)" << std::endl;
 
     //-------------------------------------------------------------
@@ -282,7 +344,7 @@ int main() {
         if (!running_now) break;
 
         // Obtener el número de iteración real del HiloPID
-        int k = hiloPID.getIterations();
+        std::uint64_t k = hiloPID.getIterations();
 
         std::cout << "k=" << k
                   << " | Ref=" << ref_val
@@ -300,6 +362,7 @@ int main() {
     }
     
     // Señalizar a todos los hilos que deben terminar
+    TokenParada::proceso().detener();
     pthread_mutex_lock(mtx.get());
     *running = false;
     pthread_mutex_unlock(mtx.get());
@@ -321,6 +384,22 @@ int main() {
     pthread_join(hiloSumador.getThread(), nullptr);
     pthread_join(hiloTransmisor.getThread(), nullptr);
     pthread_join(hiloReceptor.getThread(), nullptr);
+    hiloRegistrador.reset();
+
+    // Edad de la entrada de cada hilo respecto a la muestra de ref de origen
+    std::cout << "Propagación desde ref (p50 / p99 en ms):" << std::endl;
+    const std::pair<const char*, const HiloTiming*> edades[] = {
+        {"Sumador (ykd)", &hiloSumador.timing()}, {"PID (e)", &hiloPID.timing()},
+        {"DA (u)", &hiloDA.timing()}, {"Planta (ua)", &hiloPlanta.timing()},
+        {"AD (yk)", &hiloAD.timing()}};
+    for (const auto& ed : edades) {
+        std::cout << "  " << ed.first << ": " << ed.second->source_age.percentile(50) / 1e6
+                  << " / " << ed.second->source_age.percentile(99) / 1e6 << std::endl;
+    }
+
+    if (trace_path && Tracer::exportarJson(trace_path)) {
+        std::cout << "Traza escrita en " << trace_path << " (abrir en ui.perfetto.dev)" << std::endl;
+    }
 
     // Cerrar transmisor y receptor
     transmisor->cerrar();
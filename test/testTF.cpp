@@ -70,6 +70,7 @@ int main() {
 
     // Mostrar buffer circular completo
     std::cout << "\nBuffer circular (últimas " << Gz.getCount() << " muestras)" << std::endl;
+    Gz.bufferDump(std::cout, ExportFormat::TSV);
    
 
     printOctave();
@@ -0,0 +1,82 @@
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "TableSignal.h"
+
+using namespace SignalGenerator;
+
+int main() {
+    std::cout << "TEST TABLA DE REFERENCIA (TableSignal)" << std::endl;
+
+    // Perfil: seno de 1 Hz muestreado a 100 Hz durante 10 s
+    const double Ts_table = 0.01;
+    const std::size_t count = 1000;
+    std::vector<double> table(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        table[i] = std::sin(2.0 * M_PI * Ts_table * static_cast<double>(i));
+    }
+
+    const std::string path = "/tmp/testTableSignal.bin";
+    TableSignal::writeFile(path, Ts_table, table.data(), table.size());
+
+    bool ok = true;
+    std::cout << std::setprecision(3);
+
+    // 1) Mismo Ts: se reproducen las muestras tal cual
+    {
+        TableSignal ref(Ts_table, path, TableInterp::Cubic);
+        double maxErr = 0.0;
+        for (std::size_t i = 0; i < count; ++i) {
+            maxErr = std::max(maxErr, std::abs(ref.next() - table[i]));
+        }
+        std::cout << "Mismo Ts (fichero, cúbica): error máximo = " << maxErr << std::endl;
+        ok = ok && maxErr < 1e-9;   // t_ acumula Ts: frac no es exactamente 0
+    }
+
+    // 2) Ts 10 veces menor: error de interpolación frente al seno exacto
+    for (TableInterp interp : {TableInterp::Linear, TableInterp::Cubic}) {
+        TableSignal ref(0.001, path, interp);
+        double maxErr = 0.0;
+        for (std::size_t k = 0; k < 9900; ++k) {
+            double y = ref.next();
+            if (k < 20) continue;   // En el primer tramo la cúbica replica la muestra 0
+            maxErr = std::max(maxErr, std::abs(y - std::sin(2.0 * M_PI * 0.001 * static_cast<double>(k))));
+        }
+        bool linear = interp == TableInterp::Linear;
+        std::cout << (linear ? "Interpolación lineal" : "Interpolación cúbica")
+                  << ": error máximo = " << maxErr << std::endl;
+        ok = ok && maxErr < (linear ? 1e-3 : 1e-4);
+    }
+
+    // 3) Array en memoria, final Hold y Loop
+    {
+        TableSignal hold(0.001, table.data(), count, Ts_table, TableInterp::Linear, TableEnd::Hold);
+        TableSignal loop(0.001, table.data(), count, Ts_table, TableInterp::Linear, TableEnd::Loop);
+        double afterEnd = hold.computeAt(25.0);
+        double wrapped = loop.computeAt(10.0 + 0.25);   // Periodo 10 s -> seno(0.25 s) = 1
+        std::cout << "Hold tras el final = " << afterEnd
+                  << ", Loop en t = 10.25 s = " << wrapped << std::endl;
+        ok = ok && afterEnd == table.back() && std::abs(wrapped - 1.0) < 1e-12;
+    }
+
+    // 4) generate() por bloques frente a next()
+    {
+        TableSignal a(0.001, path, TableInterp::Cubic, TableEnd::Loop);
+        TableSignal b(0.001, path, TableInterp::Cubic, TableEnd::Loop);
+        a.prefetch(1.0);
+        std::vector<double> out(25000);
+        a.generate(out.data(), out.size());
+        double maxErr = 0.0;
+        for (double y : out) {
+            maxErr = std::max(maxErr, std::abs(y - b.next()));
+        }
+        std::cout << "generate() frente a next(): error máximo = " << maxErr << std::endl;
+        ok = ok && maxErr < 1e-9;
+    }
+
+    std::remove(path.c_str());
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,133 @@
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <unistd.h>
+#include "DAConverter.h"
+#include "Hilo.h"
+#include "HiloIntArranque.h"
+#include "HiloRegistrador.h"
+#include "InterruptorArranque.h"
+#include "Temporizador.h"
+#include "TokenParada.h"
+
+using namespace DiscreteSystems;
+
+namespace {
+
+double msDesde(const struct timespec& t0) {
+    struct timespec t1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return (t1.tv_sec - t0.tv_sec) * 1000.0 + (t1.tv_nsec - t0.tv_nsec) / 1e6;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "TEST TOKEN DE PARADA (sin locks, esperas interrumpibles)" << std::endl;
+    bool ok = true;
+
+    // Temporizador a 1 Hz: detener() corta la espera en curso
+    {
+        TokenParada token;
+        Temporizador timer(1.0);
+        timer.setParada(&token);
+        std::thread parador([&] { usleep(20000); token.detener(); });
+        struct timespec t0;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        int r = timer.esperar();
+        double ms = msDesde(t0);
+        parador.join();
+        std::cout << "Espera de 1 s interrumpida a los " << ms << " ms" << std::endl;
+        ok = ok && r == ECANCELED && ms < 500.0;
+
+        // Detenido: las esperas siguientes vuelven en seguida; rearmado, duerme hasta el plazo
+        ok = ok && timer.esperar() == ECANCELED;
+        token.rearmar();
+        Temporizador rapido(200.0);
+        rapido.setParada(&token);
+        ok = ok && rapido.esperar() == 0 && !token.detenido();
+    }
+
+    // Hilo a 2 Hz con ConfigHilo::parada: sale sin esperar al final del periodo
+    // (running sigue a true: el hilo no lo lee)
+    {
+        TokenParada token;
+        bool running = true;
+        pthread_mutex_t mtx = PTHREAD_MUTEX_INITIALIZER;
+        double u = 1.0, y = 0.0;
+        ConfigHilo cfg;
+        cfg.parada = &token;
+        struct timespec t0;
+        {
+            DAConverter da(0.5);
+            Hilo hilo(&da, &u, &y, &running, &mtx, 2.0, "testParada", cfg);
+            usleep(50000);
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            token.detener();
+        }
+        double ms = msDesde(t0);
+        std::cout << "Hilo a 2 Hz terminado " << ms << " ms después de detener()" << std::endl;
+        ok = ok && ms < 100.0 && y == 1.0;
+    }
+
+    // HiloRegistrador a 2 Hz con el mismo token (vars->running sigue a true)
+    {
+        const std::string path = "/tmp/testTokenParada.dsrec";
+        TokenParada token;
+        VariablesCompartidas vars;
+        vars.running = true;
+        pthread_mutex_t mtx = PTHREAD_MUTEX_INITIALIZER;
+        ConfigHilo cfg;
+        cfg.parada = &token;
+        struct timespec t0;
+        {
+            auto rec = std::make_shared<RegistradorLazo>(path, 0.5);
+            HiloRegistrador hiloRec(rec, &vars, &mtx, 2.0, cfg);
+            usleep(50000);
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            token.detener();
+        }
+        double ms = msDesde(t0);
+        std::cout << "HiloRegistrador a 2 Hz terminado " << ms << " ms después de detener()" << std::endl;
+        ok = ok && ms < 100.0;
+        std::remove(path.c_str());
+    }
+
+    // setRun(0) detiene el token del proceso y setRun(1) lo rearma
+    {
+        InterruptorArranque interruptor;
+        interruptor.setRun(0);
+        bool parado = TokenParada::proceso().detenido();
+        interruptor.setRun(1);
+        ok = ok && parado && !TokenParada::proceso().detenido();
+    }
+
+    // Token del proceso: HiloIntArranque sube running al arrancar, SIGINT
+    // detiene el token y HiloIntArranque baja running
+    {
+        auto interruptor = std::make_shared<InterruptorArranque>();
+        interruptor->setRun(1);
+        bool running = false;
+        auto mtx = std::make_shared<pthread_mutex_t>();
+        pthread_mutex_init(mtx.get(), nullptr);
+        {
+            HiloIntArranque hiloInt(interruptor, &running, mtx, 1000.0, "testParadaInt");
+            ok = ok && running;   // Ya en el constructor, antes de crear los demás hilos
+            usleep(10000);
+            ok = ok && !TokenParada::proceso().detenido();
+            errno = EDOM;
+            std::raise(SIGINT);
+            ok = ok && errno == EDOM;   // El manejador restaura errno
+        }
+        std::cout << "Tras SIGINT: token detenido = " << TokenParada::proceso().detenido()
+                  << ", running = " << running << std::endl;
+        ok = ok && TokenParada::proceso().detenido() && !running && !g_signal_run;
+    }
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Tracer.h"
+
+using namespace DiscreteSystems;
+
+namespace {
+
+std::size_t contar(const std::string& texto, const std::string& patron) {
+    std::size_t n = 0;
+    for (std::size_t pos = texto.find(patron); pos != std::string::npos; pos = texto.find(patron, pos + 1)) {
+        ++n;
+    }
+    return n;
+}
+
+std::string leer(const std::string& path) {
+    std::ifstream is(path);
+    std::stringstream ss;
+    ss << is.rdbuf();
+    return ss.str();
+}
+
+} // namespace
+
+int main() {
+    std::cout << "TEST TRAZADOR (Chrome Trace JSON)" << std::endl;
+#ifdef DS_TRACE_DISABLED
+    std::cout << "Compilado con DS_TRACE=OFF: nada que probar" << std::endl;
+    return 0;
+#endif
+
+    const std::string path = "/tmp/testTracer.json";
+    bool ok = true;
+
+    // 1) Deshabilitado: no se registra nada
+    DS_TRACE_INSTANT("ignorado");
+    Tracer::exportarJson(path);
+    std::string vacio = leer(path);
+    std::cout << "Deshabilitado: " << contar(vacio, "\"ph\"") << " eventos" << std::endl;
+    ok = ok && contar(vacio, "\"ph\"") == 0;
+
+    // 2) Dos hilos con nombre, intervalos e instantáneos
+    Tracer::habilitar(true);
+    auto trabajo = [](const char* nombre) {
+        DS_TRACE_THREAD_NAME(nombre);
+        for (int i = 0; i < 100; ++i) {
+            DS_TRACE_SCOPE("iteracion");
+            if (i % 10 == 0) DS_TRACE_INSTANT("marca");
+        }
+    };
+    std::thread a(trabajo, "hiloA");
+    std::thread b(trabajo, "hiloB");
+    a.join();
+    b.join();
+
+    Tracer::exportarJson(path);
+    std::string traza = leer(path);
+    std::size_t completos = contar(traza, "\"ph\": \"X\"");
+    std::size_t instantes = contar(traza, "\"ph\": \"i\"");
+    std::cout << "Intervalos = " << completos << ", instantáneos = " << instantes
+              << ", hiloA = " << contar(traza, "\"hiloA\"")
+              << ", hiloB = " << contar(traza, "\"hiloB\"") << std::endl;
+    ok = ok && completos == 200 && instantes == 20;
+    ok = ok && contar(traza, "\"hiloA\"") == 1 && contar(traza, "\"hiloB\"") == 1;
+    ok = ok && traza.find("\"traceEvents\"") != std::string::npos;
+
+    // 3) Buffer lleno: se descartan los eventos nuevos y se cuentan
+    Tracer::limpiar();
+    Tracer::setCapacidad(50);
+    std::thread c([] {
+        for (int i = 0; i < 80; ++i) DS_TRACE_INSTANT("lleno");
+    });
+    c.join();
+    std::cout << "Capacidad 50, 80 eventos: descartados = " << Tracer::eventosDescartados() << std::endl;
+    ok = ok && Tracer::eventosDescartados() == 30;
+
+    Tracer::habilitar(false);
+    std::remove(path.c_str());
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <unistd.h>
+#include "HiloPeriodico.h"
+#include "Sumador.h"
+#include "VariablesLazoAlineadas.h"
+
+using namespace DiscreteSystems;
+
+int main() {
+    std::cout << "TEST VARIABLES DEL LAZO ALINEADAS (una línea por productor)" << std::endl;
+    bool ok = true;
+
+    // Cada variable empieza en su propia línea de caché
+    VariablesLazoAlineadas va;
+    const char* base = reinterpret_cast<const char*>(&va);
+    const void* campos[] = {&va.ref, &va.e, &va.u, &va.ua, &va.yk, &va.ykd, &va.running};
+    for (std::size_t i = 0; i < 7; ++i) {
+        std::size_t off = static_cast<std::size_t>(reinterpret_cast<const char*>(campos[i]) - base);
+        ok = ok && off == i * kLineaCache;
+    }
+    ok = ok && reinterpret_cast<std::uintptr_t>(&va) % kLineaCache == 0;
+    std::cout << "Layout: " << sizeof(VariablesLazoAlineadas) << " bytes (empaquetado: "
+              << sizeof(VariablesLazoEmpaquetadas) << ")" << std::endl;
+
+    // Seqlock: el lector nunca mezcla el valor de una escritura con la marca de otra
+    CanalLazo canal;
+    std::atomic<bool> fin(false);
+    std::thread escritor([&] {
+        for (std::uint64_t i = 1; i <= 200000; ++i) {
+            canal.publicar(static_cast<double>(i), static_cast<std::int64_t>(i), static_cast<std::int64_t>(i));
+        }
+        fin = true;
+    });
+    std::uint64_t lecturas = 0, incoherentes = 0, ultima = 0, retrocesos = 0;
+    while (!fin.load()) {
+        double v;
+        MarcaTemporal m;
+        canal.leer(v, m);
+        ++lecturas;
+        if (v != static_cast<double>(m.seq) || m.t_origen_ns != static_cast<std::int64_t>(m.seq)) ++incoherentes;
+        if (m.seq < ultima) ++retrocesos;
+        ultima = m.seq;
+    }
+    escritor.join();
+    std::cout << "Lecturas concurrentes: " << lecturas << ", incoherentes: " << incoherentes
+              << ", retrocesos: " << retrocesos << std::endl;
+    ok = ok && incoherentes == 0 && retrocesos == 0 && canal.leer() == 200000.0;
+
+    // HiloPeriodico de 2 entradas sobre canales: e = ref - ykd con el origen de ref
+    va.ref.publicar(3.0, 1234, 1234);
+    va.ykd.publicar(1.0, 99, 99);
+    {
+        auto sumador = std::make_shared<Sumador>(0.001);
+        HiloPeriodico<Sumador, IOCanal2<CanalLazo>> hilo(
+            sumador, IOCanal2<CanalLazo>{&va.ref, &va.ykd, &va.e, &va.running}, 1000.0);
+        usleep(20000);
+        va.running = false;
+    }
+    double e;
+    MarcaTemporal me;
+    va.e.leer(e, me);
+    std::cout << "e = " << e << ", origen = " << me.t_origen_ns << ", escrituras = " << me.seq << std::endl;
+    ok = ok && e == 2.0 && me.t_origen_ns == 1234 && me.seq > 0;
+
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+#include <complex>
+#include <vector>
+#include "Discretizer.h"
+#include "SOSSystem.h"
+
+using namespace DiscreteSystems;
+
+// Butterworth paso bajo de orden N con frecuencia de corte wc [rad/s]
+static ContinuousZPK butterworth(int N, double wc) {
+    ContinuousZPK zpk{{}, {}, std::pow(wc, N)};
+    for (int k = 0; k < N; ++k) {
+        double theta = M_PI * (2.0 * k + N + 1) / (2.0 * N);
+        zpk.poles.push_back(std::polar(wc, theta));
+    }
+    return zpk;
+}
+
+// Coeficientes reales de prod(s - p_k) en orden descendente
+static std::vector<double> polyFromPoles(const std::vector<std::complex<double>>& poles) {
+    std::vector<std::complex<double>> c{1.0};
+    for (const auto& p : poles) {
+        c.push_back(0.0);
+        for (size_t i = c.size() - 1; i > 0; --i) c[i] -= p * c[i - 1];
+    }
+    std::vector<double> r;
+    for (const auto& v : c) r.push_back(v.real());
+    return r;
+}
+
+// Denominador discreto de referencia: polos bilineales exactos expandidos en long double
+static std::vector<long double> referenciaA(int N, double wc, double Ts) {
+    const long double K = 2.0L / Ts;
+    std::vector<std::complex<long double>> a{1.0L};
+    for (int k = 0; k < N; ++k) {
+        long double theta = M_PIl * (2.0L * k + N + 1) / (2.0L * N);
+        std::complex<long double> p = std::polar(static_cast<long double>(wc), theta);
+        std::complex<long double> z = (K + p) / (K - p);
+        a.push_back(0.0L);
+        for (size_t i = a.size() - 1; i > 0; --i) a[i] -= z * a[i - 1];
+    }
+    std::vector<long double> r;
+    for (const auto& v : a) r.push_back(v.real());
+    return r;
+}
+
+// max|a - ref| / max|ref|
+static double errorRelativo(const std::vector<double>& a, const std::vector<long double>& ref) {
+    if (a.size() != ref.size()) return 1.0;
+    long double e = 0.0L, m = 0.0L;
+    for (size_t i = 0; i < ref.size(); ++i) {
+        e = std::max(e, std::abs(static_cast<long double>(a[i]) - ref[i]));
+        m = std::max(m, std::abs(ref[i]));
+    }
+    return static_cast<double>(e / m);
+}
+
+static double dcGain(const DiscreteTF& tf) {
+    double sb = 0.0, sa = 0.0;
+    for (double v : tf.b) sb += v;
+    for (double v : tf.a) sa += v;
+    return sb / sa;
+}
+
+int main() {
+    std::cout << "TEST DISCRETIZACION TUSTIN POLO-CERO" << std::endl;
+
+    const int N = 10;
+    const double wc = 2.0 * M_PI * 10.0;   // 10 Hz
+    const double Ts = 1e-4;                // 10 kHz
+
+    ContinuousZPK zpk = butterworth(N, wc);
+    std::vector<double> num_s = {zpk.gain};
+    std::vector<double> den_s = polyFromPoles(zpk.poles);
+
+    // 1. Expansión monomial clásica
+    DiscreteTF tfMono = discretizeTF(num_s, den_s, Ts, DiscretizationMethod::Tustin);
+    // 2. Raíces del polinomio → bilineal raíz a raíz → expansión en z^-1
+    DiscreteTF tfZpk = discretizeTF(num_s, den_s, Ts, DiscretizationMethod::TustinZPK);
+    // 3. Polos conocidos → secciones de 2º orden
+    std::vector<SecondOrderSection> sos = zpkToSOS(bilinearZPK(zpk, Ts));
+
+    // Las dos expansiones dan coeficientes correctos al redondeo de double,
+    // pero la forma directa de orden 10 está mal condicionada: sum(a) es
+    // ~1e-22 frente a coeficientes ~250, así que su ganancia DC (y su
+    // simulación) no significan nada. Solo la cascada SOS es utilizable.
+    std::vector<long double> aRef = referenciaA(N, wc, Ts);
+    double errMono = errorRelativo(tfMono.a, aRef);
+    double errZpk = errorRelativo(tfZpk.a, aRef);
+    std::cout << "Error relativo de a[] frente a la referencia: monomial " << errMono
+              << ", ZPK " << errZpk << std::endl;
+
+    // polyRoots recupera los polos continuos del denominador expandido
+    double errRaices = 0.0;
+    for (const auto& p : polyRoots(den_s)) {
+        double mejor = INFINITY;
+        for (const auto& q : zpk.poles) mejor = std::min(mejor, std::abs(p - q) / std::abs(q));
+        errRaices = std::max(errRaices, mejor);
+    }
+    std::cout << "Error relativo de polyRoots en los polos de Butterworth: " << errRaices << std::endl;
+
+    std::cout << std::setprecision(10);
+    std::cout << "Ganancia DC (esperada 1.0; en forma directa no es fiable)" << std::endl;
+    std::cout << "  Tustin monomial : " << dcGain(tfMono) << std::endl;
+    std::cout << "  Tustin ZPK      : " << dcGain(tfZpk) << std::endl;
+
+    double g = 1.0;
+    for (const auto& s : sos) g *= (s.b0 + s.b1 + s.b2) / (1.0 + s.a1 + s.a2);
+    std::cout << "  Tustin SOS      : " << g << std::endl;
+
+    // Respuesta al escalón tras 1 s (régimen permanente = 1.0).
+    // Con orden 10 y polos en |z| ~ 0.994 la forma directa de
+    // TransferFunctionSystem no es utilizable; la cascada SOS sí.
+    SOSSystem Gsos(sos, Ts, 10);
+    double ySos = 0.0;
+    for (int k = 0; k < 10000; ++k) {
+        ySos = Gsos.next(1.0);
+    }
+    std::cout << "Escalón y(1 s) con SOS = " << ySos << std::endl;
+
+    // Raíces de un polinomio sencillo: (s+1)(s+2)(s^2+2s+5)
+    auto roots = polyRoots({1.0, 5.0, 13.0, 19.0, 10.0});
+    std::cout << "Raíces de s^4+5s^3+13s^2+19s+10 (esperadas -1, -2, -1±2j):" << std::endl;
+    const std::complex<double> esperadas[] = {{-1.0, 0.0}, {-2.0, 0.0}, {-1.0, 2.0}, {-1.0, -2.0}};
+    bool raices = roots.size() == 4;
+    for (const auto& e : esperadas) {
+        double mejor = INFINITY;
+        for (const auto& r : roots) mejor = std::min(mejor, std::abs(r - e));
+        raices = raices && mejor < 1e-12;
+    }
+    for (const auto& r : roots) std::cout << "  " << r << std::endl;
+
+    bool ok = std::abs(g - 1.0) < 1e-9 && std::abs(ySos - 1.0) < 1e-6 &&
+              errMono < 1e-13 && errZpk < 1e-13 && errRaices < 1e-11 && raices;
+    std::cout << (ok ? "OK" : "FALLO") << std::endl;
+    return ok ? 0 : 1;
+}